@@ -0,0 +1,268 @@
+#include "board.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+const uint32_t SRAM_BASE = 0x80000000, SRAM_SIZE = 8 << 20;
+const uint32_t EXT_RAM_OFFSET = 4 << 20;
+const uint32_t FLASH_SIZE = 8 << 20;
+const uint32_t ROM_SIZE = 1 << 10;
+const uint32_t RESET_VECTOR = 0x82000000;
+
+// PLIC 的中断源编号
+const int IRQ_UART = 1, IRQ_VGA = 2, IRQ_GPIO = 3, IRQ_BLIT = 4;
+
+// mip 中由外部驱动的位
+const uint32_t MIP_MTIP = 1u << 7, MIP_SEIP = 1u << 9, MIP_MEIP = 1u << 11;
+
+const uint32_t WFI = 0x10500073;
+
+// RGB332 扩展为 8 位
+inline uint8_t expand(uint32_t value, int bits) { return value * 255 / ((1 << bits) - 1); }
+
+}  // namespace
+
+Board::Board() : core(*this), blitter(*this) {
+    sram.assign(SRAM_SIZE, 0);
+    flash.assign(FLASH_SIZE, 0xff);
+    rom.assign(ROM_SIZE, 0);
+    core.set_decode_cache(true);
+    core.reset(RESET_VECTOR);
+}
+
+bool Board::load(const std::string &region, const std::string &path) {
+    FILE *f = fopen(path.c_str(), "rb");
+    if (!f) {
+        fprintf(stderr, "Failed to open %s init file %s\n", region.c_str(), path.c_str());
+        return false;
+    }
+    if (region == "bootrom") {
+        // 与 boot_rom 的 $readmemh 相同，每行一个字
+        uint32_t word;
+        for (size_t off = 0; off < ROM_SIZE && fscanf(f, "%x", &word) == 1; off += 4) {
+            memcpy(&rom[off], &word, 4);
+        }
+    } else {
+        uint8_t *base = region == "flash" ? flash.data() : sram.data();
+        size_t size = region == "flash" ? FLASH_SIZE : EXT_RAM_OFFSET;
+        if (region == "ext") {
+            base += EXT_RAM_OFFSET;
+        }
+        size_t n = fread(base, 1, size, f);
+        if (fgetc(f) != EOF) {
+            fprintf(stderr, "%s is larger than %s, truncated to %zu bytes\n", path.c_str(),
+                    region.c_str(), n);
+        }
+    }
+    fclose(f);
+    return true;
+}
+
+// ==== 总线 ====
+// 地址划分与 thinpad_top 中 wb_mux_17 的配置相同。设备按整个字读出，
+// 再按地址的低两位取出需要的字节
+
+uint32_t Board::read(uint32_t paddr, int size) {
+    uint32_t data;
+    if (paddr - SRAM_BASE < SRAM_SIZE) {
+        data = 0;
+        memcpy(&data, &sram[paddr - SRAM_BASE], size);
+        return data;
+    }
+    switch (paddr >> 24) {
+    case 0x82:  // boot ROM，地址窗口中按容量重复
+        data = 0;
+        memcpy(&data, &rom[(paddr - RESET_VECTOR) & (ROM_SIZE - 1)], size);
+        return data;
+    case 0x83:  // flash
+        data = 0;
+        memcpy(&data, &flash[paddr & (FLASH_SIZE - 1)], size);
+        return data;
+    default:
+        break;
+    }
+    data = device_read(paddr) >> ((paddr & 3) * 8);
+    return size == 4 ? data : data & ((1u << (size * 8)) - 1);
+}
+
+void Board::write(uint32_t paddr, int size, uint32_t data) {
+    if (paddr - SRAM_BASE < SRAM_SIZE) {
+        memcpy(&sram[paddr - SRAM_BASE], &data, size);
+        return;
+    }
+    switch (paddr >> 24) {
+    case 0x81: vga.bram_write(0, paddr, size, data); return;
+    case 0x84: vga.bram_write(1, paddr, size, data); return;
+    case 0x82:  // boot ROM 和 flash 只读
+    case 0x83: return;
+    default: break;
+    }
+    device_write(paddr, data);
+}
+
+void Board::dma_write(uint32_t paddr, int size, uint32_t data) {
+    write(paddr, size, data);
+    core.invalidate(paddr);
+}
+
+uint32_t Board::device_read(uint32_t paddr) {
+    uint32_t data = 0;
+    if ((paddr >> 16) == 0x1000) {
+        // 串口的寄存器按字节编址
+        data = uart.read(paddr, now);
+    } else if ((paddr >> 26) == 0x03) {  // 0x0C00_0000 ~ 0x0FFF_FFFF
+        data = plic.read(paddr & ~3u);
+    } else if ((paddr >> 16) == 0x0200) {
+        data = clint.read(paddr & ~3u, now);
+    } else {
+        switch (paddr >> 24) {
+        case 0x81:
+        case 0x84:  // 显存的读口接在 vga_pic 上，总线一侧读不出数据
+            break;
+        case 0x85: data = gpio.read(paddr & ~3u); break;
+        case 0x86: data = vga.read(paddr & ~3u); break;
+        case 0x87: data = blitter.read(paddr & ~3u); break;
+        default:
+            if (!warned_unmodeled) {
+                fprintf(stderr, "emu: %08x is not modeled, reads as 0\n", paddr & ~3u);
+                warned_unmodeled = true;
+            }
+            break;
+        }
+    }
+    // 读 PLIC 的 claim、GPIO 的 EVT_DATA 等都会改变中断
+    update_irq();
+    return data;
+}
+
+void Board::device_write(uint32_t paddr, uint32_t data) {
+    if ((paddr >> 16) == 0x1000) {
+        uart.write(paddr, data, now);
+    } else if ((paddr >> 26) == 0x03) {
+        plic.write(paddr, data);
+    } else if ((paddr >> 16) == 0x0200) {
+        clint.write(paddr, data, now);
+    } else {
+        switch (paddr >> 24) {
+        case 0x85: gpio.write(paddr, data); break;
+        case 0x86: vga.write(paddr, data); break;
+        case 0x87:
+            if (blitter.write(paddr, data, vga.back_sele())) {
+                plic.pulse(IRQ_BLIT);
+            }
+            break;
+        default: break;
+        }
+    }
+    update_irq();
+    reschedule = true;
+}
+
+// ==== 中断和事件 ====
+
+void Board::update_irq() {
+    plic.set_levels((uart.irq(now) ? 1u << (IRQ_UART - 1) : 0) |
+                    (vga.irq() ? 1u << (IRQ_VGA - 1) : 0) |
+                    (gpio.irq() ? 1u << (IRQ_GPIO - 1) : 0));
+    core.set_irq(MIP_MEIP, plic.meip());
+    core.set_irq(MIP_SEIP, plic.seip());
+    core.set_irq(MIP_MTIP, clint.irq(now));
+}
+
+uint64_t Board::next_event() const {
+    uint64_t t = std::min(now + SLICE_CYCLES, next_vblank);
+    if (!clint.irq(now)) {
+        t = std::min(t, clint.next_irq(now));
+    }
+    if (next_key < key_events.size()) {
+        t = std::min(t, key_events[next_key].cycle);
+    }
+    return std::max(t, now + 1);
+}
+
+void Board::handle_events() {
+    while (next_key < key_events.size() && key_events[next_key].cycle <= now) {
+        gpio.set_inputs(gpio.dip_sw, key_events[next_key].buttons,
+                        static_cast<uint32_t>(clint.mtime(now)));
+        next_key++;
+    }
+    if (now >= next_vblank) {
+        vga.vblank();
+        if (!frame_pattern.empty() && frame % frame_interval == 0) {
+            char path[4096];
+            snprintf(path, sizeof(path), frame_pattern.c_str(),
+                     static_cast<int>(frame / frame_interval));
+            write_frame(path);
+        }
+        frame++;
+        next_vblank += Vga::FRAME_CYCLES;
+    }
+    update_irq();
+    fflush(stdout);
+}
+
+void Board::run(uint64_t until, const volatile sig_atomic_t &stop) {
+    while (now < until && !stop) {
+        handle_events();
+        uint64_t end = std::min(next_event(), until);
+        reschedule = false;
+        while (now < end && !reschedule) {
+            core.set_time(now);
+            // RTL 在 EXE 阶段注入中断，相当于在下一条指令之前进入
+            int irq = core.pending_interrupt();
+            if (irq >= 0) {
+                core.trap(0x80000000u | irq, 0);
+            }
+            RvStep s = core.step();
+            now++;
+            instret++;
+            // 等待中断时直接跳到下一个事件
+            if (s.instr == WFI && s.kind == RvStep::RETIRE && core.pending_interrupt() < 0) {
+                now = std::max(now, end);
+            }
+        }
+    }
+}
+
+// ==== 输入输出 ====
+
+void Board::add_key_event(uint64_t cycle, uint32_t buttons) {
+    key_events.push_back({cycle, buttons});
+    std::stable_sort(key_events.begin(), key_events.end(),
+                     [](const KeyEvent &a, const KeyEvent &b) { return a.cycle < b.cycle; });
+}
+
+void Board::set_dip_sw(uint32_t dip_sw) {
+    // 复位时的电平，与 RTL 相同不产生边沿
+    gpio.dip_sw = dip_sw;
+}
+
+void Board::set_frame_output(const std::string &pattern, int interval) {
+    frame_pattern = pattern;
+    frame_interval = std::max(interval, 1);
+}
+
+bool Board::write_frame(const std::string &path) {
+    FILE *f = fopen(path.c_str(), "wb");
+    if (!f) {
+        fprintf(stderr, "Failed to write frame %s\n", path.c_str());
+        return false;
+    }
+    vga.render(&sram[EXT_RAM_OFFSET], pixels);
+    fprintf(f, "P6\n%d %d\n255\n", Vga::HSIZE, Vga::VSIZE);
+    std::vector<uint8_t> row(Vga::HSIZE * 3);
+    for (int y = 0; y < Vga::VSIZE; y++) {
+        for (int x = 0; x < Vga::HSIZE; x++) {
+            uint8_t p = pixels[y * Vga::HSIZE + x];
+            row[x * 3] = expand(p >> 5, 3);
+            row[x * 3 + 1] = expand((p >> 2) & 7, 3);
+            row[x * 3 + 2] = expand(p & 3, 2);
+        }
+        fwrite(row.data(), 1, row.size(), f);
+    }
+    fclose(f);
+    return true;
+}
@@ -0,0 +1,91 @@
+// thinpad_top 的功能模型：参考模型（iss/rv32_core）加上 SRAM、flash、boot ROM 和板上外设。
+// 一条指令计为一个系统周期，mtime、time CSR 和场消隐都按这个周期数计时。
+#pragma once
+
+#include <csignal>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "devices.h"
+#include "rv32_core.h"
+
+class Board : public RvBus {
+public:
+    // 与 RTL 相同，20MHz 的系统时钟
+    static constexpr double SYS_CLK_FREQ = 20e6;
+
+    Board();
+
+    // 加载存储器镜像，region 为 base、ext、flash 或 bootrom（bootrom.mem 的文本格式）
+    bool load(const std::string &region, const std::string &path);
+
+    uint32_t read(uint32_t paddr, int size) override;
+    void write(uint32_t paddr, int size, uint32_t data) override;
+
+    // blitter 的总线访问，写入时清除译码缓存
+    uint32_t dma_read(uint32_t paddr, int size) { return read(paddr, size); }
+    void dma_write(uint32_t paddr, int size, uint32_t data);
+
+    // 运行到 until 周期，或 stop 被置位
+    void run(uint64_t until, const volatile sig_atomic_t &stop);
+
+    // 终端输入的字节
+    void uart_receive(const uint8_t *data, size_t n) { uart.receive(data, n, now); }
+
+    // 在 cycle 时把按键（bit0 push_btn，[4:1] touch_btn）设为 buttons
+    void add_key_event(uint64_t cycle, uint32_t buttons);
+    // 拨码开关，在开始运行之前设置
+    void set_dip_sw(uint32_t dip_sw);
+
+    // 每隔 interval 帧把画面写到 pattern（printf 格式，参数为帧号）指定的 PPM 文件
+    void set_frame_output(const std::string &pattern, int interval);
+    bool write_frame(const std::string &path);
+
+    uint64_t cycles() const { return now; }
+    uint64_t instructions() const { return instret; }
+    uint64_t frames() const { return frame; }
+
+    // 每隔这么多周期检查一次终端输入等外部事件
+    static const uint64_t SLICE_CYCLES = 4096;
+
+private:
+    uint32_t device_read(uint32_t paddr);
+    void device_write(uint32_t paddr, uint32_t data);
+    void update_irq();
+    void handle_events();
+    uint64_t next_event() const;
+
+    Rv32Core core;
+
+    std::vector<uint8_t> sram;  // BaseRAM 和 ExtRAM，各 4MB，地址连续
+    std::vector<uint8_t> flash;
+    std::vector<uint8_t> rom;
+
+    Uart uart;
+    Clint clint;
+    Plic plic;
+    Gpio gpio;
+    Vga vga;
+    Blitter blitter;
+
+    uint64_t now = 0;
+    uint64_t instret = 0;
+    uint64_t next_vblank = Vga::FRAME_CYCLES;
+    uint64_t frame = 0;
+    // 设备的寄存器被改写，需要重新计算下一个事件
+    bool reschedule = false;
+
+    struct KeyEvent {
+        uint64_t cycle;
+        uint32_t buttons;
+    };
+    std::vector<KeyEvent> key_events;  // 按时间排序
+    size_t next_key = 0;
+
+    std::string frame_pattern;
+    int frame_interval = 1;
+    std::vector<uint8_t> pixels;
+
+    bool warned_unmodeled = false;
+};
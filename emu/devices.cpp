@@ -0,0 +1,496 @@
+#include "devices.h"
+
+#include <cstdio>
+#include <cstring>
+
+#include "board.h"
+
+namespace {
+
+// 无效的寄存器地址读出 0x1111，与 RTL 中各个控制器相同
+const uint32_t INVALID_REG = 0x00001111;
+
+inline uint32_t replicate(uint8_t byte) { return byte * 0x01010101u; }
+
+}  // namespace
+
+// ==== 串口 ====
+
+namespace {
+
+const uint32_t UART_DATA = 0x00, UART_IER = 0x01, UART_IIR = 0x02, UART_LCR = 0x03;
+const uint32_t UART_MCR = 0x04, UART_LSR = 0x05, UART_MSR = 0x06, UART_SCR = 0x07;
+
+// 4 个字符时间，按 8 倍过采样计
+const uint64_t UART_TIMEOUT_TICKS = 4 * 10 * 8;
+
+}  // namespace
+
+uint64_t Uart::timeout_cycles() const {
+    return UART_TIMEOUT_TICKS * ((dlm << 8 | dll) * 16 + dld) / 16;
+}
+
+void Uart::refill(uint64_t now) {
+    while (!host.empty() && rx.size() < FIFO_DEPTH) {
+        rx.push_back(host.front());
+        host.pop_front();
+        last_activity = now;
+    }
+}
+
+void Uart::receive(const uint8_t *data, size_t n, uint64_t now) {
+    host.insert(host.end(), data, data + n);
+    refill(now);
+}
+
+uint32_t Uart::iir_id(uint64_t now) const {
+    static const size_t triggers[] = {1, 4, 8, 14};
+    if ((ier & 4) && overrun) return 0x6;
+    if ((ier & 1) && rx.size() >= triggers[rx_trigger]) return 0x4;
+    if ((ier & 1) && !rx.empty() && now - last_activity >= timeout_cycles()) return 0xc;
+    if ((ier & 2) && thre_pending) return 0x2;
+    return 0x1;
+}
+
+bool Uart::irq(uint64_t now) const { return !(iir_id(now) & 1); }
+
+uint32_t Uart::read(uint32_t offset, uint64_t now) {
+    bool dlab = lcr & 0x80;
+    uint8_t byte = 0;
+    switch (offset & 0xff) {
+    case UART_DATA:
+        if (dlab) {
+            byte = dll;
+        } else if (!rx.empty()) {
+            byte = rx.front();
+            rx.pop_front();
+            last_activity = now;
+            refill(now);
+        }
+        break;
+    case UART_IER: byte = dlab ? dlm : ier; break;
+    case UART_IIR:
+        if (dlab) {
+            byte = dld;
+        } else {
+            uint32_t id = iir_id(now);
+            if (id == 0x2) thre_pending = false;
+            // FIFO 总是打开的，IIR[7:6] 总是 11
+            byte = 0xc0 | id;
+        }
+        break;
+    case UART_LCR: byte = lcr; break;
+    case UART_MCR: byte = mcr; break;
+    case UART_LSR: {
+        // 发送总是立即完成，THRE 和 TEMT 总为 1
+        byte = 0x60 | (overrun ? 0x02 : 0) | (rx.empty() ? 0 : 0x01);
+        overrun = false;
+        break;
+    }
+    case UART_MSR: byte = 0; break;
+    case UART_SCR: byte = scr; break;
+    default: break;
+    }
+    return replicate(byte);
+}
+
+void Uart::write(uint32_t offset, uint32_t data, uint64_t now) {
+    bool dlab = lcr & 0x80;
+    uint8_t byte = data & 0xff;
+    switch (offset & 0xff) {
+    case UART_DATA:
+        if (dlab) {
+            dll = byte;
+        } else {
+            putchar(byte);
+            // 发送 FIFO 立即排空
+            thre_pending = true;
+        }
+        break;
+    case UART_IER:
+        if (dlab) {
+            dlm = byte;
+        } else {
+            if ((byte & 2) && !(ier & 2)) thre_pending = true;
+            ier = byte & 0xf;
+        }
+        break;
+    case UART_IIR:
+        if (dlab) {
+            dld = byte & 0xf;
+        } else {
+            rx_trigger = byte >> 6;
+            if (byte & 2) {
+                rx.clear();
+                refill(now);
+            }
+        }
+        break;
+    case UART_LCR: lcr = byte; break;
+    case UART_MCR: mcr = byte; break;
+    case UART_SCR: scr = byte; break;
+    default: break;
+    }
+}
+
+// ==== CLINT ====
+
+namespace {
+
+const uint32_t CLINT_MTIMECMP = 0x2004000, CLINT_MTIME = 0x200bff8;
+
+}  // namespace
+
+uint32_t Clint::read(uint32_t addr, uint64_t now) const {
+    switch (addr) {
+    case CLINT_MTIME: return static_cast<uint32_t>(mtime(now));
+    case CLINT_MTIME + 4: return static_cast<uint32_t>(mtime(now) >> 32);
+    case CLINT_MTIMECMP: return static_cast<uint32_t>(mtimecmp);
+    case CLINT_MTIMECMP + 4: return static_cast<uint32_t>(mtimecmp >> 32);
+    default: return 0;
+    }
+}
+
+void Clint::write(uint32_t addr, uint32_t data, uint64_t now) {
+    uint64_t t = mtime(now);
+    switch (addr) {
+    case CLINT_MTIME: t = (t & ~0xffffffffull) | data; break;
+    case CLINT_MTIME + 4: t = (t & 0xffffffffull) | static_cast<uint64_t>(data) << 32; break;
+    case CLINT_MTIMECMP: mtimecmp = (mtimecmp & ~0xffffffffull) | data; break;
+    case CLINT_MTIMECMP + 4:
+        mtimecmp = (mtimecmp & 0xffffffffull) | static_cast<uint64_t>(data) << 32;
+        break;
+    default: break;
+    }
+    offset = t - now;
+}
+
+uint64_t Clint::next_irq(uint64_t now) const {
+    return irq(now) ? now : now + (mtimecmp - mtime(now));
+}
+
+// ==== PLIC ====
+
+int Plic::best(int ctx) const {
+    int id = 0;
+    uint32_t prio = 0;
+    for (int i = 1; i <= NUM_SOURCES; i++) {
+        if (((pending >> (i - 1)) & 1) && ((enable[ctx] >> i) & 1) && priority[i] > prio) {
+            id = i;
+            prio = priority[i];
+        }
+    }
+    return prio > threshold[ctx] ? id : 0;
+}
+
+// 网关：电平中断源不在处理中时挂起，撤销时取消挂起；边沿中断源记住脉冲，处理完后再挂起
+void Plic::update() {
+    uint32_t level = ~EDGE_TRIGGERED & ((1u << NUM_SOURCES) - 1);
+    pending = (pending & ~level) | (levels & level & ~in_flight) | (pending & level & levels);
+    uint32_t ready = edge_seen & ~in_flight & ~pending;
+    pending |= ready;
+    edge_seen &= ~ready;
+}
+
+void Plic::set_levels(uint32_t l) {
+    levels = l;
+    update();
+}
+
+void Plic::pulse(int id) {
+    edge_seen |= 1u << (id - 1);
+    update();
+}
+
+uint32_t Plic::read(uint32_t offset) {
+    offset &= 0xffffff;
+    if ((offset >> 12) == 0x000) {
+        uint32_t id = (offset >> 2) & 0x3ff;
+        return id >= 1 && id <= NUM_SOURCES ? priority[id] : 0;
+    }
+    if ((offset >> 12) == 0x001) {
+        return (offset & 0xffc) == 0 ? pending << 1 : 0;
+    }
+    if ((offset >> 12) == 0x002 && ((offset >> 8) & 0xf) == 0) {
+        return (offset & 0x7c) == 0 ? enable[(offset >> 7) & 1] : 0;
+    }
+    if ((offset >> 16) == 0x20 && (offset & 0xeff8) == 0) {
+        int ctx = (offset >> 12) & 1;
+        if (!(offset & 4)) {
+            return threshold[ctx];
+        }
+        // 认领：清除挂起，处理完成之前不再转发
+        int id = best(ctx);
+        if (id) {
+            pending &= ~(1u << (id - 1));
+            in_flight |= 1u << (id - 1);
+            update();
+        }
+        return id;
+    }
+    return 0;
+}
+
+void Plic::write(uint32_t offset, uint32_t data) {
+    offset &= 0xffffff;
+    if ((offset >> 12) == 0x000) {
+        uint32_t id = (offset >> 2) & 0x3ff;
+        if (id >= 1 && id <= NUM_SOURCES) priority[id] = data & 7;
+    } else if ((offset >> 12) == 0x002 && ((offset >> 8) & 0xf) == 0) {
+        if ((offset & 0x7c) == 0) enable[(offset >> 7) & 1] = data & (((1u << NUM_SOURCES) - 1) << 1);
+    } else if ((offset >> 16) == 0x20 && (offset & 0xeff8) == 0) {
+        int ctx = (offset >> 12) & 1;
+        if (!(offset & 4)) {
+            threshold[ctx] = data & 7;
+        } else {
+            uint32_t id = data & 7;
+            if (id >= 1 && id <= NUM_SOURCES) {
+                in_flight &= ~(1u << (id - 1));
+                update();
+            }
+        }
+    }
+}
+
+// ==== GPIO ====
+
+namespace {
+
+const uint32_t GPIO_SW = 0x00, GPIO_BTN = 0x04, GPIO_DEBOUNCE = 0x08, GPIO_SW_EDGE = 0x0c;
+const uint32_t GPIO_BTN_EDGE = 0x10, GPIO_EVT_EN = 0x14, GPIO_EVT_STATUS = 0x18;
+const uint32_t GPIO_EVT_TIME = 0x1c, GPIO_EVT_DATA = 0x20;
+
+}  // namespace
+
+void Gpio::set_inputs(uint32_t new_sw, uint32_t new_btn, uint32_t mtime) {
+    new_btn &= 0x1f;
+    uint64_t old_in = static_cast<uint64_t>(buttons) << 32 | dip_sw;
+    uint64_t new_in = static_cast<uint64_t>(new_btn) << 32 | new_sw;
+    uint64_t rise = new_in & ~old_in, fall = ~new_in & old_in;
+    dip_sw = new_sw;
+    buttons = new_btn;
+
+    sw_edge |= static_cast<uint32_t>(rise | fall);
+    btn_rise |= static_cast<uint32_t>(rise >> 32);
+    btn_fall |= static_cast<uint32_t>(fall >> 32);
+
+    // 与 RTL 相同，同时发生的边沿按输入编号从小到大写入事件 FIFO
+    uint64_t sw_mask = (evt_en & 0x10000) ? 0xffffffffull : 0;
+    uint64_t evt_rise = rise & (static_cast<uint64_t>(evt_en & 0x1f) << 32 | sw_mask);
+    uint64_t evt_fall = fall & (static_cast<uint64_t>((evt_en >> 8) & 0x1f) << 32 | sw_mask);
+    for (int i = 0; i < 37; i++) {
+        if (!(((evt_rise | evt_fall) >> i) & 1)) {
+            continue;
+        }
+        if (events.size() == EVT_DEPTH) {
+            evt_overflow = true;
+            continue;
+        }
+        events.push_back({mtime, static_cast<uint32_t>(((evt_rise >> i) & 1) << 8 | i)});
+    }
+}
+
+uint32_t Gpio::read(uint32_t offset) {
+    switch (offset & 0xff) {
+    case GPIO_SW: return dip_sw;
+    case GPIO_BTN: return buttons;
+    case GPIO_DEBOUNCE: return debounce;
+    case GPIO_SW_EDGE: return sw_edge;
+    case GPIO_BTN_EDGE: return btn_fall << 8 | btn_rise;
+    case GPIO_EVT_EN: return evt_en;
+    case GPIO_EVT_STATUS:
+        return (evt_overflow ? 1u << 16 : 0) | static_cast<uint32_t>(events.size()) << 8 |
+               (events.empty() ? 0 : 1);
+    case GPIO_EVT_TIME: return events.empty() ? 0 : events.front().time;
+    case GPIO_EVT_DATA: {
+        if (events.empty()) {
+            return 0;
+        }
+        uint32_t data = 0x80000000 | events.front().data;
+        events.pop_front();
+        return data;
+    }
+    default: return INVALID_REG;
+    }
+}
+
+void Gpio::write(uint32_t offset, uint32_t data) {
+    switch (offset & 0xff) {
+    case GPIO_DEBOUNCE: debounce = data; break;
+    case GPIO_SW_EDGE: sw_edge &= ~data; break;
+    case GPIO_BTN_EDGE:
+        btn_rise &= ~data & 0x1f;
+        btn_fall &= ~(data >> 8) & 0x1f;
+        break;
+    case GPIO_EVT_EN: evt_en = data; break;
+    case GPIO_EVT_STATUS:
+        if (data & 0x10000) evt_overflow = false;
+        break;
+    default: break;
+    }
+}
+
+// ==== VGA ====
+
+namespace {
+
+const uint32_t VGA_SCALE = 0x00, VGA_BRAM_SELE = 0x04, VGA_STATUS = 0x08, VGA_IRQ_EN = 0x0c;
+const uint32_t VGA_FB_CTRL = 0x10, VGA_FB_BASE = 0x14;
+
+}  // namespace
+
+Vga::Vga() {
+    bram[0].assign(BRAM_SIZE, 0);
+    bram[1].assign(BRAM_SIZE, 0);
+}
+
+uint32_t Vga::read(uint32_t offset) const {
+    switch (offset & 0xff) {
+    case VGA_SCALE: return vga_scale_reg;
+    case VGA_BRAM_SELE: return bram_sele_reg;
+    case VGA_STATUS: return (vblank_flag ? 2 : 0) | (flip_pending ? 1 : 0);
+    case VGA_IRQ_EN: return vblank_irq_en;
+    case VGA_FB_CTRL: return fb_ctrl_reg;
+    case VGA_FB_BASE: return fb_base_reg;
+    default: return INVALID_REG;
+    }
+}
+
+void Vga::write(uint32_t offset, uint32_t data) {
+    switch (offset & 0xff) {
+    case VGA_SCALE: vga_scale_reg = data; flip_pending = true; break;
+    case VGA_BRAM_SELE: bram_sele_reg = data; flip_pending = true; break;
+    case VGA_STATUS:
+        if (data & 2) vblank_flag = false;
+        break;
+    case VGA_IRQ_EN: vblank_irq_en = data & 1; break;
+    case VGA_FB_CTRL: fb_ctrl_reg = data; flip_pending = true; break;
+    case VGA_FB_BASE: fb_base_reg = data; flip_pending = true; break;
+    default: break;
+    }
+}
+
+void Vga::bram_write(int index, uint32_t offset, int size, uint32_t data) {
+    memcpy(&bram[index][offset & (BRAM_SIZE - 1) & ~(size - 1)], &data, size);
+}
+
+void Vga::vblank() {
+    vblank_flag = true;
+    if (flip_pending) {
+        sele_sync = bram_sele_reg & 1;
+        vga_scale_sync = vga_scale_reg & 7;
+        fb_enable_sync = fb_ctrl_reg & 1;
+        fb_base_sync = fb_base_reg & 0x3ffffc;
+        flip_pending = false;
+    }
+}
+
+void Vga::render(const uint8_t *ext_ram, std::vector<uint8_t> &pixels) const {
+    pixels.resize(HSIZE * VSIZE);
+    if (fb_enable_sync) {
+        // vga_scanout：ExtRAM 中每行 800 字节，不缩放
+        for (int y = 0; y < VSIZE; y++) {
+            for (int x = 0; x < HSIZE; x++) {
+                pixels[y * HSIZE + x] = ext_ram[(fb_base_sync + y * HSIZE + x) & ((4 << 20) - 1)];
+            }
+        }
+        return;
+    }
+    // vga_pic：每个像素放大为 2^scale x 2^scale 的方块
+    const std::vector<uint8_t> &mem = bram[sele_sync];
+    uint32_t s = vga_scale_sync, width = HSIZE >> s;
+    for (int y = 0; y < VSIZE; y++) {
+        for (int x = 0; x < HSIZE; x++) {
+            pixels[y * HSIZE + x] = mem[((y >> s) * width + (x >> s)) & (BRAM_SIZE - 1)];
+        }
+    }
+}
+
+// ==== Blitter ====
+
+namespace {
+
+const uint32_t BLIT_CTRL = 0x00, BLIT_STATUS = 0x04, BLIT_SRC_ADDR = 0x08, BLIT_SRC_STRIDE = 0x0c;
+const uint32_t BLIT_DST_ADDR = 0x10, BLIT_DST_STRIDE = 0x14, BLIT_SIZE = 0x18, BLIT_KEY = 0x1c;
+const uint32_t BLIT_COLOR = 0x20;
+
+const uint32_t CTRL_START = 1 << 0, CTRL_KEY_EN = 1 << 1, CTRL_HFLIP = 1 << 2;
+const uint32_t CTRL_DST_ABS = 1 << 3, CTRL_FILL = 1 << 4, CTRL_WORD = 1 << 5;
+
+const uint32_t BRAM_0_BASE = 0x81000000, BRAM_1_BASE = 0x84000000;
+
+}  // namespace
+
+uint32_t Blitter::read(uint32_t offset) const {
+    switch (offset & 0xff) {
+    case BLIT_CTRL: return ctrl;
+    case BLIT_STATUS: return error ? 2 : 0;  // 搬运在启动时已经完成，BUSY 总为 0
+    case BLIT_SRC_ADDR: return src_addr;
+    case BLIT_SRC_STRIDE: return src_stride;
+    case BLIT_DST_ADDR: return dst_addr;
+    case BLIT_DST_STRIDE: return dst_stride;
+    case BLIT_SIZE: return size;
+    case BLIT_KEY: return key;
+    case BLIT_COLOR: return color;
+    default: return INVALID_REG;
+    }
+}
+
+bool Blitter::write(uint32_t offset, uint32_t data, int back_sele) {
+    switch (offset & 0xff) {
+    case BLIT_CTRL:
+        // START 位不保存
+        ctrl = data & ~CTRL_START;
+        if (!(data & CTRL_START)) {
+            break;
+        }
+        // 与 RTL 相同，显存只能写，以显存为源的搬运被拒绝，置位 ERROR 并给出完成中断
+        error = !(ctrl & CTRL_FILL) &&
+                ((src_addr >> 24) == (BRAM_0_BASE >> 24) || (src_addr >> 24) == (BRAM_1_BASE >> 24));
+        if (error) {
+            return true;
+        }
+        // 空矩形不搬运，但和 RTL 一样给出完成中断
+        if ((size & 0xffff) && (size >> 16)) {
+            run(back_sele);
+        }
+        return true;
+    case BLIT_SRC_ADDR: src_addr = data; break;
+    case BLIT_SRC_STRIDE: src_stride = data; break;
+    case BLIT_DST_ADDR: dst_addr = data; break;
+    case BLIT_DST_STRIDE: dst_stride = data; break;
+    case BLIT_SIZE: size = data; break;
+    case BLIT_KEY: key = data; break;
+    case BLIT_COLOR: color = data; break;
+    default: break;
+    }
+    return false;
+}
+
+void Blitter::run(int back_sele) {
+    bool word = ctrl & CTRL_WORD, fill = ctrl & CTRL_FILL;
+    bool key_en = (ctrl & CTRL_KEY_EN) && !word, hflip = (ctrl & CTRL_HFLIP) && !word;
+    uint32_t width = size & 0xffff, height = size >> 16;
+    uint32_t src_row = src_addr;
+    uint32_t dst_row = (ctrl & CTRL_DST_ABS) ? dst_addr
+                                             : (back_sele ? BRAM_1_BASE : BRAM_0_BASE) + dst_addr;
+    uint8_t pixel = color & 0xff;
+    uint32_t word_data = replicate(pixel);
+
+    for (uint32_t row = 0; row < height; row++) {
+        for (uint32_t col = 0; col < width; col++) {
+            if (word) {
+                if (!fill) word_data = board.dma_read((src_row + col * 4) & ~3u, 4);
+                board.dma_write((dst_row + col * 4) & ~3u, 4, word_data);
+                continue;
+            }
+            if (!fill) pixel = board.dma_read(src_row + (hflip ? width - 1 - col : col), 1);
+            if (key_en && pixel == (key & 0xff)) {
+                continue;
+            }
+            board.dma_write(dst_row + col, 1, pixel);
+        }
+        src_row += src_stride;
+        dst_row += dst_stride;
+    }
+}
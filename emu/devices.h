@@ -0,0 +1,167 @@
+// 板上外设的功能模型，寄存器布局和行为与 thinpad_top.sv 中的模块相同，但没有总线
+// 时序：读写立即完成，blitter 的搬运在启动时一次做完。
+//
+// read 返回总线上的整个字（wb_dat_o），字节在原来的位置上，由 Board 按地址取出；
+// write 的数据在低位（wb_dat_i），与 MMU 送出的相同。offset 为设备内的地址。
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+// 16550 兼容的串口（lab5/uart_controller.sv），发送的字节立即写到标准输出，
+// 标准输入的字节在接收 FIFO 有空位时立即进入，与 UART_BYPASS 相同
+class Uart {
+public:
+    uint32_t read(uint32_t offset, uint64_t now);
+    void write(uint32_t offset, uint32_t data, uint64_t now);
+
+    // 从主机收到的字节，接收 FIFO 满时在这里等待
+    void receive(const uint8_t *data, size_t n, uint64_t now);
+    bool irq(uint64_t now) const;
+
+private:
+    uint32_t iir_id(uint64_t now) const;
+    void refill(uint64_t now);
+    uint64_t timeout_cycles() const;
+
+    static const size_t FIFO_DEPTH = 16;
+    std::deque<uint8_t> host, rx;
+    uint64_t last_activity = 0;
+    bool overrun = false;
+    bool thre_pending = false;
+
+    // 复位值与 20M 时钟、115200 波特率对应
+    uint8_t dll = 21, dlm = 0, dld = 11;
+    uint8_t ier = 0, rx_trigger = 0, lcr = 0x03, mcr = 0, scr = 0;
+};
+
+// csr_mtime：mtime 每个周期加 1，mtime >= mtimecmp 时产生 M 态时钟中断
+class Clint {
+public:
+    uint32_t read(uint32_t addr, uint64_t now) const;
+    void write(uint32_t addr, uint32_t data, uint64_t now);
+
+    uint64_t mtime(uint64_t now) const { return now + offset; }
+    bool irq(uint64_t now) const { return mtime(now) >= mtimecmp; }
+    // mtip 下一次变为 1 的周期，已经为 1 时返回 now
+    uint64_t next_irq(uint64_t now) const;
+
+private:
+    uint64_t offset = 0;
+    uint64_t mtimecmp = 0;
+};
+
+// units/plic.sv：7 个中断源，上下文 0 接 mip.MEIP，上下文 1 接 mip.SEIP
+class Plic {
+public:
+    static const int NUM_SOURCES = 7;
+
+    uint32_t read(uint32_t offset);
+    void write(uint32_t offset, uint32_t data);
+
+    // 电平中断源的当前电平（bit i - 1 为中断源 i）
+    void set_levels(uint32_t levels);
+    // 边沿中断源的一次脉冲
+    void pulse(int id);
+
+    bool meip() const { return best(0) != 0; }
+    bool seip() const { return best(1) != 0; }
+
+private:
+    int best(int ctx) const;
+    void update();
+
+    // 与 thinpad_top 中的 EDGE_TRIGGERED 相同，只有 4 号（blitter 完成）是边沿触发
+    static const uint32_t EDGE_TRIGGERED = 0x08;
+
+    uint32_t levels = 0;
+    uint32_t pending = 0, in_flight = 0, edge_seen = 0;
+    uint32_t priority[NUM_SOURCES + 1] = {};
+    uint32_t enable[2] = {};
+    uint32_t threshold[2] = {};
+};
+
+// external/gpio_controller.sv。输入的变化立即生效，不经过消抖，边沿和事件 FIFO 与 RTL 相同
+class Gpio {
+public:
+    uint32_t read(uint32_t offset);
+    void write(uint32_t offset, uint32_t data);
+
+    // 拨码开关和按键（bit0 push_btn，[4:1] touch_btn）的新电平
+    void set_inputs(uint32_t dip_sw, uint32_t buttons, uint32_t mtime);
+    bool irq() const { return !events.empty(); }
+
+    uint32_t dip_sw = 0, buttons = 0;
+
+private:
+    struct Event {
+        uint32_t time;
+        uint32_t data;  // [5:0] 输入编号，bit8 上升沿
+    };
+    static const size_t EVT_DEPTH = 16;
+
+    uint32_t debounce = 200000;
+    uint32_t sw_edge = 0, btn_rise = 0, btn_fall = 0;
+    uint32_t evt_en = 0x1f1f;
+    bool evt_overflow = false;
+    std::deque<Event> events;
+};
+
+// external/vga_selector.sv 和两块显存。显存在板上只连了写口，CPU 读出 0
+class Vga {
+public:
+    static const int HSIZE = 800, VSIZE = 600;
+    // 800x600@75Hz 每帧 1040x666 个 50MHz 的像素周期，换算成 20MHz 的系统周期
+    static const uint64_t FRAME_CYCLES = 1040 * 666 * 2 / 5;
+    static const uint32_t BRAM_SIZE = 128 << 10;
+
+    Vga();
+
+    uint32_t read(uint32_t offset) const;
+    void write(uint32_t offset, uint32_t data);
+    void bram_write(int index, uint32_t offset, int size, uint32_t data);
+
+    // 场消隐：置位 VBLANK，挂起的交换在这时生效
+    void vblank();
+    bool irq() const { return vblank_flag && vblank_irq_en; }
+    // 后台缓冲区，供 blitter 使用
+    int back_sele() const { return ~bram_sele_reg & 1; }
+
+    // 按当前生效的设置渲染一帧 RGB332 像素，ext_ram 为 ExtRAM 的内容（4MB）
+    void render(const uint8_t *ext_ram, std::vector<uint8_t> &pixels) const;
+
+private:
+    std::vector<uint8_t> bram[2];
+
+    uint32_t vga_scale_reg = 1, bram_sele_reg = 1;
+    uint32_t fb_ctrl_reg = 0, fb_base_reg = 0;
+    bool flip_pending = false, vblank_flag = false, vblank_irq_en = false;
+
+    // 场消隐时从寄存器同步过来的、正在显示的设置
+    int sele_sync = 1;
+    uint32_t vga_scale_sync = 1;
+    bool fb_enable_sync = false;
+    uint32_t fb_base_sync = 0;
+};
+
+// external/blitter.sv 的寄存器，搬运通过 Board 的总线读写完成
+class Board;
+
+class Blitter {
+public:
+    explicit Blitter(Board &board) : board(board) {}
+
+    uint32_t read(uint32_t offset) const;
+    // 返回 true 表示完成了一次搬运（对应 done_o 的脉冲）
+    bool write(uint32_t offset, uint32_t data, int back_sele);
+
+private:
+    void run(int back_sele);
+
+    Board &board;
+    uint32_t ctrl = 0, src_addr = 0, src_stride = 0, dst_addr = 0, dst_stride = 0;
+    uint32_t size = 0, key = 0, color = 0;
+    bool error = false;
+};
@@ -0,0 +1,158 @@
+// thinpad_top 的功能模拟器：不模拟时序，在工作站上以每秒数千万条指令的速度运行
+// 监控程序、uCore 和 FlappyBird 等软件。串口接到终端，画面输出为 PPM 文件。用法见 README 或 --help。
+
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <getopt.h>
+#include <poll.h>
+#include <string>
+#include <termios.h>
+#include <unistd.h>
+
+#include "board.h"
+
+static volatile sig_atomic_t interrupted = 0;
+static struct termios saved_termios;
+static bool termios_saved = false;
+
+static void on_sigint(int) { interrupted = 1; }
+
+static void restore_terminal() {
+    if (termios_saved) {
+        tcsetattr(STDIN_FILENO, TCSANOW, &saved_termios);
+    }
+}
+
+// 终端按字符输入、不回显，Ctrl-C 仍然产生 SIGINT
+static void setup_terminal() {
+    if (!isatty(STDIN_FILENO) || tcgetattr(STDIN_FILENO, &saved_termios) != 0) {
+        return;
+    }
+    termios_saved = true;
+    atexit(restore_terminal);
+    struct termios raw = saved_termios;
+    raw.c_lflag &= ~(ICANON | ECHO);
+    raw.c_iflag &= ~ICRNL;
+    raw.c_cc[VMIN] = 0;
+    raw.c_cc[VTIME] = 0;
+    tcsetattr(STDIN_FILENO, TCSANOW, &raw);
+}
+
+// 把终端输入交给串口，输入结束后不再检查
+static void poll_stdin(Board &board, bool &input_closed) {
+    struct pollfd pfd = {STDIN_FILENO, POLLIN, 0};
+    while (!input_closed && poll(&pfd, 1, 0) > 0) {
+        uint8_t buf[64];
+        ssize_t n = read(STDIN_FILENO, buf, sizeof(buf));
+        if (n <= 0) {
+            input_closed = true;
+            break;
+        }
+        board.uart_receive(buf, n);
+    }
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "  -b, --base FILE         load FILE into BaseRAM (e.g. main.bin)\n"
+            "  -e, --ext FILE          load FILE into ExtRAM (e.g. eram.bin)\n"
+            "  -f, --flash FILE        load FILE into flash (e.g. kernel.elf)\n"
+            "      --bootrom FILE      boot ROM contents (default bootrom.mem)\n"
+            "  -d, --dip VALUE         DIP switches (default 0x2, as in tb.sv)\n"
+            "  -k, --key CYCLE:VALUE   set the buttons to VALUE at CYCLE\n"
+            "                          (bit0 push_btn, bits 4:1 touch_btn), may be repeated\n"
+            "  -c, --max-cycles N      stop after N cycles (default: run until Ctrl-C)\n"
+            "  -F, --frames PATTERN    write frames as PPM, e.g. /tmp/frame%%05d.ppm\n"
+            "      --frame-interval N  write one frame out of every N (default 1)\n"
+            "      --screenshot FILE   write the last frame as PPM when the run stops\n"
+            "  -h, --help              show this message\n",
+            prog);
+}
+
+int main(int argc, char **argv) {
+    std::string bootrom_file = "bootrom.mem", screenshot_file;
+    uint64_t max_cycles = 0;
+    Board board;
+    board.set_dip_sw(0x2);
+
+    static const struct option long_opts[] = {
+        {"base", required_argument, nullptr, 'b'},
+        {"ext", required_argument, nullptr, 'e'},
+        {"flash", required_argument, nullptr, 'f'},
+        {"bootrom", required_argument, nullptr, 'R'},
+        {"dip", required_argument, nullptr, 'd'},
+        {"key", required_argument, nullptr, 'k'},
+        {"max-cycles", required_argument, nullptr, 'c'},
+        {"frames", required_argument, nullptr, 'F'},
+        {"frame-interval", required_argument, nullptr, 'I'},
+        {"screenshot", required_argument, nullptr, 'P'},
+        {"help", no_argument, nullptr, 'h'},
+        {nullptr, 0, nullptr, 0},
+    };
+    std::string frame_pattern;
+    int frame_interval = 1;
+    int opt;
+    while ((opt = getopt_long(argc, argv, "b:e:f:d:k:c:F:h", long_opts, nullptr)) != -1) {
+        switch (opt) {
+        case 'b':
+            if (!board.load("base", optarg)) return 1;
+            break;
+        case 'e':
+            if (!board.load("ext", optarg)) return 1;
+            break;
+        case 'f':
+            if (!board.load("flash", optarg)) return 1;
+            break;
+        case 'R': bootrom_file = optarg; break;
+        case 'd': board.set_dip_sw(strtoul(optarg, nullptr, 0)); break;
+        case 'k': {
+            char *sep;
+            uint64_t cycle = strtoull(optarg, &sep, 0);
+            if (*sep != ':') {
+                fprintf(stderr, "Bad key event %s, expected CYCLE:VALUE\n", optarg);
+                return 1;
+            }
+            board.add_key_event(cycle, strtoul(sep + 1, nullptr, 0));
+            break;
+        }
+        case 'c': max_cycles = strtoull(optarg, nullptr, 0); break;
+        case 'F': frame_pattern = optarg; break;
+        case 'I': frame_interval = atoi(optarg); break;
+        case 'P': screenshot_file = optarg; break;
+        case 'h': usage(argv[0]); return 0;
+        default: usage(argv[0]); return 1;
+        }
+    }
+    if (!board.load("bootrom", bootrom_file)) {
+        return 1;
+    }
+    if (!frame_pattern.empty()) {
+        board.set_frame_output(frame_pattern, frame_interval);
+    }
+
+    setup_terminal();
+    signal(SIGINT, on_sigint);
+
+    auto wall_start = std::chrono::steady_clock::now();
+    const uint64_t until = max_cycles ? max_cycles : UINT64_MAX;
+    bool input_closed = false;
+    while (!interrupted && board.cycles() < until) {
+        poll_stdin(board, input_closed);
+        board.run(std::min(until, board.cycles() + 64 * Board::SLICE_CYCLES), interrupted);
+    }
+
+    if (!screenshot_file.empty()) {
+        board.write_frame(screenshot_file);
+    }
+
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+    uint64_t run = board.instructions();
+    fprintf(stderr, "\n%llu instructions, %llu cycles, %llu frames in %.2f s (%.1f MIPS)\n",
+            (unsigned long long)run, (unsigned long long)board.cycles(),
+            (unsigned long long)board.frames(), secs, secs > 0 ? run / secs / 1e6 : 0.0);
+    return 0;
+}
@@ -70,8 +70,12 @@ int main()
      ********************** 准备区 **********************
      */
 
+    // 外设寄存器的指针都加上 volatile，否则编译器会把轮询循环中的读取提到循环外，
+    // 或者合并连续的写入
     // flappy bird 相关的游戏素材都从 0x300000 地址开始存储
-    int *buttons = (int *)0x85000004;
+    volatile int *buttons = (volatile int *)0x85000004;
+    // 消抖后的按键边沿，bit0 为 push_btn 的上升沿
+    volatile int *button_edge = (volatile int *)0x85000010;
     char *flash = (char *)0x83300000;
 
     // 渲染时的 bram 写入指针
@@ -80,17 +84,19 @@ int main()
     // 定义当前渲染 vga 读取的 Block ram 片区
     // 0 -> bram_0  1 -> bram_1
     int sele = 0;
-    int *bram_sele = (int *)0x86000004;
+    volatile int *bram_sele = (volatile int *)0x86000004;
+    // 交换请求在场消隐时才生效，bit0 为 1 表示尚未交换
+    volatile int *vga_status = (volatile int *)0x86000008;
 
-    // 先全部渲染为蓝色
-    bram_tmp = (char *)0x84000000;
-    while (bram_tmp < (char *)0x84000000 + 120000)
-        *(bram_tmp++) = 0x57;
+    // 先全部渲染为蓝色，显存支持按字写入，一次写 4 个像素
+    int *bram_word = (int *)0x84000000;
+    while (bram_word < (int *)(0x84000000 + 120000))
+        *(bram_word++) = 0x57575757;
 
     *bram_sele = 1;
 
     // 定义当前渲染的分辨率为 200*150
-    int *vga_scale = (int *)0x86000000;
+    volatile int *vga_scale = (volatile int *)0x86000000;
     *vga_scale = 2;
 
     // 定义渲染部分图片时所需要的相对行列位置
@@ -104,9 +110,10 @@ int main()
     bram_tmp = (char *)0x81000000;
     // 1. 渲染蓝色背景
     int i = 0;
-    while (i != 30000)
+    bram_word = (int *)0x81000000;
+    while (i != 30000 / 4)
     {
-        *(bram_tmp + i) = 0x57;
+        *(bram_word + i) = 0x57575757;
         i = i + 1;
     }
     i = 0;
@@ -203,15 +210,16 @@ int main()
             now_button = 1;
             cnt = cnt + 1;
             *bram_sele = 0;
+            while (*vga_status & 1)
+                ;
             *vga_scale = 2;
-            bram_tmp = (char *)0x84000000;
-
             // 开始写游戏开始画面的缓冲区
-            // 1. 渲染蓝色背景
+            // 1. 渲染蓝色背景，按字写入，一次写 4 个像素
             i = 0;
-            while (i != 30000)
+            bram_word = (int *)0x84000000;
+            while (i != 30000 / 4)
             {
-                *(bram_tmp + i) = 0x57;
+                *(bram_word + i) = 0x57575757;
                 i = i + 1;
             }
             i = 0;
@@ -293,6 +301,8 @@ int main()
     sele = 1 - cnt % 2;
     // 给出交换信号之后，可能要等到同步信号真正来临之后才会交换，所以要等待一段时间
     *bram_sele = sele;
+    while (*vga_status & 1)
+        ;
     while (1)
     {
 
@@ -300,17 +310,26 @@ int main()
         // (82, 50) -> (118, 85)
         bram_tmp = sele == 1 ? (char *)0x81002762 : (char *)0x84002762;
         i = 0;
-        while (i != 1260)
+        // 逐行清除，行首逐字节写到字对齐，中间一次写 4 个像素，行尾剩下的再逐字节写
+        while (row != 35)
         {
-            *(bram_tmp + row * 200 + col) = 0x57;
-            i = i + 1;
-            col = col + 1;
-
-            if (col == 36)
+            col = 0;
+            while (((int)(bram_tmp + row * 200 + col) & 3) != 0 && col != 36)
             {
-                row = row + 1;
-                col = 0;
+                *(bram_tmp + row * 200 + col) = 0x57;
+                col = col + 1;
+            }
+            while (col + 4 <= 36)
+            {
+                *(int *)(bram_tmp + row * 200 + col) = 0x57575757;
+                col = col + 4;
+            }
+            while (col != 36)
+            {
+                *(bram_tmp + row * 200 + col) = 0x57;
+                col = col + 1;
             }
+            row = row + 1;
         }
         i = 0;
         row = 0;
@@ -340,17 +359,26 @@ int main()
             {
                 bram_tmp = sele == 1 ? (char *)0x810007ee : (char *)0x840007ee;
             }
-            while (i != 1400 * (pilot_count % 4 + 1))
+            // 逐行清除，行首逐字节写到字对齐，中间一次写 4 个像素，行尾剩下的再逐字节写
+            while (row != 10 * (pilot_count % 4 + 1))
             {
-                *(bram_tmp + row * 200 + col) = 0x57;
-                i = i + 1;
-                col = col + 1;
-
-                if (col == 140)
+                col = 0;
+                while (((int)(bram_tmp + row * 200 + col) & 3) != 0 && col != 140)
                 {
-                    row = row + 1;
-                    col = 0;
+                    *(bram_tmp + row * 200 + col) = 0x57;
+                    col = col + 1;
+                }
+                while (col + 4 <= 140)
+                {
+                    *(int *)(bram_tmp + row * 200 + col) = 0x57575757;
+                    col = col + 4;
+                }
+                while (col != 140)
+                {
+                    *(bram_tmp + row * 200 + col) = 0x57;
+                    col = col + 1;
                 }
+                row = row + 1;
             }
             i = 0;
             row = 0;
@@ -429,6 +457,8 @@ int main()
         cnt = cnt + 1;
         sele = 1 - cnt % 2;
         *bram_sele = sele;
+        while (*vga_status & 1)
+            ;
 
         frame = 0;
         while (frame != 40000)
@@ -498,19 +528,18 @@ int main()
     // 判断游戏退出的变量
     int lose_flag = 0;
 
+    // 清除开始页面留下的按键边沿
+    *button_edge = 0x00000001;
+
     while (1)
     {
-        // 检测 push button
-        push = (*buttons) & 0x00000001;
-        if (push == 1 && now_button == 0)
+        // 检测 push button 的上升沿，gpio_controller 会锁存两次检测之间的按下，写 1 清除
+        push = (*button_edge) & 0x00000001;
+        if (push == 1)
         {
+            *button_edge = 0x00000001;
             jump_bank = 1;
             button_count = button_count + 1;
-            now_button = 1;
-        }
-        else if (push == 0 && now_button == 1)
-        {
-            now_button = 0;
         }
 
         // 渲染画面
@@ -519,17 +548,26 @@ int main()
         // 先从记录的位置清除缓存区上次的小鸟
         bram_tmp = sele == 1 ? (char *)0x81000000 : (char *)0x84000000;
         bram_tmp = bram_tmp + (sele == 1 ? bird_position_0 : bird_position_1);
-        while (i != 900)
+        // 逐行清除，行首逐字节写到字对齐，中间一次写 4 个像素，行尾剩下的再逐字节写
+        while (row != 25)
         {
-            *(bram_tmp + row * 200 + col) = 0x57;
-            i = i + 1;
-            col = col + 1;
-
-            if (col == 36)
+            col = 0;
+            while (((int)(bram_tmp + row * 200 + col) & 3) != 0 && col != 36)
             {
-                row = row + 1;
-                col = 0;
+                *(bram_tmp + row * 200 + col) = 0x57;
+                col = col + 1;
+            }
+            while (col + 4 <= 36)
+            {
+                *(int *)(bram_tmp + row * 200 + col) = 0x57575757;
+                col = col + 4;
             }
+            while (col != 36)
+            {
+                *(bram_tmp + row * 200 + col) = 0x57;
+                col = col + 1;
+            }
+            row = row + 1;
         }
         i = 0;
         row = 0;
@@ -640,17 +678,26 @@ int main()
         // 先从记录的位置清除缓存区上次的管道
         bram_tmp = sele == 1 ? (char *)0x81000000 : (char *)0x84000000;
         bram_tmp = bram_tmp + (sele == 1 ? up_pipe_position_0 : up_pipe_position_1);
-        while (i != 50 * up_pipe_height)
+        // 逐行清除，行首逐字节写到字对齐，中间一次写 4 个像素，行尾剩下的再逐字节写
+        while (row != up_pipe_height)
         {
-            *(bram_tmp + row * 200 + col) = 0x57;
-            i = i + 1;
-            col = col + 1;
-
-            if (col == 50)
+            col = 0;
+            while (((int)(bram_tmp + row * 200 + col) & 3) != 0 && col != 50)
             {
-                row = row + 1;
-                col = 0;
+                *(bram_tmp + row * 200 + col) = 0x57;
+                col = col + 1;
+            }
+            while (col + 4 <= 50)
+            {
+                *(int *)(bram_tmp + row * 200 + col) = 0x57575757;
+                col = col + 4;
+            }
+            while (col != 50)
+            {
+                *(bram_tmp + row * 200 + col) = 0x57;
+                col = col + 1;
             }
+            row = row + 1;
         }
         i = 0;
         row = 0;
@@ -658,17 +705,26 @@ int main()
 
         bram_tmp = sele == 1 ? (char *)0x81000000 : (char *)0x84000000;
         bram_tmp = bram_tmp + (sele == 1 ? down_pipe_position_0 : down_pipe_position_1);
-        while (i != 50 * (69 - up_pipe_height) + 50)
+        // 逐行清除，行首逐字节写到字对齐，中间一次写 4 个像素，行尾剩下的再逐字节写
+        while (row != 70 - up_pipe_height)
         {
-            *(bram_tmp + row * 200 + col) = 0x57;
-            i = i + 1;
-            col = col + 1;
-
-            if (col == 50)
+            col = 0;
+            while (((int)(bram_tmp + row * 200 + col) & 3) != 0 && col != 50)
             {
-                row = row + 1;
-                col = 0;
+                *(bram_tmp + row * 200 + col) = 0x57;
+                col = col + 1;
+            }
+            while (col + 4 <= 50)
+            {
+                *(int *)(bram_tmp + row * 200 + col) = 0x57575757;
+                col = col + 4;
+            }
+            while (col != 50)
+            {
+                *(bram_tmp + row * 200 + col) = 0x57;
+                col = col + 1;
             }
+            row = row + 1;
         }
         i = 0;
         row = 0;
@@ -802,17 +858,26 @@ int main()
         if (pipe_status == 1)
         {
             bram_tmp = sele == 1 ? (char *)0x81000000 : (char *)0x84000000;
-            while (i != 50 * 125)
+            // 逐行清除，行首逐字节写到字对齐，中间一次写 4 个像素，行尾剩下的再逐字节写
+            while (row != 125)
             {
-                *(bram_tmp + row * 200 + col) = 0x57;
-                i = i + 1;
-                col = col + 1;
-
-                if (col == 50)
+                col = 0;
+                while (((int)(bram_tmp + row * 200 + col) & 3) != 0 && col != 50)
                 {
-                    row = row + 1;
-                    col = 0;
+                    *(bram_tmp + row * 200 + col) = 0x57;
+                    col = col + 1;
+                }
+                while (col + 4 <= 50)
+                {
+                    *(int *)(bram_tmp + row * 200 + col) = 0x57575757;
+                    col = col + 4;
+                }
+                while (col != 50)
+                {
+                    *(bram_tmp + row * 200 + col) = 0x57;
+                    col = col + 1;
                 }
+                row = row + 1;
             }
             i = 0;
             row = 0;
@@ -823,17 +888,26 @@ int main()
         {
             bram_tmp = sele == 1 ? (char *)0x81000000 : (char *)0x84000000;
             bram_tmp = bram_tmp + 150;
-            while (i != 50 * 125)
+            // 逐行清除，行首逐字节写到字对齐，中间一次写 4 个像素，行尾剩下的再逐字节写
+            while (row != 125)
             {
-                *(bram_tmp + row * 200 + col) = 0x57;
-                i = i + 1;
-                col = col + 1;
-
-                if (col == 50)
+                col = 0;
+                while (((int)(bram_tmp + row * 200 + col) & 3) != 0 && col != 50)
                 {
-                    row = row + 1;
-                    col = 0;
+                    *(bram_tmp + row * 200 + col) = 0x57;
+                    col = col + 1;
+                }
+                while (col + 4 <= 50)
+                {
+                    *(int *)(bram_tmp + row * 200 + col) = 0x57575757;
+                    col = col + 4;
                 }
+                while (col != 50)
+                {
+                    *(bram_tmp + row * 200 + col) = 0x57;
+                    col = col + 1;
+                }
+                row = row + 1;
             }
             i = 0;
             row = 0;
@@ -877,6 +951,8 @@ int main()
         }
         sele = 1 - sele;
         *bram_sele = sele;
+        while (*vga_status & 1)
+            ;
 
         frame = 0;
         while (frame != 5000)
@@ -1,1085 +1,1548 @@
-	.file	"flappybird.c"
-	.option nopic
-	.attribute arch, "rv32i2p0"
-	.attribute unaligned_access, 0
-	.attribute stack_align, 16
 	.text
-	.align	2
-	.globl	main
-	.type	main, @function
-main:
-	addi	sp,sp,-48
-	sw	s0,44(sp)
-	sw	s1,40(sp)
-	sw	s2,36(sp)
-	sw	s3,32(sp)
-	sw	s4,28(sp)
-	sw	s5,24(sp)
-	sw	s6,20(sp)
-	sw	s7,16(sp)
-	sw	s8,12(sp)
-	sw	s9,8(sp)
-	li	a4,-2080374784
-	j	.L2
-.L3:
-	li	a5,87
-	sb	a5,0(a4)
-	addi	a4,a4,1
-.L2:
-	li	a5,-2080346112
-	addi	a5,a5,1327
-	bleu	a4,a5,.L3
-	li	a5,-2046820352
-	li	a4,1
-	sw	a4,4(a5)
-	li	a4,2
-	sw	a4,0(a5)
-	li	a4,0
-.L4:
-	li	a5,28672
-	addi	a5,a5,1328
-	beq	a4,a5,.L170
-	li	a5,-2130706432
-	add	a5,a5,a4
-	li	a3,87
-	sb	a3,0(a5)
-	addi	a4,a4,1
-	j	.L4
-.L170:
-	li	a2,0
-	li	a3,0
-	li	a0,0
-.L6:
-	li	a5,4096
-	addi	a5,a5,1504
-	beq	a2,a5,.L171
-	li	a1,-2094006272
-	add	a1,a1,a2
-	slli	a5,a0,1
-	add	a5,a5,a0
-	slli	a4,a5,3
-	add	a4,a4,a0
-	slli	a5,a4,3
-	add	a5,a3,a5
-	li	a4,-2130706432
-	addi	a4,a4,2030
-	add	a5,a5,a4
-	lbu	a4,0(a1)
-	sb	a4,0(a5)
-	addi	a2,a2,1
-	addi	a3,a3,1
-	li	a5,140
-	bne	a3,a5,.L6
-	addi	a0,a0,1
-	li	a3,0
-	j	.L6
-.L171:
-	li	a1,0
-	li	a2,0
-	li	a0,0
-.L9:
-	li	a5,4096
-	addi	a5,a5,904
-	beq	a1,a5,.L172
-	li	a4,-2094002176
-	addi	a4,a4,1504
-	add	a4,a1,a4
-	slli	a5,a0,1
-	add	a5,a5,a0
-	slli	a3,a5,3
-	add	a3,a3,a0
-	slli	a5,a3,3
-	add	a5,a2,a5
-	li	a3,-2130681856
-	addi	a3,a3,424
-	add	a5,a5,a3
-	lbu	a4,0(a4)
-	sb	a4,0(a5)
-	addi	a1,a1,1
-	addi	a2,a2,1
-	li	a5,200
-	bne	a2,a5,.L9
-	addi	a0,a0,1
-	li	a2,0
-	j	.L9
-.L172:
-	li	a1,0
-	li	a2,0
-	li	a0,0
-.L12:
-	li	a5,900
-	beq	a1,a5,.L15
-	li	a4,-2093993984
-	addi	a4,a4,-1688
-	add	a4,a1,a4
-	slli	a5,a0,1
-	add	a5,a5,a0
-	slli	a3,a5,3
-	add	a3,a3,a0
-	slli	a5,a3,3
-	add	a5,a2,a5
-	li	a3,-2130694144
-	addi	a3,a3,-1206
-	add	a5,a5,a3
-	lbu	a4,0(a4)
-	sb	a4,0(a5)
-	addi	a1,a1,1
-	addi	a2,a2,1
-	li	a5,36
-	bne	a2,a5,.L12
-	addi	a0,a0,1
-	li	a2,0
-	j	.L12
-.L15:
-	li	a5,-2063597568
-	lw	a0,4(a5)
-	andi	a0,a0,1
-	beq	a0,zero,.L15
-	li	a5,-2046820352
-	sw	zero,4(a5)
-	li	a4,2
-	sw	a4,0(a5)
-	li	a4,0
-	j	.L16
-.L17:
-	li	a5,-2080374784
-	add	a5,a5,a4
-	li	a3,87
-	sb	a3,0(a5)
-	addi	a4,a4,1
-.L16:
-	li	a5,28672
-	addi	a5,a5,1328
-	bne	a4,a5,.L17
-	li	a2,0
-	li	a3,0
-	li	a6,0
-.L18:
-	li	a5,4096
-	addi	a5,a5,1504
-	beq	a2,a5,.L173
-	li	a1,-2094006272
-	add	a1,a1,a2
-	slli	a5,a6,1
-	add	a5,a5,a6
-	slli	a4,a5,3
-	add	a4,a4,a6
-	slli	a5,a4,3
-	add	a5,a3,a5
-	li	a4,-2080374784
-	addi	a4,a4,2030
-	add	a5,a5,a4
-	lbu	a4,0(a1)
-	sb	a4,0(a5)
-	addi	a2,a2,1
-	addi	a3,a3,1
-	li	a5,140
-	bne	a3,a5,.L18
-	addi	a6,a6,1
-	li	a3,0
-	j	.L18
-.L173:
-	li	a1,0
-	li	a2,0
-	li	a6,0
-.L21:
-	li	a5,4096
-	addi	a5,a5,904
-	beq	a1,a5,.L174
-	li	a4,-2094002176
-	addi	a4,a4,1504
-	add	a4,a1,a4
-	slli	a5,a6,1
-	add	a5,a5,a6
-	slli	a3,a5,3
-	add	a3,a3,a6
-	slli	a5,a3,3
-	add	a5,a2,a5
-	li	a3,-2080350208
-	addi	a3,a3,424
-	add	a5,a5,a3
-	lbu	a4,0(a4)
-	sb	a4,0(a5)
-	addi	a1,a1,1
-	addi	a2,a2,1
-	li	a5,200
-	bne	a2,a5,.L21
-	addi	a6,a6,1
-	li	a2,0
-	j	.L21
-.L174:
-	li	a1,0
-	li	a2,0
-	li	a6,0
-.L24:
-	li	a5,900
-	beq	a1,a5,.L175
-	li	a4,-2093993984
-	addi	a4,a4,-788
-	add	a4,a1,a4
-	slli	a5,a6,1
-	add	a5,a5,a6
-	slli	a3,a5,3
-	add	a3,a3,a6
-	slli	a5,a3,3
-	add	a5,a2,a5
-	li	a3,-2080362496
-	addi	a3,a3,-606
-	add	a5,a5,a3
-	lbu	a4,0(a4)
-	sb	a4,0(a5)
-	addi	a1,a1,1
-	addi	a2,a2,1
-	li	a5,36
-	bne	a2,a5,.L24
-	addi	a6,a6,1
-	li	a2,0
-	j	.L24
-.L175:
-	li	a4,0
-.L27:
-	li	a5,49152
-	addi	a5,a5,848
-	beq	a4,a5,.L176
-	addi	a4,a4,1
-	j	.L27
-.L176:
-	li	a5,-2046820352
-	sw	zero,4(a5)
-	mv	a7,a0
-	li	a1,0
-	li	a6,0
-	li	t4,0
-	li	t3,0
-	li	t5,0
-	li	a3,0
-	j	.L59
-.L195:
-	li	t0,-2130698240
-	addi	t0,t0,1890
-	j	.L29
-.L196:
-	li	a5,1
-	beq	t3,a5,.L177
-.L33:
-	srai	a5,a7,31
-	srli	a4,a5,30
-	add	a5,a7,a4
-	andi	a5,a5,3
-	sub	a5,a5,a4
-	li	a4,1
-	beq	a5,a4,.L44
-	li	a4,3
-	beq	a5,a4,.L44
-	li	a4,2
-	beq	a5,a4,.L178
-	li	a5,1
-	beq	a3,a5,.L179
-	li	t2,-2080362496
-	addi	t2,t2,-606
-.L51:
-	li	a5,1
-	beq	a3,a5,.L180
-	li	t1,58
-	li	a1,12288
-	addi	a1,a1,-606
-	li	s0,-2093993984
-	addi	s0,s0,-788
-	j	.L48
-.L177:
-	li	a5,3
-	ble	t4,a5,.L34
-	li	a5,1
-	beq	a3,a5,.L35
-	li	t0,-2080374784
-	addi	t0,t0,2030
-.L36:
-	li	t2,0
-	li	t1,0
-	li	t6,0
-.L42:
-	srai	a5,t4,31
-	srli	a4,a5,30
-	add	a5,t4,a4
-	andi	a5,a5,3
-	sub	a5,a5,a4
-	addi	a5,a5,1
-	slli	a4,a5,1
-	add	a4,a4,a5
-	slli	a2,a4,2
-	sub	a2,a2,a5
-	slli	a4,a2,4
-	sub	a5,a4,a5
-	slli	a4,a5,3
-	beq	a4,t2,.L181
-	slli	a5,t6,1
-	add	a5,a5,t6
-	slli	a4,a5,3
-	add	a4,a4,t6
-	slli	a5,a4,3
-	add	a5,t1,a5
-	add	a5,t0,a5
-	li	a4,87
-	sb	a4,0(a5)
-	addi	t2,t2,1
-	addi	t1,t1,1
-	li	a5,140
-	bne	t1,a5,.L42
-	addi	t6,t6,1
-	li	t1,0
-	j	.L42
-.L34:
-	andi	a5,t4,3
-	bne	a5,zero,.L37
-	li	a5,1
-	beq	a3,a5,.L182
-	li	t0,-2080366592
-	addi	t0,t0,-162
-	j	.L36
-.L182:
-	li	t0,-2130698240
-	addi	t0,t0,-162
-	j	.L36
-.L37:
-	li	a5,-2147483648
-	addi	a5,a5,3
-	and	a5,t4,a5
-	blt	a5,zero,.L183
-.L38:
-	li	a4,1
-	beq	a5,a4,.L184
-	li	a4,2
-	beq	a5,a4,.L185
-	li	a5,1
-	beq	a3,a5,.L186
-	li	t0,-2080374784
-	addi	t0,t0,2030
-	j	.L36
-.L183:
-	addi	a5,a5,-1
-	ori	a5,a5,-4
-	addi	a5,a5,1
-	j	.L38
-.L184:
-	li	a5,1
-	beq	a3,a5,.L187
-	li	t0,-2080370688
-	addi	t0,t0,1934
-	j	.L36
-.L187:
-	li	t0,-2130702336
-	addi	t0,t0,1934
-	j	.L36
-.L185:
-	li	a5,1
-	beq	a3,a5,.L188
-	li	t0,-2080370688
-	addi	t0,t0,-66
-	j	.L36
-.L188:
-	li	t0,-2130702336
-	addi	t0,t0,-66
-	j	.L36
-.L186:
-	li	t0,-2130706432
-	addi	t0,t0,2030
-	j	.L36
-.L35:
-	li	t0,-2130706432
-	addi	t0,t0,2030
-	j	.L36
-.L181:
-	addi	t4,t4,1
-	j	.L33
-.L44:
-	li	a5,1
-	beq	a3,a5,.L189
-	li	t2,-2080362496
-	addi	t2,t2,-1206
-.L46:
-	li	a5,1
-	beq	a3,a5,.L47
-	li	t1,55
-	li	a1,12288
-	addi	a1,a1,-1206
-	li	s0,-2093993984
-	addi	s0,s0,-1688
-.L48:
-	li	a2,0
-	li	a3,0
-	li	t6,0
-.L53:
-	li	a5,900
-	beq	a2,a5,.L190
-	add	t0,s0,a2
-	slli	a5,t6,1
-	add	a5,a5,t6
-	slli	a4,a5,3
-	add	a4,a4,t6
-	slli	a5,a4,3
-	add	a5,a3,a5
-	add	a5,t2,a5
-	lbu	a4,0(t0)
-	sb	a4,0(a5)
-	addi	a2,a2,1
-	addi	a3,a3,1
-	li	a5,36
-	bne	a3,a5,.L53
-	addi	t6,t6,1
-	li	a3,0
-	j	.L53
-.L189:
-	li	t2,-2130694144
-	addi	t2,t2,-1206
-	j	.L46
-.L178:
-	li	a5,1
-	beq	a3,a5,.L191
-	li	t2,-2080362496
-	addi	t2,t2,-1806
-.L50:
-	li	a5,1
-	beq	a3,a5,.L192
-	li	t1,52
-	li	a1,12288
-	addi	a1,a1,-1806
-	li	s0,-2093993984
-	addi	s0,s0,112
-	j	.L48
-.L191:
-	li	t2,-2130694144
-	addi	t2,t2,-1806
-	j	.L50
-.L192:
-	li	t1,52
-	li	a6,12288
-	addi	a6,a6,-1806
-	li	s0,-2093993984
-	addi	s0,s0,112
-	j	.L48
-.L179:
-	li	t2,-2130694144
-	addi	t2,t2,-606
-	j	.L51
-.L180:
-	li	t1,58
-	li	a6,12288
-	addi	a6,a6,-606
-	li	s0,-2093993984
-	addi	s0,s0,-788
-	j	.L48
-.L47:
-	li	t1,55
-	li	a6,12288
-	addi	a6,a6,-1206
-	li	s0,-2093993984
-	addi	s0,s0,-1688
-	j	.L48
-.L190:
-	addi	a7,a7,1
-	srli	a3,a7,31
-	add	a5,a7,a3
-	andi	a5,a5,1
-	sub	a5,a5,a3
-	li	a3,1
-	sub	a3,a3,a5
-	li	a5,-2046820352
-	sw	a3,4(a5)
-	li	a4,0
-.L55:
-	li	a5,40960
-	addi	a5,a5,-960
-	beq	a4,a5,.L193
-	addi	a4,a4,1
-	j	.L55
-.L193:
-	li	a5,-2063597568
-	lw	a5,4(a5)
-	andi	a5,a5,1
-	beq	a5,zero,.L57
-	bne	t5,zero,.L57
-	addi	t3,t3,1
-	mv	t5,a5
-.L58:
-	li	a5,2
-	beq	t3,a5,.L194
-.L59:
-	li	a5,1
-	beq	a3,a5,.L195
-	li	t0,-2080366592
-	addi	t0,t0,1890
-.L29:
-	li	t6,0
-	li	a2,0
-	li	t1,0
-.L30:
-	li	a5,1260
-	beq	t6,a5,.L196
-	slli	a5,t1,1
-	add	a5,a5,t1
-	slli	a4,a5,3
-	add	a4,a4,t1
-	slli	a5,a4,3
-	add	a5,a2,a5
-	add	a5,t0,a5
-	li	a4,87
-	sb	a4,0(a5)
-	addi	t6,t6,1
-	addi	a2,a2,1
-	li	a5,36
-	bne	a2,a5,.L30
-	addi	t1,t1,1
-	li	a2,0
-	j	.L30
-.L57:
-	bne	a5,zero,.L58
-	beq	t5,zero,.L58
-	mv	t5,a5
-	j	.L58
-.L194:
-	li	t6,0
-	li	t2,0
-	li	t4,200
-	li	a7,0
-	li	t5,20480
-	addi	t5,t5,-1280
-	mv	s0,t5
-	li	t0,400
-	li	s1,400
-	li	a2,0
-	li	s2,0
-	j	.L134
-.L146:
-	mv	t2,a5
-	mv	s2,a5
-.L61:
-	li	a5,1
-	beq	a3,a5,.L197
-	li	a4,-2080374784
-.L62:
-	li	a5,1
-	beq	a3,a5,.L198
-	mv	s7,a1
-.L64:
-	li	s6,0
-	li	s4,0
-	li	s5,0
-.L65:
-	li	a5,900
-	beq	s6,a5,.L199
-	slli	a5,s5,1
-	add	a5,a5,s5
-	slli	s3,a5,3
-	add	s3,s3,s5
-	slli	a5,s3,3
-	add	a5,s4,a5
-	add	a5,a5,s7
-	add	a5,a4,a5
-	li	s3,87
-	sb	s3,0(a5)
-	addi	s6,s6,1
-	addi	s4,s4,1
-	li	a5,36
-	bne	s4,a5,.L65
-	addi	s5,s5,1
-	li	s4,0
-	j	.L65
-.L197:
-	li	a4,-2130706432
-	j	.L62
-.L198:
-	mv	s7,a6
-	j	.L64
-.L199:
-	ble	t2,zero,.L68
-	addi	t2,t2,-1
-	li	a5,1
-	beq	a3,a5,.L200
-	li	s8,-4096
-	addi	s8,s8,496
-	add	s8,a6,s8
-.L70:
-	add	s8,a4,s8
-	addi	t1,t1,-18
-	li	a5,1
-	beq	a3,a5,.L201
-	li	a1,-4096
-	addi	a1,a1,496
-	add	a1,a6,a1
-.L72:
-	srai	a5,a2,31
-	srli	s3,a5,30
-	add	a5,a2,s3
-	andi	a5,a5,3
-	sub	a5,a5,s3
-	li	s3,1
-	beq	a5,s3,.L149
-	li	s3,3
-	beq	a5,s3,.L150
-	li	s3,2
-	beq	a5,s3,.L202
-	li	s9,-2093993984
-	addi	s9,s9,-788
-	j	.L76
-.L200:
-	li	s8,-4096
-	addi	s8,s8,496
-	add	s8,a1,s8
-	j	.L70
-.L201:
-	li	a6,-4096
-	addi	a6,a6,496
-	add	a6,a1,a6
-	j	.L72
-.L68:
-	li	a5,1
-	beq	a3,a5,.L203
-	addi	s8,a6,600
-.L74:
-	add	s8,a4,s8
-	addi	t1,t1,3
-	li	a5,1
-	beq	a3,a5,.L204
-	addi	a1,a6,600
-	j	.L72
-.L203:
-	addi	s8,a1,600
-	j	.L74
-.L204:
-	addi	a6,a1,600
-	j	.L72
-.L202:
-	li	s9,-2093993984
-	addi	s9,s9,112
-	j	.L76
-.L149:
-	li	s9,-2093993984
-	addi	s9,s9,-1688
-.L76:
-	li	a5,1
-	beq	a3,a5,.L205
-.L77:
-	li	a5,1
-	beq	a3,a5,.L206
-.L79:
-	bne	a3,zero,.L80
-	li	a5,20480
-	addi	a5,a5,-398
-	bgt	a1,a5,.L154
-.L80:
-	bne	a3,zero,.L78
-	li	a5,681
-	bgt	a6,a5,.L78
-	mv	t6,a0
-	li	a1,682
-	li	s8,-2080374784
-	addi	s8,s8,682
-	j	.L78
-.L150:
-	li	s9,-2093993984
-	addi	s9,s9,-1688
-	j	.L76
-.L205:
-	li	a5,20480
-	addi	a5,a5,-398
-	ble	a6,a5,.L77
-	mv	t6,a3
-	li	a6,20480
-	addi	a6,a6,-398
-	li	s8,-2130685952
-	addi	s8,s8,-398
-	j	.L78
-.L206:
-	li	a5,681
-	bgt	a6,a5,.L79
-	mv	t6,a3
-	li	a6,682
-	li	s8,-2130706432
-	addi	s8,s8,682
-	j	.L78
-.L154:
-	mv	t6,a0
-	li	a1,20480
-	addi	a1,a1,-398
-	li	s8,-2080354304
-	addi	s8,s8,-398
-.L78:
-	li	s5,0
-	li	s4,0
-	li	s6,0
-.L82:
-	li	a5,900
-	beq	s5,a5,.L207
-	add	s7,s9,s5
-	slli	a5,s6,1
-	add	a5,a5,s6
-	slli	s3,a5,3
-	add	s3,s3,s6
-	slli	a5,s3,3
-	add	a5,s4,a5
-	add	a5,s8,a5
-	lbu	s3,0(s7)
-	sb	s3,0(a5)
-	addi	s5,s5,1
-	addi	s4,s4,1
-	li	a5,36
-	bne	s4,a5,.L82
-	addi	s6,s6,1
-	li	s4,0
-	j	.L82
-.L207:
-	li	a5,1
-	beq	a3,a5,.L208
-	mv	s7,t0
-.L85:
-	li	s6,0
-	li	s4,0
-	li	s5,0
-.L86:
-	li	a5,1950
-	beq	s6,a5,.L209
-	slli	a5,s5,1
-	add	a5,a5,s5
-	slli	s3,a5,3
-	add	s3,s3,s5
-	slli	a5,s3,3
-	add	a5,s4,a5
-	add	a5,a5,s7
-	add	a5,a4,a5
-	li	s3,87
-	sb	s3,0(a5)
-	addi	s6,s6,1
-	addi	s4,s4,1
-	li	a5,50
-	bne	s4,a5,.L86
-	addi	s5,s5,1
-	li	s4,0
-	j	.L86
-.L208:
-	mv	s7,s1
-	j	.L85
-.L209:
-	li	a5,1
-	beq	a3,a5,.L210
-	mv	s7,t5
-.L90:
-	li	s6,0
-	li	s4,0
-	li	s5,0
-.L91:
-	li	a5,1550
-	beq	s6,a5,.L211
-	slli	a5,s5,1
-	add	a5,a5,s5
-	slli	s3,a5,3
-	add	s3,s3,s5
-	slli	a5,s3,3
-	add	a5,s4,a5
-	add	a5,a5,s7
-	add	a5,a4,a5
-	li	s3,87
-	sb	s3,0(a5)
-	addi	s6,s6,1
-	addi	s4,s4,1
-	li	a5,50
-	bne	s4,a5,.L91
-	addi	s5,s5,1
-	li	s4,0
-	j	.L91
-.L210:
-	mv	s7,s0
-	j	.L90
-.L211:
-	bne	a7,zero,.L94
-	li	a5,1
-	beq	a3,a5,.L212
-	addi	s8,s1,-5
-.L96:
-	add	s8,a4,s8
-	li	a5,1
-	beq	a3,a5,.L213
-	addi	t0,s1,-5
-.L98:
-	addi	t4,t4,-5
-	li	a5,1
-	beq	a3,a5,.L214
-.L99:
-	bne	a3,zero,.L100
-	li	a5,160
-	bgt	t0,a5,.L100
-	mv	a7,t3
-	j	.L100
-.L212:
-	addi	s8,t0,-5
-	j	.L96
-.L213:
-	addi	s1,t0,-5
-	j	.L98
-.L214:
-	li	a5,160
-	bgt	s1,a5,.L99
-	mv	a7,t3
-	j	.L100
-.L94:
-	addi	s8,a4,395
-	li	a5,1
-	beq	a3,a5,.L215
-	li	t0,395
-.L101:
-	addi	a7,a7,-1
-	li	t4,195
-.L100:
-	li	s6,0
-	li	s5,0
-	li	s7,0
-.L102:
-	li	a5,1950
-	beq	s6,a5,.L216
-	li	s3,-2093985792
-	addi	s3,s3,870
-	add	s3,s6,s3
-	slli	a5,s7,1
-	add	a5,a5,s7
-	slli	s4,a5,3
-	add	s4,s4,s7
-	slli	a5,s4,3
-	add	a5,s5,a5
-	add	a5,s8,a5
-	lbu	s3,0(s3)
-	sb	s3,0(a5)
-	addi	s6,s6,1
-	addi	s5,s5,1
-	li	a5,50
-	bne	s5,a5,.L102
-	addi	s7,s7,1
-	li	s5,0
-	j	.L102
-.L215:
-	li	s1,395
-	j	.L101
-.L216:
-	li	a5,1
-	beq	a3,a5,.L217
-	mv	a5,t0
-.L105:
-	li	s3,200
-	ble	a5,s3,.L160
-	addi	a5,a5,-345
-	li	s3,55
-	bgtu	a5,s3,.L161
-	mv	s9,a0
-	j	.L106
-.L217:
-	mv	a5,s1
-	j	.L105
-.L160:
-	li	s9,-1
-.L106:
-	beq	a7,zero,.L107
-	li	a5,2
-	beq	a7,a5,.L107
-	li	s8,20480
-	addi	s8,s8,-1285
-	add	s8,a4,s8
-	li	a5,1
-	beq	a3,a5,.L218
-	li	t5,20480
-	addi	t5,t5,-1285
-.L113:
-	addi	a7,a7,-1
-	j	.L112
-.L161:
-	li	s9,0
-	j	.L106
-.L107:
-	li	a5,1
-	beq	a3,a5,.L219
-	addi	s8,s0,-5
-.L110:
-	add	s8,a4,s8
-	li	a5,1
-	beq	a3,a5,.L220
-	addi	t5,s0,-5
-.L112:
-	li	s6,0
-	li	s5,0
-	li	s7,0
-.L114:
-	li	a5,1500
-	beq	s6,a5,.L221
-	li	s3,-2093993984
-	addi	s3,s3,1012
-	add	s3,s6,s3
-	slli	a5,s7,1
-	add	a5,a5,s7
-	slli	s4,a5,3
-	add	s4,s4,s7
-	slli	a5,s4,3
-	add	a5,s5,a5
-	add	a5,s8,a5
-	lbu	s3,0(s3)
-	sb	s3,0(a5)
-	addi	s6,s6,1
-	addi	s5,s5,1
-	li	a5,50
-	bne	s5,a5,.L114
-	addi	s7,s7,1
-	li	s5,0
-	j	.L114
-.L219:
-	addi	s8,t5,-5
-	j	.L110
-.L220:
-	addi	s0,t5,-5
-	j	.L112
-.L218:
-	li	s0,20480
-	addi	s0,s0,-1285
-	j	.L113
-.L221:
-	li	a5,1
-	beq	s9,a5,.L222
-	li	a5,-1
-	beq	s9,a5,.L223
-.L121:
-	addi	a5,t4,-40
-	li	s3,70
-	bgtu	a5,s3,.L125
-	li	a5,39
-	ble	t1,a5,.L165
-	li	a5,69
-	bgt	t1,a5,.L166
-.L125:
-	bgt	t6,zero,.L126
-.L127:
-	addi	a2,a2,1
-	li	a5,5
-	beq	a2,a5,.L224
-.L131:
-	li	a5,1
-	sub	a3,a5,a3
-	li	a5,-2046820352
-	sw	a3,4(a5)
-	li	a4,0
-.L132:
-	li	a5,4096
-	addi	a5,a5,904
-	beq	a4,a5,.L225
-	addi	a4,a4,1
-	j	.L132
-.L222:
-	li	s6,0
-	li	s4,0
-	li	s5,0
-.L117:
-	li	a5,8192
-	addi	a5,a5,-1942
-	beq	s6,a5,.L121
-	slli	a5,s5,1
-	add	a5,a5,s5
-	slli	s3,a5,3
-	add	s3,s3,s5
-	slli	a5,s3,3
-	add	a5,s4,a5
-	add	a5,a4,a5
-	li	s3,87
-	sb	s3,0(a5)
-	addi	s6,s6,1
-	addi	s4,s4,1
-	li	a5,50
-	bne	s4,a5,.L117
-	addi	s5,s5,1
-	li	s4,0
-	j	.L117
-.L223:
-	li	s6,0
-	li	s4,0
-	li	s5,0
-.L122:
-	li	a5,8192
-	addi	a5,a5,-1942
-	beq	s6,a5,.L121
-	slli	a5,s5,1
-	add	a5,a5,s5
-	slli	s3,a5,3
-	add	s3,s3,s5
-	slli	a5,s3,3
-	add	a5,s4,a5
-	addi	a5,a5,150
-	add	a5,a4,a5
-	li	s3,87
-	sb	s3,0(a5)
-	addi	s6,s6,1
-	addi	s4,s4,1
-	li	a5,50
-	bne	s4,a5,.L122
-	addi	s5,s5,1
-	li	s4,0
-	j	.L122
-.L165:
-	mv	t6,a0
-.L126:
-	li	s6,0
-	li	s5,0
-	li	s7,0
-.L128:
-	li	a5,4096
-	addi	a5,a5,1904
-	beq	s6,a5,.L127
-	li	s3,-2093981696
-	addi	s3,s3,-1276
-	add	s3,s6,s3
-	slli	a5,s7,1
-	add	a5,a5,s7
-	slli	s4,a5,3
-	add	s4,s4,s7
-	slli	a5,s4,3
-	add	a5,s5,a5
-	li	s4,12288
-	addi	s4,s4,-263
-	add	a5,a5,s4
-	add	a5,a4,a5
-	lbu	s3,0(s3)
-	sb	s3,0(a5)
-	addi	s6,s6,1
-	addi	s5,s5,1
-	li	a5,150
-	bne	s5,a5,.L128
-	addi	s7,s7,1
-	li	s5,0
-	j	.L128
-.L166:
-	mv	t6,a0
-	j	.L126
-.L224:
-	li	a2,0
-	j	.L131
-.L225:
-	bgt	t6,zero,.L226
-.L134:
-	li	a5,-2063597568
-	lw	a5,4(a5)
-	andi	a5,a5,1
-	beq	a5,zero,.L60
-	beq	s2,zero,.L146
-.L60:
-	bne	a5,zero,.L61
-	beq	s2,zero,.L61
-	mv	s2,a5
-	j	.L61
-.L226:
-	li	a0,0
-	lw	s0,44(sp)
-	lw	s1,40(sp)
-	lw	s2,36(sp)
-	lw	s3,32(sp)
-	lw	s4,28(sp)
-	lw	s5,24(sp)
-	lw	s6,20(sp)
-	lw	s7,16(sp)
-	lw	s8,12(sp)
-	lw	s9,8(sp)
-	addi	sp,sp,48
-	jr	ra
-	.size	main, .-main
-	.ident	"GCC: (SiFive GCC 8.3.0-2019.08.0) 8.3.0"
+	.attribute	4, 16
+	.attribute	5, "rv32i2p0"
+	.file	"flappybird.c"
+	.globl	main                            # -- Begin function main
+	.p2align	2
+	.type	main,@function
+main:                                   # @main
+# %bb.0:                                # %entry
+	addi	sp, sp, -144
+	sw	ra, 140(sp)                     # 4-byte Folded Spill
+	sw	s0, 136(sp)                     # 4-byte Folded Spill
+	sw	s1, 132(sp)                     # 4-byte Folded Spill
+	sw	s2, 128(sp)                     # 4-byte Folded Spill
+	sw	s3, 124(sp)                     # 4-byte Folded Spill
+	sw	s4, 120(sp)                     # 4-byte Folded Spill
+	sw	s5, 116(sp)                     # 4-byte Folded Spill
+	sw	s6, 112(sp)                     # 4-byte Folded Spill
+	sw	s7, 108(sp)                     # 4-byte Folded Spill
+	sw	s8, 104(sp)                     # 4-byte Folded Spill
+	sw	s9, 100(sp)                     # 4-byte Folded Spill
+	sw	s10, 96(sp)                     # 4-byte Folded Spill
+	sw	s11, 92(sp)                     # 4-byte Folded Spill
+	lui	a0, 540672
+	lui	a1, 357749
+	addi	a1, a1, 1879
+	lui	a2, 540701
+	addi	a2, a2, 1216
+.LBB0_1:                                # %while.body2
+                                        # =>This Inner Loop Header: Depth=1
+	addi	a3, a0, 4
+	sw	a1, 0(a0)
+	mv	a0, a3
+	bltu	a3, a2, .LBB0_1
+# %bb.2:                                # %while.end3
+	lui	a0, 548864
+	li	a1, 1
+	sw	a1, 4(a0)
+	li	a1, 2
+	sw	a1, 0(a0)
+	lui	a0, 528384
+	lui	a1, 2
+	addi	a1, a1, -692
+	lui	a2, 357749
+	addi	a2, a2, 1879
+.LBB0_3:                                # %while.body5
+                                        # =>This Inner Loop Header: Depth=1
+	sw	a2, 0(a0)
+	addi	a1, a1, -1
+	addi	a0, a0, 4
+	bnez	a1, .LBB0_3
+# %bb.4:                                # %while.body8.preheader
+	li	a0, 0
+	li	a5, 0
+	lui	a1, 537344
+	lui	a2, 1
+	addi	a2, a2, 1504
+	lui	a3, 528384
+	addi	a3, a3, 2030
+	li	a4, 140
+	j	.LBB0_6
+.LBB0_5:                                # %while.body8
+                                        #   in Loop: Header=BB0_6 Depth=1
+	addi	a6, a6, -140
+	seqz	a6, a6
+	add	a0, a0, a6
+	addi	a2, a2, -1
+	addi	a1, a1, 1
+	beqz	a2, .LBB0_8
+.LBB0_6:                                # %while.body8
+                                        # =>This Inner Loop Header: Depth=1
+	slli	a6, a0, 3
+	slli	a7, a0, 6
+	sub	a6, a6, a7
+	slli	a7, a0, 8
+	add	a6, a6, a7
+	lb	a7, 0(a1)
+	add	a6, a6, a5
+	add	t0, a6, a3
+	addi	a6, a5, 1
+	sb	a7, 0(t0)
+	li	a5, 0
+	beq	a6, a4, .LBB0_5
+# %bb.7:                                # %while.body8
+                                        #   in Loop: Header=BB0_6 Depth=1
+	mv	a5, a6
+	j	.LBB0_5
+.LBB0_8:                                # %while.body14.preheader
+	li	a0, 0
+	li	a4, 0
+	lui	a1, 1
+	addi	a1, a1, 904
+	lui	a2, 537345
+	addi	a2, a2, 1504
+	lui	a3, 528390
+	addi	a3, a3, 424
+	li	a5, 200
+	j	.LBB0_10
+.LBB0_9:                                # %while.body14
+                                        #   in Loop: Header=BB0_10 Depth=1
+	addi	a6, a6, -200
+	seqz	a6, a6
+	add	a0, a0, a6
+	addi	a1, a1, -1
+	addi	a2, a2, 1
+	beqz	a1, .LBB0_12
+.LBB0_10:                               # %while.body14
+                                        # =>This Inner Loop Header: Depth=1
+	slli	a6, a0, 3
+	slli	a7, a0, 6
+	sub	a6, a6, a7
+	slli	a7, a0, 8
+	add	a6, a6, a7
+	lb	a7, 0(a2)
+	add	a6, a6, a4
+	add	t0, a6, a3
+	addi	a6, a4, 1
+	sb	a7, 0(t0)
+	li	a4, 0
+	beq	a6, a5, .LBB0_9
+# %bb.11:                               # %while.body14
+                                        #   in Loop: Header=BB0_10 Depth=1
+	mv	a4, a6
+	j	.LBB0_9
+.LBB0_12:                               # %while.body20.preheader
+	li	a0, 0
+	li	a5, 0
+	li	a1, 0
+	lui	a2, 528387
+	addi	a2, a2, -1206
+	lui	a3, 537347
+	addi	a3, a3, -1688
+	li	a4, 36
+	li	a6, 900
+	j	.LBB0_14
+.LBB0_13:                               # %while.body20
+                                        #   in Loop: Header=BB0_14 Depth=1
+	addi	a1, a1, 1
+	addi	a7, a7, -36
+	seqz	a7, a7
+	add	a0, a0, a7
+	beq	a1, a6, .LBB0_16
+.LBB0_14:                               # %while.body20
+                                        # =>This Inner Loop Header: Depth=1
+	slli	a7, a0, 3
+	slli	t0, a0, 6
+	sub	a7, a7, t0
+	slli	t0, a0, 8
+	add	a7, a7, t0
+	add	t0, a1, a3
+	lb	t0, 0(t0)
+	add	a7, a7, a5
+	add	t1, a7, a2
+	addi	a7, a5, 1
+	sb	t0, 0(t1)
+	li	a5, 0
+	beq	a7, a4, .LBB0_13
+# %bb.15:                               # %while.body20
+                                        #   in Loop: Header=BB0_14 Depth=1
+	mv	a5, a7
+	j	.LBB0_13
+.LBB0_16:                               # %while.cond25.preheader
+	lui	a0, 544768
+.LBB0_17:                               # %while.cond25
+                                        # =>This Inner Loop Header: Depth=1
+	lw	a1, 4(a0)
+	andi	a1, a1, 1
+	beqz	a1, .LBB0_17
+# %bb.18:                               # %if.then28
+	lui	a0, 548864
+	addi	a1, a0, 4
+	sw	zero, 0(a1)
+.LBB0_19:                               # %while.cond33
+                                        # =>This Inner Loop Header: Depth=1
+	lw	a1, 8(a0)
+	andi	a1, a1, 1
+	bnez	a1, .LBB0_19
+# %bb.20:                               # %while.end35
+	lui	a0, 548864
+	li	a1, 2
+	sw	a1, 0(a0)
+	lui	a0, 540672
+	lui	a1, 2
+	addi	a1, a1, -692
+	lui	a2, 357749
+	addi	a2, a2, 1879
+.LBB0_21:                               # %while.body37
+                                        # =>This Inner Loop Header: Depth=1
+	sw	a2, 0(a0)
+	addi	a1, a1, -1
+	addi	a0, a0, 4
+	bnez	a1, .LBB0_21
+# %bb.22:                               # %while.body40.preheader
+	li	a0, 0
+	li	a5, 0
+	lui	a1, 537344
+	lui	a2, 1
+	addi	a2, a2, 1504
+	lui	a3, 540672
+	addi	a3, a3, 2030
+	li	a4, 140
+	j	.LBB0_24
+.LBB0_23:                               # %while.body40
+                                        #   in Loop: Header=BB0_24 Depth=1
+	addi	a6, a6, -140
+	seqz	a6, a6
+	add	a0, a0, a6
+	addi	a2, a2, -1
+	addi	a1, a1, 1
+	beqz	a2, .LBB0_26
+.LBB0_24:                               # %while.body40
+                                        # =>This Inner Loop Header: Depth=1
+	slli	a6, a0, 3
+	slli	a7, a0, 6
+	sub	a6, a6, a7
+	slli	a7, a0, 8
+	add	a6, a6, a7
+	lb	a7, 0(a1)
+	add	a6, a6, a5
+	add	t0, a6, a3
+	addi	a6, a5, 1
+	sb	a7, 0(t0)
+	li	a5, 0
+	beq	a6, a4, .LBB0_23
+# %bb.25:                               # %while.body40
+                                        #   in Loop: Header=BB0_24 Depth=1
+	mv	a5, a6
+	j	.LBB0_23
+.LBB0_26:                               # %while.body46.preheader
+	li	a0, 0
+	li	a4, 0
+	lui	a1, 1
+	addi	a1, a1, 904
+	lui	a2, 537345
+	addi	a2, a2, 1504
+	lui	a3, 540678
+	addi	a3, a3, 424
+	li	a5, 200
+	j	.LBB0_28
+.LBB0_27:                               # %while.body46
+                                        #   in Loop: Header=BB0_28 Depth=1
+	addi	a6, a6, -200
+	seqz	a6, a6
+	add	a0, a0, a6
+	addi	a1, a1, -1
+	addi	a2, a2, 1
+	beqz	a1, .LBB0_30
+.LBB0_28:                               # %while.body46
+                                        # =>This Inner Loop Header: Depth=1
+	slli	a6, a0, 3
+	slli	a7, a0, 6
+	sub	a6, a6, a7
+	slli	a7, a0, 8
+	add	a6, a6, a7
+	lb	a7, 0(a2)
+	add	a6, a6, a4
+	add	t0, a6, a3
+	addi	a6, a4, 1
+	sb	a7, 0(t0)
+	li	a4, 0
+	beq	a6, a5, .LBB0_27
+# %bb.29:                               # %while.body46
+                                        #   in Loop: Header=BB0_28 Depth=1
+	mv	a4, a6
+	j	.LBB0_27
+.LBB0_30:                               # %while.body52.preheader
+	li	a0, 0
+	li	a5, 0
+	li	a1, 0
+	lui	a2, 540675
+	addi	a2, a2, -606
+	lui	a3, 537347
+	addi	a3, a3, -788
+	li	a4, 36
+	li	a6, 900
+	j	.LBB0_32
+.LBB0_31:                               # %while.body52
+                                        #   in Loop: Header=BB0_32 Depth=1
+	addi	a1, a1, 1
+	addi	a7, a7, -36
+	seqz	a7, a7
+	add	a0, a0, a7
+	beq	a1, a6, .LBB0_34
+.LBB0_32:                               # %while.body52
+                                        # =>This Inner Loop Header: Depth=1
+	slli	a7, a0, 3
+	slli	t0, a0, 6
+	sub	a7, a7, t0
+	slli	t0, a0, 8
+	add	a7, a7, t0
+	add	t0, a1, a3
+	lb	t0, 0(t0)
+	add	a7, a7, a5
+	add	t1, a7, a2
+	addi	a7, a5, 1
+	sb	t0, 0(t1)
+	li	a5, 0
+	beq	a7, a4, .LBB0_31
+# %bb.33:                               # %while.body52
+                                        #   in Loop: Header=BB0_32 Depth=1
+	mv	a5, a7
+	j	.LBB0_31
+.LBB0_34:                               # %while.cond63.preheader
+	lui	a0, 548864
+	addi	a1, a0, 4
+	sw	zero, 0(a1)
+.LBB0_35:                               # %while.cond66
+                                        # =>This Inner Loop Header: Depth=1
+	lw	a1, 8(a0)
+	andi	a1, a1, 1
+	bnez	a1, .LBB0_35
+# %bb.36:                               # %while.body70.preheader
+	li	a5, 0
+	li	a1, 0
+	li	a4, 0
+	sw	zero, 72(sp)                    # 4-byte Folded Spill
+	sw	zero, 80(sp)                    # 4-byte Folded Spill
+	li	a2, 0
+	li	a6, 1
+	lui	a0, 540674
+	addi	a0, a0, 1908
+	sw	a0, 88(sp)                      # 4-byte Folded Spill
+	lui	a0, 528386
+	addi	t2, a0, 1908
+	lui	a0, 5
+	addi	t3, a0, 1879
+	lui	a0, 357749
+	addi	t4, a0, 1879
+	li	t5, 280
+	lui	a0, 540672
+	addi	a0, a0, 2030
+	sw	a0, 64(sp)                      # 4-byte Folded Spill
+	lui	a0, 528384
+	addi	a0, a0, 2030
+	sw	a0, 76(sp)                      # 4-byte Folded Spill
+	li	s4, 137
+	li	s5, 140
+	li	s6, 87
+	li	s7, 2
+	lui	a0, 540673
+	addi	a0, a0, -66
+	sw	a0, 56(sp)                      # 4-byte Folded Spill
+	lui	a0, 528385
+	addi	a0, a0, -66
+	sw	a0, 60(sp)                      # 4-byte Folded Spill
+	lui	a0, 540675
+	addi	a0, a0, -1206
+	sw	a0, 68(sp)                      # 4-byte Folded Spill
+	lui	a0, 528387
+	addi	a0, a0, -1206
+	sw	a0, 84(sp)                      # 4-byte Folded Spill
+	lui	a0, 537347
+	addi	s8, a0, -1688
+	lui	a0, 3
+	addi	s9, a0, -1206
+	li	s11, 36
+	li	s1, 900
+	lui	ra, 548864
+	li	s3, 1
+	j	.LBB0_39
+.LBB0_37:                               # %if.then171
+                                        #   in Loop: Header=BB0_39 Depth=1
+	addi	a1, a1, 1
+	li	a5, 1
+.LBB0_38:                               # %if.end173
+                                        #   in Loop: Header=BB0_39 Depth=1
+	beq	a1, s7, .LBB0_101
+.LBB0_39:                               # %while.body70
+                                        # =>This Loop Header: Depth=1
+                                        #     Child Loop BB0_42 Depth 2
+                                        #     Child Loop BB0_69 Depth 2
+                                        #       Child Loop BB0_70 Depth 3
+                                        #       Child Loop BB0_73 Depth 3
+                                        #       Child Loop BB0_75 Depth 3
+                                        #     Child Loop BB0_94 Depth 2
+                                        #     Child Loop BB0_97 Depth 2
+	mv	a0, t2
+	beq	a2, a6, .LBB0_41
+# %bb.40:                               # %while.body70
+                                        #   in Loop: Header=BB0_39 Depth=1
+	lw	a0, 88(sp)                      # 4-byte Folded Reload
+.LBB0_41:                               # %while.body70
+                                        #   in Loop: Header=BB0_39 Depth=1
+	li	a3, 0
+.LBB0_42:                               # %while.cond78.preheader
+                                        #   Parent Loop BB0_39 Depth=1
+                                        # =>  This Inner Loop Header: Depth=2
+	sh	t3, -18(a0)
+	sw	t4, -16(a0)
+	sw	t4, -12(a0)
+	sw	t4, -8(a0)
+	sw	t4, -4(a0)
+	sw	t4, 0(a0)
+	sw	t4, 4(a0)
+	sw	t4, 8(a0)
+	sw	t4, 12(a0)
+	sh	t3, 16(a0)
+	addi	a3, a3, 8
+	addi	a0, a0, 200
+	bne	a3, t5, .LBB0_42
+# %bb.43:                               # %while.end77
+                                        #   in Loop: Header=BB0_39 Depth=1
+	bne	a1, a6, .LBB0_77
+# %bb.44:                               # %if.then89
+                                        #   in Loop: Header=BB0_39 Depth=1
+	li	a0, 4
+	blt	a4, a0, .LBB0_48
+# %bb.45:                               # %if.then92
+                                        #   in Loop: Header=BB0_39 Depth=1
+	lw	a3, 76(sp)                      # 4-byte Folded Reload
+	beq	a2, a6, .LBB0_47
+# %bb.46:                               # %if.then92
+                                        #   in Loop: Header=BB0_39 Depth=1
+	lw	a3, 64(sp)                      # 4-byte Folded Reload
+.LBB0_47:                               # %if.then92
+                                        #   in Loop: Header=BB0_39 Depth=1
+	andi	a0, a4, 3
+	j	.LBB0_66
+.LBB0_48:                               # %if.else93
+                                        #   in Loop: Header=BB0_39 Depth=1
+	srai	a0, a4, 31
+	srli	a0, a0, 30
+	add	a0, a4, a0
+	andi	a0, a0, -4
+	sub	a0, a4, a0
+	beq	a0, s7, .LBB0_53
+# %bb.49:                               # %if.else93
+                                        #   in Loop: Header=BB0_39 Depth=1
+	beq	a0, a6, .LBB0_56
+# %bb.50:                               # %if.else93
+                                        #   in Loop: Header=BB0_39 Depth=1
+	bnez	a0, .LBB0_58
+# %bb.51:                               # %if.then98
+                                        #   in Loop: Header=BB0_39 Depth=1
+	beq	a2, a6, .LBB0_60
+# %bb.52:                               # %if.then98
+                                        #   in Loop: Header=BB0_39 Depth=1
+	lui	a0, 540674
+	j	.LBB0_61
+.LBB0_53:                               # %if.then110
+                                        #   in Loop: Header=BB0_39 Depth=1
+	lw	a3, 60(sp)                      # 4-byte Folded Reload
+	beq	a2, a6, .LBB0_55
+# %bb.54:                               # %if.then110
+                                        #   in Loop: Header=BB0_39 Depth=1
+	lw	a3, 56(sp)                      # 4-byte Folded Reload
+.LBB0_55:                               # %if.then110
+                                        #   in Loop: Header=BB0_39 Depth=1
+	li	s2, 30
+	j	.LBB0_67
+.LBB0_56:                               # %if.then104
+                                        #   in Loop: Header=BB0_39 Depth=1
+	beq	a2, a6, .LBB0_62
+# %bb.57:                               # %if.then104
+                                        #   in Loop: Header=BB0_39 Depth=1
+	lui	a0, 540673
+	j	.LBB0_63
+.LBB0_58:                               # %if.else111
+                                        #   in Loop: Header=BB0_39 Depth=1
+	beq	a2, a6, .LBB0_64
+# %bb.59:                               # %if.else111
+                                        #   in Loop: Header=BB0_39 Depth=1
+	lui	a3, 540672
+	j	.LBB0_65
+.LBB0_60:                               #   in Loop: Header=BB0_39 Depth=1
+	lui	a0, 528386
+.LBB0_61:                               # %if.then98
+                                        #   in Loop: Header=BB0_39 Depth=1
+	addi	a3, a0, -162
+	li	s2, 10
+	j	.LBB0_67
+.LBB0_62:                               #   in Loop: Header=BB0_39 Depth=1
+	lui	a0, 528385
+.LBB0_63:                               # %if.then104
+                                        #   in Loop: Header=BB0_39 Depth=1
+	addi	a3, a0, 1934
+	li	s2, 20
+	j	.LBB0_67
+.LBB0_64:                               #   in Loop: Header=BB0_39 Depth=1
+	lui	a3, 528384
+.LBB0_65:                               # %if.else111
+                                        #   in Loop: Header=BB0_39 Depth=1
+	addi	a3, a3, 2030
+.LBB0_66:                               # %if.end94
+                                        #   in Loop: Header=BB0_39 Depth=1
+	slli	a7, a0, 1
+	slli	a0, a0, 3
+	add	a0, a7, a0
+	addi	s2, a0, 10
+	beqz	s2, .LBB0_76
+.LBB0_67:                               # %while.cond122.preheader.preheader
+                                        #   in Loop: Header=BB0_39 Depth=1
+	li	s10, 0
+	andi	a7, a3, 3
+	li	a0, 4
+	sub	t0, a0, a7
+	ori	t1, a7, -4
+	j	.LBB0_69
+.LBB0_68:                               # %while.end132
+                                        #   in Loop: Header=BB0_69 Depth=2
+	addi	s10, s10, 1
+	addi	a3, a3, 200
+	beq	s10, s2, .LBB0_76
+.LBB0_69:                               # %while.cond122.preheader
+                                        #   Parent Loop BB0_39 Depth=1
+                                        # =>  This Loop Header: Depth=2
+                                        #       Child Loop BB0_70 Depth 3
+                                        #       Child Loop BB0_73 Depth 3
+                                        #       Child Loop BB0_75 Depth 3
+	mv	a0, t1
+	mv	t6, a3
+	beqz	a7, .LBB0_72
+.LBB0_70:                               # %while.body123
+                                        #   Parent Loop BB0_39 Depth=1
+                                        #     Parent Loop BB0_69 Depth=2
+                                        # =>    This Inner Loop Header: Depth=3
+	mv	s0, a0
+	sb	s6, 0(t6)
+	addi	a0, a0, 1
+	addi	t6, t6, 1
+	bgeu	a0, s0, .LBB0_70
+# %bb.71:                               #   in Loop: Header=BB0_69 Depth=2
+	mv	t6, t0
+	j	.LBB0_73
+.LBB0_72:                               #   in Loop: Header=BB0_69 Depth=2
+	li	t6, 0
+.LBB0_73:                               # %while.body128
+                                        #   Parent Loop BB0_39 Depth=1
+                                        #     Parent Loop BB0_69 Depth=2
+                                        # =>    This Inner Loop Header: Depth=3
+	add	a0, a3, t6
+	addi	t6, t6, 4
+	sw	t4, 0(a0)
+	bltu	t6, s4, .LBB0_73
+# %bb.74:                               # %while.cond130.preheader
+                                        #   in Loop: Header=BB0_69 Depth=2
+	beq	t6, s5, .LBB0_68
+.LBB0_75:                               # %while.body131
+                                        #   Parent Loop BB0_39 Depth=1
+                                        #     Parent Loop BB0_69 Depth=2
+                                        # =>    This Inner Loop Header: Depth=3
+	add	a0, a3, t6
+	addi	t6, t6, 1
+	sb	s6, 0(a0)
+	bne	t6, s5, .LBB0_75
+	j	.LBB0_68
+.LBB0_76:                               # %while.end121
+                                        #   in Loop: Header=BB0_39 Depth=1
+	addi	a4, a4, 1
+.LBB0_77:                               # %if.end91
+                                        #   in Loop: Header=BB0_39 Depth=1
+	srai	a0, s3, 31
+	srli	a0, a0, 30
+	add	a0, s3, a0
+	andi	a0, a0, -4
+	sub	a0, s3, a0
+	andi	a3, a0, -3
+	bne	a3, a6, .LBB0_81
+# %bb.78:                               # %if.then133
+                                        #   in Loop: Header=BB0_39 Depth=1
+	lw	a3, 84(sp)                      # 4-byte Folded Reload
+	beq	a2, a6, .LBB0_80
+# %bb.79:                               # %if.then133
+                                        #   in Loop: Header=BB0_39 Depth=1
+	lw	a3, 68(sp)                      # 4-byte Folded Reload
+.LBB0_80:                               # %if.then133
+                                        #   in Loop: Header=BB0_39 Depth=1
+	li	s10, 55
+	mv	a0, s9
+	mv	s2, s8
+	beq	a2, a6, .LBB0_88
+	j	.LBB0_91
+.LBB0_81:                               # %if.else134
+                                        #   in Loop: Header=BB0_39 Depth=1
+	bne	a0, s7, .LBB0_84
+# %bb.82:                               # %if.then144
+                                        #   in Loop: Header=BB0_39 Depth=1
+	beq	a2, a6, .LBB0_86
+# %bb.83:                               # %if.then144
+                                        #   in Loop: Header=BB0_39 Depth=1
+	lui	a0, 540675
+	j	.LBB0_87
+.LBB0_84:                               # %if.else145
+                                        #   in Loop: Header=BB0_39 Depth=1
+	beq	a2, a6, .LBB0_89
+# %bb.85:                               # %if.else145
+                                        #   in Loop: Header=BB0_39 Depth=1
+	lui	a0, 540675
+	j	.LBB0_90
+.LBB0_86:                               #   in Loop: Header=BB0_39 Depth=1
+	lui	a0, 528387
+.LBB0_87:                               # %if.then144
+                                        #   in Loop: Header=BB0_39 Depth=1
+	addi	a3, a0, -1806
+	li	s10, 52
+	lui	a0, 537347
+	addi	s2, a0, 112
+	lui	a0, 3
+	addi	a0, a0, -1806
+	bne	a2, a6, .LBB0_91
+.LBB0_88:                               #   in Loop: Header=BB0_39 Depth=1
+	sw	a0, 72(sp)                      # 4-byte Folded Spill
+	j	.LBB0_92
+.LBB0_89:                               #   in Loop: Header=BB0_39 Depth=1
+	lui	a0, 528387
+.LBB0_90:                               # %if.else145
+                                        #   in Loop: Header=BB0_39 Depth=1
+	addi	a3, a0, -606
+	li	s10, 58
+	lui	a0, 537347
+	addi	s2, a0, -788
+	lui	a0, 3
+	addi	a0, a0, -606
+	beq	a2, a6, .LBB0_88
+.LBB0_91:                               # %if.end135
+                                        #   in Loop: Header=BB0_39 Depth=1
+	sw	a0, 80(sp)                      # 4-byte Folded Spill
+.LBB0_92:                               # %if.end135
+                                        #   in Loop: Header=BB0_39 Depth=1
+	li	a0, 0
+	li	a7, 0
+	li	a2, 0
+	j	.LBB0_94
+.LBB0_93:                               # %while.body160
+                                        #   in Loop: Header=BB0_94 Depth=2
+	addi	a2, a2, 1
+	addi	t0, t0, -36
+	seqz	t0, t0
+	add	a0, a0, t0
+	beq	a2, s1, .LBB0_96
+.LBB0_94:                               # %while.body160
+                                        #   Parent Loop BB0_39 Depth=1
+                                        # =>  This Inner Loop Header: Depth=2
+	slli	t0, a0, 3
+	slli	t1, a0, 6
+	sub	t0, t0, t1
+	slli	t1, a0, 8
+	add	t0, t0, t1
+	add	t1, s2, a2
+	lb	t1, 0(t1)
+	add	t0, a3, t0
+	add	t6, t0, a7
+	addi	t0, a7, 1
+	sb	t1, 0(t6)
+	li	a7, 0
+	beq	t0, s11, .LBB0_93
+# %bb.95:                               # %while.body160
+                                        #   in Loop: Header=BB0_94 Depth=2
+	mv	a7, t0
+	j	.LBB0_93
+.LBB0_96:                               # %while.end161
+                                        #   in Loop: Header=BB0_39 Depth=1
+	addi	s3, s3, 1
+	srli	a0, s3, 31
+	add	a0, s3, a0
+	andi	a0, a0, -2
+	sub	a0, a0, s3
+	addi	a2, a0, 1
+	sw	a2, 4(ra)
+.LBB0_97:                               # %while.cond165
+                                        #   Parent Loop BB0_39 Depth=1
+                                        # =>  This Inner Loop Header: Depth=2
+	lw	a0, 8(ra)
+	andi	a0, a0, 1
+	bnez	a0, .LBB0_97
+# %bb.98:                               # %while.cond168.preheader
+                                        #   in Loop: Header=BB0_39 Depth=1
+	lui	a0, 544768
+	lw	a0, 4(a0)
+	andi	a0, a0, 1
+	seqz	a3, a0
+	snez	a7, a5
+	or	a3, a3, a7
+	beqz	a3, .LBB0_37
+# %bb.99:                               # %if.else172
+                                        #   in Loop: Header=BB0_39 Depth=1
+	xori	a3, a5, 1
+	or	a0, a0, a3
+	bnez	a0, .LBB0_38
+# %bb.100:                              # %if.else172
+                                        #   in Loop: Header=BB0_39 Depth=1
+	li	a5, 0
+	j	.LBB0_38
+.LBB0_101:                              # %while.end71
+	sw	a2, 88(sp)                      # 4-byte Folded Spill
+	li	t1, 0
+	sw	zero, 84(sp)                    # 4-byte Folded Spill
+	sw	zero, 44(sp)                    # 4-byte Folded Spill
+	lui	a0, 1048575
+	addi	a0, a0, 496
+	sw	a0, 28(sp)                      # 4-byte Folded Spill
+	lui	a0, 544768
+	li	a1, 1
+	li	a2, 1
+	sw	a1, 16(a0)
+	li	a0, 400
+	sw	a0, 76(sp)                      # 4-byte Folded Spill
+	lui	a0, 5
+	addi	a1, a0, -1280
+	lui	a0, 357749
+	addi	t3, a0, 1879
+	li	t4, 33
+	li	t5, 36
+	li	t6, 25
+	lui	a0, 540672
+	addi	a0, a0, 600
+	sw	a0, 8(sp)                       # 4-byte Folded Spill
+	lui	a0, 528384
+	addi	a0, a0, 600
+	sw	a0, 24(sp)                      # 4-byte Folded Spill
+	lui	s6, 537347
+	lui	a0, 537349
+	addi	s8, a0, 870
+	lui	a0, 540675
+	addi	a0, a0, -263
+	sw	a0, 12(sp)                      # 4-byte Folded Spill
+	lui	a0, 528387
+	addi	a0, a0, -263
+	sw	a0, 40(sp)                      # 4-byte Folded Spill
+	lui	a0, 1
+	addi	a0, a0, 1904
+	sw	a0, 36(sp)                      # 4-byte Folded Spill
+	lui	a0, 537350
+	addi	a0, a0, -1276
+	sw	a0, 32(sp)                      # 4-byte Folded Spill
+	lui	a0, 540671
+	addi	a0, a0, 496
+	sw	a0, 4(sp)                       # 4-byte Folded Spill
+	lui	a0, 528383
+	addi	a0, a0, 496
+	sw	a0, 20(sp)                      # 4-byte Folded Spill
+	lui	a0, 528389
+	addi	a0, a0, -398
+	sw	a0, 16(sp)                      # 4-byte Folded Spill
+	lui	a0, 540677
+	addi	a0, a0, -398
+	sw	a0, 0(sp)                       # 4-byte Folded Spill
+	li	s9, 900
+	li	s1, 47
+	li	s7, 50
+	li	a4, 39
+	li	s5, 31
+	li	s2, 1950
+	li	t0, 1500
+	lui	s11, 548864
+	li	ra, 87
+	li	a0, 400
+	sw	a0, 68(sp)                      # 4-byte Folded Spill
+	sw	a1, 56(sp)                      # 4-byte Folded Spill
+	sw	a1, 48(sp)                      # 4-byte Folded Spill
+	li	a0, 200
+	sw	a0, 60(sp)                      # 4-byte Folded Spill
+	lw	s3, 72(sp)                      # 4-byte Folded Reload
+	j	.LBB0_103
+.LBB0_102:                              # %while.cond443.preheader
+                                        #   in Loop: Header=BB0_103 Depth=1
+	bnez	a0, .LBB0_228
+.LBB0_103:                              # %while.body186
+                                        # =>This Loop Header: Depth=1
+                                        #     Child Loop BB0_109 Depth 2
+                                        #       Child Loop BB0_110 Depth 3
+                                        #       Child Loop BB0_113 Depth 3
+                                        #       Child Loop BB0_115 Depth 3
+                                        #     Child Loop BB0_147 Depth 2
+                                        #     Child Loop BB0_153 Depth 2
+                                        #       Child Loop BB0_154 Depth 3
+                                        #       Child Loop BB0_157 Depth 3
+                                        #       Child Loop BB0_159 Depth 3
+                                        #     Child Loop BB0_164 Depth 2
+                                        #       Child Loop BB0_165 Depth 3
+                                        #       Child Loop BB0_168 Depth 3
+                                        #       Child Loop BB0_170 Depth 3
+                                        #     Child Loop BB0_186 Depth 2
+                                        #     Child Loop BB0_202 Depth 2
+                                        #     Child Loop BB0_209 Depth 2
+                                        #     Child Loop BB0_212 Depth 2
+                                        #     Child Loop BB0_220 Depth 2
+                                        #     Child Loop BB0_225 Depth 2
+	mv	s4, s10
+	lui	a0, 544768
+	lw	a0, 16(a0)
+	andi	a3, a0, 1
+	beqz	a3, .LBB0_105
+# %bb.104:                              # %if.then188
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lui	a0, 544768
+	addi	a0, a0, 16
+	sw	a2, 0(a0)
+.LBB0_105:                              # %if.end190
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lui	a1, 528384
+	mv	s10, s3
+	mv	a5, s3
+	lw	a0, 88(sp)                      # 4-byte Folded Reload
+	beq	a0, a2, .LBB0_107
+# %bb.106:                              # %if.end190
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lui	a1, 540672
+	lw	a5, 80(sp)                      # 4-byte Folded Reload
+.LBB0_107:                              # %if.end190
+                                        #   in Loop: Header=BB0_103 Depth=1
+	li	a0, 0
+	sw	a1, 64(sp)                      # 4-byte Folded Spill
+	add	s3, a1, a5
+	andi	a6, a5, 3
+	li	a1, 4
+	sub	a5, a1, a6
+	ori	a7, a6, -4
+	mv	a6, s3
+	j	.LBB0_109
+.LBB0_108:                              # %while.end210
+                                        #   in Loop: Header=BB0_109 Depth=2
+	addi	a0, a0, 1
+	addi	a6, a6, 200
+	beq	a0, t6, .LBB0_116
+.LBB0_109:                              # %while.cond200.preheader
+                                        #   Parent Loop BB0_103 Depth=1
+                                        # =>  This Loop Header: Depth=2
+                                        #       Child Loop BB0_110 Depth 3
+                                        #       Child Loop BB0_113 Depth 3
+                                        #       Child Loop BB0_115 Depth 3
+	andi	a1, s3, 3
+	mv	s0, a7
+	mv	t2, a6
+	beqz	a1, .LBB0_112
+.LBB0_110:                              # %while.body201
+                                        #   Parent Loop BB0_103 Depth=1
+                                        #     Parent Loop BB0_109 Depth=2
+                                        # =>    This Inner Loop Header: Depth=3
+	mv	a1, s0
+	sb	ra, 0(t2)
+	addi	s0, s0, 1
+	addi	t2, t2, 1
+	bgeu	s0, a1, .LBB0_110
+# %bb.111:                              #   in Loop: Header=BB0_109 Depth=2
+	mv	t2, a5
+	j	.LBB0_113
+.LBB0_112:                              #   in Loop: Header=BB0_109 Depth=2
+	li	t2, 0
+.LBB0_113:                              # %while.body206
+                                        #   Parent Loop BB0_103 Depth=1
+                                        #     Parent Loop BB0_109 Depth=2
+                                        # =>    This Inner Loop Header: Depth=3
+	add	a1, a6, t2
+	addi	t2, t2, 4
+	sw	t3, 0(a1)
+	bltu	t2, t4, .LBB0_113
+# %bb.114:                              # %while.cond208.preheader
+                                        #   in Loop: Header=BB0_109 Depth=2
+	beq	t2, t5, .LBB0_108
+.LBB0_115:                              # %while.body209
+                                        #   Parent Loop BB0_103 Depth=1
+                                        #     Parent Loop BB0_109 Depth=2
+                                        # =>    This Inner Loop Header: Depth=3
+	add	a1, a6, t2
+	addi	t2, t2, 1
+	sb	ra, 0(a1)
+	bne	t2, t5, .LBB0_115
+	j	.LBB0_108
+.LBB0_116:                              # %while.end199
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lw	a0, 80(sp)                      # 4-byte Folded Reload
+	mv	s3, s10
+	lw	a1, 88(sp)                      # 4-byte Folded Reload
+	beq	a1, a2, .LBB0_118
+# %bb.117:                              # %while.end199
+                                        #   in Loop: Header=BB0_103 Depth=1
+	mv	a0, s3
+.LBB0_118:                              # %while.end199
+                                        #   in Loop: Header=BB0_103 Depth=1
+	mv	s10, s4
+	lui	a7, 5
+	bnez	a3, .LBB0_123
+# %bb.119:                              # %if.else212
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lw	a3, 24(sp)                      # 4-byte Folded Reload
+	mv	s4, t1
+	li	t1, 1
+	lw	a2, 88(sp)                      # 4-byte Folded Reload
+	beq	a2, t1, .LBB0_121
+# %bb.120:                              # %if.else212
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lw	a3, 8(sp)                       # 4-byte Folded Reload
+.LBB0_121:                              # %if.else212
+                                        #   in Loop: Header=BB0_103 Depth=1
+	add	s0, a3, a0
+	addi	s10, s10, 3
+	bne	a2, t1, .LBB0_127
+# %bb.122:                              # %if.then229
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lw	a0, 80(sp)                      # 4-byte Folded Reload
+	addi	s3, a0, 600
+	j	.LBB0_130
+.LBB0_123:                              # %if.then211
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lw	a3, 20(sp)                      # 4-byte Folded Reload
+	mv	s4, t1
+	li	t1, 1
+	lw	a2, 88(sp)                      # 4-byte Folded Reload
+	beq	a2, t1, .LBB0_125
+# %bb.124:                              # %if.then211
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lw	a3, 4(sp)                       # 4-byte Folded Reload
+.LBB0_125:                              # %if.then211
+                                        #   in Loop: Header=BB0_103 Depth=1
+	add	s0, a3, a0
+	addi	s10, s10, -18
+	bne	a2, t1, .LBB0_128
+# %bb.126:                              # %if.then220
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lw	a0, 80(sp)                      # 4-byte Folded Reload
+	lw	a1, 28(sp)                      # 4-byte Folded Reload
+	add	s3, a0, a1
+	j	.LBB0_130
+.LBB0_127:                              # %if.else230
+                                        #   in Loop: Header=BB0_103 Depth=1
+	addi	a0, s3, 600
+	j	.LBB0_129
+.LBB0_128:                              # %if.else221
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lw	a0, 28(sp)                      # 4-byte Folded Reload
+	add	a0, s3, a0
+.LBB0_129:                              # %if.end213
+                                        #   in Loop: Header=BB0_103 Depth=1
+	sw	a0, 80(sp)                      # 4-byte Folded Spill
+.LBB0_130:                              # %if.end213
+                                        #   in Loop: Header=BB0_103 Depth=1
+	srai	a0, s4, 31
+	srli	a0, a0, 30
+	add	a0, s4, a0
+	andi	a0, a0, -4
+	sub	a0, s4, a0
+	li	a1, 2
+	beq	a0, a1, .LBB0_132
+# %bb.131:                              # %if.end213
+                                        #   in Loop: Header=BB0_103 Depth=1
+	addi	a3, s6, -788
+	j	.LBB0_133
+.LBB0_132:                              #   in Loop: Header=BB0_103 Depth=1
+	addi	a3, s6, 112
+.LBB0_133:                              # %if.end213
+                                        #   in Loop: Header=BB0_103 Depth=1
+	andi	a0, a0, -3
+	li	a1, 1
+	sw	a1, 52(sp)                      # 4-byte Folded Spill
+	bne	a0, a1, .LBB0_135
+# %bb.134:                              #   in Loop: Header=BB0_103 Depth=1
+	addi	a3, s6, -1688
+.LBB0_135:                              # %if.end213
+                                        #   in Loop: Header=BB0_103 Depth=1
+	addi	a5, a2, -1
+	snez	a1, a5
+	addi	a0, a7, -397
+	slt	a6, s3, a0
+	or	a1, a1, a6
+	beqz	a1, .LBB0_138
+# %bb.136:                              # %if.else241
+                                        #   in Loop: Header=BB0_103 Depth=1
+	seqz	a1, a5
+	slti	a5, s3, 682
+	and	a1, a1, a5
+	beqz	a1, .LBB0_139
+# %bb.137:                              #   in Loop: Header=BB0_103 Depth=1
+	li	s3, 682
+	lui	a0, 528384
+	j	.LBB0_142
+.LBB0_138:                              #   in Loop: Header=BB0_103 Depth=1
+	addi	s3, a7, -398
+	lw	s0, 16(sp)                      # 4-byte Folded Reload
+	j	.LBB0_145
+.LBB0_139:                              # %if.else246
+                                        #   in Loop: Header=BB0_103 Depth=1
+	snez	a1, a2
+	lw	a6, 80(sp)                      # 4-byte Folded Reload
+	slt	a0, a6, a0
+	or	a0, a1, a0
+	beqz	a0, .LBB0_143
+# %bb.140:                              # %if.else251
+                                        #   in Loop: Header=BB0_103 Depth=1
+	seqz	a0, a2
+	and	a0, a0, a5
+	beqz	a0, .LBB0_144
+# %bb.141:                              # %if.then255
+                                        #   in Loop: Header=BB0_103 Depth=1
+	li	a0, 682
+	sw	a0, 80(sp)                      # 4-byte Folded Spill
+	lui	a0, 540672
+.LBB0_142:                              # %if.end242
+                                        #   in Loop: Header=BB0_103 Depth=1
+	addi	s0, a0, 682
+	j	.LBB0_145
+.LBB0_143:                              #   in Loop: Header=BB0_103 Depth=1
+	addi	a0, a7, -398
+	sw	a0, 80(sp)                      # 4-byte Folded Spill
+	lw	s0, 0(sp)                       # 4-byte Folded Reload
+	j	.LBB0_145
+.LBB0_144:                              #   in Loop: Header=BB0_103 Depth=1
+	lw	a0, 44(sp)                      # 4-byte Folded Reload
+	sw	a0, 52(sp)                      # 4-byte Folded Spill
+.LBB0_145:                              # %if.end242
+                                        #   in Loop: Header=BB0_103 Depth=1
+	li	a0, 0
+	li	a6, 0
+	li	t2, 0
+	j	.LBB0_147
+.LBB0_146:                              # %while.body261
+                                        #   in Loop: Header=BB0_147 Depth=2
+	addi	t2, t2, 1
+	addi	a1, a5, -36
+	seqz	a1, a1
+	add	a0, a0, a1
+	beq	t2, s9, .LBB0_149
+.LBB0_147:                              # %while.body261
+                                        #   Parent Loop BB0_103 Depth=1
+                                        # =>  This Inner Loop Header: Depth=2
+	slli	a1, a0, 3
+	slli	a5, a0, 6
+	sub	a1, a1, a5
+	slli	a5, a0, 8
+	add	a1, a1, a5
+	add	a5, a3, t2
+	lb	a7, 0(a5)
+	add	a1, s0, a1
+	add	a1, a1, a6
+	addi	a5, a6, 1
+	sb	a7, 0(a1)
+	li	a6, 0
+	beq	a5, t5, .LBB0_146
+# %bb.148:                              # %while.body261
+                                        #   in Loop: Header=BB0_147 Depth=2
+	mv	a6, a5
+	j	.LBB0_146
+.LBB0_149:                              # %while.end262
+                                        #   in Loop: Header=BB0_103 Depth=1
+	sw	s3, 72(sp)                      # 4-byte Folded Spill
+	lw	a0, 76(sp)                      # 4-byte Folded Reload
+	beq	a2, t1, .LBB0_151
+# %bb.150:                              # %while.end262
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lw	a0, 68(sp)                      # 4-byte Folded Reload
+.LBB0_151:                              # %while.end262
+                                        #   in Loop: Header=BB0_103 Depth=1
+	li	a3, 0
+	lw	a7, 64(sp)                      # 4-byte Folded Reload
+	add	t2, a7, a0
+	andi	a0, a0, 3
+	li	a1, 4
+	sub	s3, a1, a0
+	ori	a0, a0, -4
+	mv	s0, t2
+	j	.LBB0_153
+.LBB0_152:                              # %while.end285
+                                        #   in Loop: Header=BB0_153 Depth=2
+	addi	a3, a3, 1
+	addi	s0, s0, 200
+	beq	a3, a4, .LBB0_160
+.LBB0_153:                              # %while.cond275.preheader
+                                        #   Parent Loop BB0_103 Depth=1
+                                        # =>  This Loop Header: Depth=2
+                                        #       Child Loop BB0_154 Depth 3
+                                        #       Child Loop BB0_157 Depth 3
+                                        #       Child Loop BB0_159 Depth 3
+	andi	a1, t2, 3
+	mv	a6, a0
+	mv	a5, s0
+	beqz	a1, .LBB0_156
+.LBB0_154:                              # %while.body276
+                                        #   Parent Loop BB0_103 Depth=1
+                                        #     Parent Loop BB0_153 Depth=2
+                                        # =>    This Inner Loop Header: Depth=3
+	mv	a1, a6
+	sb	ra, 0(a5)
+	addi	a6, a6, 1
+	addi	a5, a5, 1
+	bgeu	a6, a1, .LBB0_154
+# %bb.155:                              #   in Loop: Header=BB0_153 Depth=2
+	mv	a6, s3
+	j	.LBB0_157
+.LBB0_156:                              #   in Loop: Header=BB0_153 Depth=2
+	li	a6, 0
+.LBB0_157:                              # %while.body281
+                                        #   Parent Loop BB0_103 Depth=1
+                                        #     Parent Loop BB0_153 Depth=2
+                                        # =>    This Inner Loop Header: Depth=3
+	add	a1, s0, a6
+	addi	a6, a6, 4
+	sw	t3, 0(a1)
+	bltu	a6, s1, .LBB0_157
+# %bb.158:                              # %while.cond283.preheader
+                                        #   in Loop: Header=BB0_153 Depth=2
+	beq	a6, s7, .LBB0_152
+.LBB0_159:                              # %while.body284
+                                        #   Parent Loop BB0_103 Depth=1
+                                        #     Parent Loop BB0_153 Depth=2
+                                        # =>    This Inner Loop Header: Depth=3
+	add	a1, s0, a6
+	addi	a6, a6, 1
+	sb	ra, 0(a1)
+	bne	a6, s7, .LBB0_159
+	j	.LBB0_152
+.LBB0_160:                              # %while.end274
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lw	a0, 56(sp)                      # 4-byte Folded Reload
+	beq	a2, t1, .LBB0_162
+# %bb.161:                              # %while.end274
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lw	a0, 48(sp)                      # 4-byte Folded Reload
+.LBB0_162:                              # %while.end274
+                                        #   in Loop: Header=BB0_103 Depth=1
+	li	a3, 0
+	add	s0, a7, a0
+	andi	a0, a0, 3
+	li	a1, 4
+	sub	s3, a1, a0
+	ori	a0, a0, -4
+	mv	t2, s0
+	j	.LBB0_164
+.LBB0_163:                              # %while.end305
+                                        #   in Loop: Header=BB0_164 Depth=2
+	addi	a3, a3, 1
+	addi	t2, t2, 200
+	beq	a3, s5, .LBB0_171
+.LBB0_164:                              # %while.cond295.preheader
+                                        #   Parent Loop BB0_103 Depth=1
+                                        # =>  This Loop Header: Depth=2
+                                        #       Child Loop BB0_165 Depth 3
+                                        #       Child Loop BB0_168 Depth 3
+                                        #       Child Loop BB0_170 Depth 3
+	andi	a1, s0, 3
+	mv	a6, a0
+	mv	a5, t2
+	beqz	a1, .LBB0_167
+.LBB0_165:                              # %while.body296
+                                        #   Parent Loop BB0_103 Depth=1
+                                        #     Parent Loop BB0_164 Depth=2
+                                        # =>    This Inner Loop Header: Depth=3
+	mv	a1, a6
+	sb	ra, 0(a5)
+	addi	a6, a6, 1
+	addi	a5, a5, 1
+	bgeu	a6, a1, .LBB0_165
+# %bb.166:                              #   in Loop: Header=BB0_164 Depth=2
+	mv	a6, s3
+	j	.LBB0_168
+.LBB0_167:                              #   in Loop: Header=BB0_164 Depth=2
+	li	a6, 0
+.LBB0_168:                              # %while.body301
+                                        #   Parent Loop BB0_103 Depth=1
+                                        #     Parent Loop BB0_164 Depth=2
+                                        # =>    This Inner Loop Header: Depth=3
+	add	a1, t2, a6
+	addi	a6, a6, 4
+	sw	t3, 0(a1)
+	bltu	a6, s1, .LBB0_168
+# %bb.169:                              # %while.cond303.preheader
+                                        #   in Loop: Header=BB0_164 Depth=2
+	beq	a6, s7, .LBB0_163
+.LBB0_170:                              # %while.body304
+                                        #   Parent Loop BB0_103 Depth=1
+                                        #     Parent Loop BB0_164 Depth=2
+                                        # =>    This Inner Loop Header: Depth=3
+	add	a1, t2, a6
+	addi	a6, a6, 1
+	sb	ra, 0(a1)
+	bne	a6, s7, .LBB0_170
+	j	.LBB0_163
+.LBB0_171:                              # %while.end294
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lw	a0, 84(sp)                      # 4-byte Folded Reload
+	beqz	a0, .LBB0_174
+# %bb.172:                              # %if.else307
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lw	s3, 68(sp)                      # 4-byte Folded Reload
+	beq	a2, t1, .LBB0_177
+# %bb.173:                              # %if.else307
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lui	a0, 540672
+	addi	a3, a0, 395
+	li	s3, 395
+	j	.LBB0_178
+.LBB0_174:                              # %if.then306
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lw	s3, 68(sp)                      # 4-byte Folded Reload
+	beq	a2, t1, .LBB0_179
+# %bb.175:                              # %if.then306
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lui	a0, 540672
+	addi	a0, a0, -5
+	lw	a3, 76(sp)                      # 4-byte Folded Reload
+	bne	a2, t1, .LBB0_180
+.LBB0_176:                              #   in Loop: Header=BB0_103 Depth=1
+	addi	a1, s3, -5
+	sw	a1, 76(sp)                      # 4-byte Folded Spill
+	j	.LBB0_181
+.LBB0_177:                              #   in Loop: Header=BB0_103 Depth=1
+	lui	a0, 528384
+	addi	a3, a0, 395
+	li	a0, 395
+	sw	a0, 76(sp)                      # 4-byte Folded Spill
+.LBB0_178:                              # %if.else307
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lw	a0, 84(sp)                      # 4-byte Folded Reload
+	addi	a0, a0, -1
+	sw	a0, 84(sp)                      # 4-byte Folded Spill
+	li	a0, 195
+	sw	a0, 60(sp)                      # 4-byte Folded Spill
+	j	.LBB0_184
+.LBB0_179:                              #   in Loop: Header=BB0_103 Depth=1
+	lui	a0, 528384
+	addi	a0, a0, -5
+	mv	a3, s3
+	beq	a2, t1, .LBB0_176
+.LBB0_180:                              # %if.then306
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lw	a1, 76(sp)                      # 4-byte Folded Reload
+	addi	s3, a1, -5
+.LBB0_181:                              # %if.then306
+                                        #   in Loop: Header=BB0_103 Depth=1
+	seqz	a1, a2
+	slti	a5, s3, 161
+	and	a5, a1, a5
+	bne	a2, t1, .LBB0_183
+# %bb.182:                              #   in Loop: Header=BB0_103 Depth=1
+	lw	a1, 76(sp)                      # 4-byte Folded Reload
+	slti	a1, a1, 161
+	or	a5, a5, a1
+.LBB0_183:                              # %if.then306
+                                        #   in Loop: Header=BB0_103 Depth=1
+	add	a3, a0, a3
+	lw	a0, 60(sp)                      # 4-byte Folded Reload
+	addi	a0, a0, -5
+	sw	a0, 60(sp)                      # 4-byte Folded Spill
+	slli	a0, a5, 1
+	sw	a0, 84(sp)                      # 4-byte Folded Spill
+.LBB0_184:                              # %if.end308
+                                        #   in Loop: Header=BB0_103 Depth=1
+	li	a0, 0
+	li	a6, 0
+	li	t2, 0
+	j	.LBB0_186
+.LBB0_185:                              # %while.body334
+                                        #   in Loop: Header=BB0_186 Depth=2
+	addi	t2, t2, 1
+	addi	a1, a5, -50
+	seqz	a1, a1
+	add	a0, a0, a1
+	beq	t2, s2, .LBB0_188
+.LBB0_186:                              # %while.body334
+                                        #   Parent Loop BB0_103 Depth=1
+                                        # =>  This Inner Loop Header: Depth=2
+	slli	a1, a0, 3
+	slli	a5, a0, 6
+	sub	a1, a1, a5
+	slli	a5, a0, 8
+	add	a1, a1, a5
+	add	a5, t2, s8
+	lb	a7, 0(a5)
+	add	a1, a3, a1
+	add	a1, a1, a6
+	addi	a5, a6, 1
+	sb	a7, 0(a1)
+	li	a6, 0
+	beq	a5, s7, .LBB0_185
+# %bb.187:                              # %while.body334
+                                        #   in Loop: Header=BB0_186 Depth=2
+	mv	a6, a5
+	j	.LBB0_185
+.LBB0_188:                              # %while.end335
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lw	a3, 76(sp)                      # 4-byte Folded Reload
+	beq	a2, t1, .LBB0_190
+# %bb.189:                              # %while.end335
+                                        #   in Loop: Header=BB0_103 Depth=1
+	mv	a3, s3
+.LBB0_190:                              # %while.end335
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lw	a0, 84(sp)                      # 4-byte Folded Reload
+	andi	a0, a0, -3
+	lui	a1, 5
+	sw	s3, 68(sp)                      # 4-byte Folded Spill
+	beqz	a0, .LBB0_193
+# %bb.191:                              # %if.else351
+                                        #   in Loop: Header=BB0_103 Depth=1
+	addi	a0, a1, -1285
+	beq	a2, t1, .LBB0_196
+# %bb.192:                              # %if.else351
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lui	a1, 540677
+	addi	s0, a1, -1285
+	sw	a0, 48(sp)                      # 4-byte Folded Spill
+	j	.LBB0_197
+.LBB0_193:                              # %if.then350
+                                        #   in Loop: Header=BB0_103 Depth=1
+	beq	a2, t1, .LBB0_198
+# %bb.194:                              # %if.then350
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lui	a0, 540672
+	addi	a0, a0, -5
+	lw	a5, 56(sp)                      # 4-byte Folded Reload
+	add	s0, a0, a5
+	beq	a2, t1, .LBB0_199
+.LBB0_195:                              # %if.else362
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lw	a0, 56(sp)                      # 4-byte Folded Reload
+	addi	a0, a0, -5
+	sw	a0, 48(sp)                      # 4-byte Folded Spill
+	j	.LBB0_200
+.LBB0_196:                              #   in Loop: Header=BB0_103 Depth=1
+	lui	a1, 528389
+	addi	s0, a1, -1285
+	sw	a0, 56(sp)                      # 4-byte Folded Spill
+.LBB0_197:                              # %if.else351
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lw	a0, 84(sp)                      # 4-byte Folded Reload
+	addi	a0, a0, -1
+	sw	a0, 84(sp)                      # 4-byte Folded Spill
+	j	.LBB0_200
+.LBB0_198:                              #   in Loop: Header=BB0_103 Depth=1
+	lui	a0, 528384
+	addi	a0, a0, -5
+	lw	a5, 48(sp)                      # 4-byte Folded Reload
+	add	s0, a0, a5
+	bne	a2, t1, .LBB0_195
+.LBB0_199:                              # %if.then361
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lw	a0, 48(sp)                      # 4-byte Folded Reload
+	addi	a0, a0, -5
+	sw	a0, 56(sp)                      # 4-byte Folded Spill
+.LBB0_200:                              # %if.end352
+                                        #   in Loop: Header=BB0_103 Depth=1
+	li	a0, 0
+	li	a6, 0
+	li	s3, 0
+	addi	t2, a3, -401
+	j	.LBB0_202
+.LBB0_201:                              # %while.body371
+                                        #   in Loop: Header=BB0_202 Depth=2
+	addi	s3, s3, 1
+	addi	a1, a5, -50
+	seqz	a1, a1
+	add	a0, a0, a1
+	beq	s3, t0, .LBB0_204
+.LBB0_202:                              # %while.body371
+                                        #   Parent Loop BB0_103 Depth=1
+                                        # =>  This Inner Loop Header: Depth=2
+	slli	a1, a0, 3
+	slli	a5, a0, 6
+	sub	a1, a1, a5
+	slli	a5, a0, 8
+	add	a1, a1, a5
+	addi	a5, s6, 1012
+	add	a5, s3, a5
+	lb	a7, 0(a5)
+	add	a1, s0, a1
+	add	a1, a1, a6
+	addi	a5, a6, 1
+	sb	a7, 0(a1)
+	li	a6, 0
+	beq	a5, s7, .LBB0_201
+# %bb.203:                              # %while.body371
+                                        #   in Loop: Header=BB0_202 Depth=2
+	mv	a6, a5
+	j	.LBB0_201
+.LBB0_204:                              # %while.end372
+                                        #   in Loop: Header=BB0_103 Depth=1
+	li	a0, -56
+	bgeu	t2, a0, .LBB0_208
+# %bb.205:                              # %if.else377
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lw	s3, 72(sp)                      # 4-byte Folded Reload
+	li	a0, 200
+	lui	a5, 5
+	li	a6, 1000
+	blt	a0, a3, .LBB0_213
+# %bb.206:                              # %if.then396
+                                        #   in Loop: Header=BB0_103 Depth=1
+	beq	a2, t1, .LBB0_210
+# %bb.207:                              # %if.then396
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lui	a0, 540672
+	j	.LBB0_211
+.LBB0_208:                              # %while.end395.preheader
+                                        #   in Loop: Header=BB0_103 Depth=1
+	li	a0, 0
+	lw	a1, 64(sp)                      # 4-byte Folded Reload
+	addi	a1, a1, 24
+	lw	s3, 72(sp)                      # 4-byte Folded Reload
+	lui	a5, 5
+	li	a6, 1000
+.LBB0_209:                              # %while.end395
+                                        #   Parent Loop BB0_103 Depth=1
+                                        # =>  This Inner Loop Header: Depth=2
+	sw	t3, -24(a1)
+	sw	t3, -20(a1)
+	sw	t3, -16(a1)
+	sw	t3, -12(a1)
+	sw	t3, -8(a1)
+	sw	t3, -4(a1)
+	sw	t3, 0(a1)
+	sw	t3, 4(a1)
+	sw	t3, 8(a1)
+	sw	t3, 12(a1)
+	sw	t3, 16(a1)
+	sw	t3, 20(a1)
+	addi	a3, a5, 1879
+	sh	a3, 24(a1)
+	addi	a0, a0, 8
+	addi	a1, a1, 200
+	bne	a0, a6, .LBB0_209
+	j	.LBB0_213
+.LBB0_210:                              #   in Loop: Header=BB0_103 Depth=1
+	lui	a0, 528384
+.LBB0_211:                              # %if.then396
+                                        #   in Loop: Header=BB0_103 Depth=1
+	addi	a0, a0, 176
+	li	a1, 0
+.LBB0_212:                              # %while.cond405.preheader
+                                        #   Parent Loop BB0_103 Depth=1
+                                        # =>  This Inner Loop Header: Depth=2
+	addi	a3, a5, 1879
+	sh	a3, -26(a0)
+	sw	t3, -24(a0)
+	sw	t3, -20(a0)
+	sw	t3, -16(a0)
+	sw	t3, -12(a0)
+	sw	t3, -8(a0)
+	sw	t3, -4(a0)
+	sw	t3, 0(a0)
+	sw	t3, 4(a0)
+	sw	t3, 8(a0)
+	sw	t3, 12(a0)
+	sw	t3, 16(a0)
+	sw	t3, 20(a0)
+	addi	a1, a1, 8
+	addi	a0, a0, 200
+	bne	a1, a6, .LBB0_212
+.LBB0_213:                              # %if.end378
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lw	a0, 60(sp)                      # 4-byte Folded Reload
+	addi	a0, a0, -111
+	li	a1, -71
+	bltu	a0, a1, .LBB0_215
+# %bb.214:                              # %land.rhs419
+                                        #   in Loop: Header=BB0_103 Depth=1
+	slti	a0, s10, 40
+	addi	a1, s10, 25
+	li	a3, 94
+	slt	a1, a3, a1
+	or	a0, a0, a1
+	li	a1, 1
+	bnez	a0, .LBB0_216
+.LBB0_215:                              # %land.end420.thread
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lw	a1, 52(sp)                      # 4-byte Folded Reload
+	blez	a1, .LBB0_223
+.LBB0_216:                              # %if.then425
+                                        #   in Loop: Header=BB0_103 Depth=1
+	sw	a1, 44(sp)                      # 4-byte Folded Spill
+	lw	a0, 40(sp)                      # 4-byte Folded Reload
+	beq	a2, t1, .LBB0_218
+# %bb.217:                              # %if.then425
+                                        #   in Loop: Header=BB0_103 Depth=1
+	lw	a0, 12(sp)                      # 4-byte Folded Reload
+.LBB0_218:                              # %if.then425
+                                        #   in Loop: Header=BB0_103 Depth=1
+	li	a1, 0
+	li	t2, 0
+	lw	a3, 32(sp)                      # 4-byte Folded Reload
+	lw	a6, 36(sp)                      # 4-byte Folded Reload
+	li	a2, 150
+	j	.LBB0_220
+.LBB0_219:                              # %while.body432
+                                        #   in Loop: Header=BB0_220 Depth=2
+	addi	a5, a5, -150
+	seqz	a5, a5
+	add	a1, a1, a5
+	addi	a6, a6, -1
+	addi	a3, a3, 1
+	beqz	a6, .LBB0_222
+.LBB0_220:                              # %while.body432
+                                        #   Parent Loop BB0_103 Depth=1
+                                        # =>  This Inner Loop Header: Depth=2
+	slli	a5, a1, 3
+	slli	a7, a1, 6
+	sub	a5, a5, a7
+	slli	a7, a1, 8
+	add	a5, a5, a7
+	lb	a7, 0(a3)
+	add	a5, a0, a5
+	add	s0, a5, t2
+	addi	a5, t2, 1
+	sb	a7, 0(s0)
+	li	t2, 0
+	beq	a5, a2, .LBB0_219
+# %bb.221:                              # %while.body432
+                                        #   in Loop: Header=BB0_220 Depth=2
+	mv	t2, a5
+	j	.LBB0_219
+.LBB0_222:                              #   in Loop: Header=BB0_103 Depth=1
+	li	a0, 1
+	j	.LBB0_224
+.LBB0_223:                              #   in Loop: Header=BB0_103 Depth=1
+	li	a0, 0
+	sw	a1, 44(sp)                      # 4-byte Folded Spill
+.LBB0_224:                              # %if.end427
+                                        #   in Loop: Header=BB0_103 Depth=1
+	addi	a1, s4, 1
+	li	a2, 1
+	lw	a3, 88(sp)                      # 4-byte Folded Reload
+	sub	a3, t1, a3
+	sw	a3, 88(sp)                      # 4-byte Folded Spill
+	sw	a3, 4(s11)
+.LBB0_225:                              # %while.cond440
+                                        #   Parent Loop BB0_103 Depth=1
+                                        # =>  This Inner Loop Header: Depth=2
+	lw	a3, 8(s11)
+	andi	a3, a3, 1
+	bnez	a3, .LBB0_225
+# %bb.226:                              # %while.cond443.preheader
+                                        #   in Loop: Header=BB0_103 Depth=1
+	li	t1, 0
+	li	a3, 5
+	beq	a1, a3, .LBB0_102
+# %bb.227:                              # %while.cond443.preheader
+                                        #   in Loop: Header=BB0_103 Depth=1
+	mv	t1, a1
+	j	.LBB0_102
+.LBB0_228:                              # %while.end187
+	li	a0, 0
+	lw	ra, 140(sp)                     # 4-byte Folded Reload
+	lw	s0, 136(sp)                     # 4-byte Folded Reload
+	lw	s1, 132(sp)                     # 4-byte Folded Reload
+	lw	s2, 128(sp)                     # 4-byte Folded Reload
+	lw	s3, 124(sp)                     # 4-byte Folded Reload
+	lw	s4, 120(sp)                     # 4-byte Folded Reload
+	lw	s5, 116(sp)                     # 4-byte Folded Reload
+	lw	s6, 112(sp)                     # 4-byte Folded Reload
+	lw	s7, 108(sp)                     # 4-byte Folded Reload
+	lw	s8, 104(sp)                     # 4-byte Folded Reload
+	lw	s9, 100(sp)                     # 4-byte Folded Reload
+	lw	s10, 96(sp)                     # 4-byte Folded Reload
+	lw	s11, 92(sp)                     # 4-byte Folded Reload
+	addi	sp, sp, 144
+	ret
+.Lfunc_end0:
+	.size	main, .Lfunc_end0-main
+                                        # -- End function
+	.section	".note.GNU-stack","",@progbits
@@ -0,0 +1,784 @@
+#include "rv32_core.h"
+
+#include <cstring>
+
+namespace {
+
+// CSR 地址，与 headers/csr.vh 相同
+const uint32_t CSR_MSTATUS = 0x300;
+const uint32_t CSR_MEDELEG = 0x302;
+const uint32_t CSR_MIDELEG = 0x303;
+const uint32_t CSR_MIE = 0x304;
+const uint32_t CSR_MTVEC = 0x305;
+const uint32_t CSR_MCOUNTEREN = 0x306;
+const uint32_t CSR_MENVCFG = 0x30a;
+const uint32_t CSR_MENVCFGH = 0x31a;
+const uint32_t CSR_MCOUNTINHIBIT = 0x320;
+const uint32_t CSR_MSCRATCH = 0x340;
+const uint32_t CSR_MEPC = 0x341;
+const uint32_t CSR_MCAUSE = 0x342;
+const uint32_t CSR_MTVAL = 0x343;
+const uint32_t CSR_MIP = 0x344;
+const uint32_t CSR_MIRQLAT = 0x7c0;
+const uint32_t CSR_MHARTID = 0xf14;
+const uint32_t CSR_SSTATUS = 0x100;
+const uint32_t CSR_SIE = 0x104;
+const uint32_t CSR_STVEC = 0x105;
+const uint32_t CSR_SCOUNTEREN = 0x106;
+const uint32_t CSR_SSCRATCH = 0x140;
+const uint32_t CSR_SEPC = 0x141;
+const uint32_t CSR_SCAUSE = 0x142;
+const uint32_t CSR_STVAL = 0x143;
+const uint32_t CSR_SIP = 0x144;
+const uint32_t CSR_STIMECMP = 0x14d;
+const uint32_t CSR_STIMECMPH = 0x15d;
+const uint32_t CSR_SATP = 0x180;
+const uint32_t CSR_TIME = 0xc01;
+const uint32_t CSR_TIMEH = 0xc81;
+
+// mstatus 的字段
+const uint32_t MSTATUS_UIE = 1u << 0;
+const uint32_t MSTATUS_SIE = 1u << 1;
+const uint32_t MSTATUS_MIE = 1u << 3;
+const uint32_t MSTATUS_UPIE = 1u << 4;
+const uint32_t MSTATUS_SPIE = 1u << 5;
+const uint32_t MSTATUS_MPIE = 1u << 7;
+const uint32_t MSTATUS_SPP = 1u << 8;
+const uint32_t MSTATUS_MPP_SHIFT = 11;
+const uint32_t MSTATUS_MPP = 3u << MSTATUS_MPP_SHIFT;
+// sstatus 中可见的字段：SD、MXR、SUM、XS、FS、SPP、SPIE、UPIE、SIE、UIE
+const uint32_t SSTATUS_MASK = 0x800de133;
+
+// mip/mie 中的 M、S、U 三级中断，以及 sip/sie 可见的部分
+const uint32_t IRQ_M_MASK = 0x888;
+const uint32_t IRQ_S_MASK = 0x222;
+const uint32_t IRQ_U_MASK = 0x111;
+const uint32_t SIP_MASK = 0x333;
+const uint32_t MIP_STIP = 1u << 5;
+
+const uint32_t EXC_INSTRUCTION_ADDRESS_MISALIGNED = 0;
+const uint32_t EXC_INSTRUCTION_ACCESS_FAULT = 1;
+const uint32_t EXC_ILLEGAL_INSTRUCTION = 2;
+const uint32_t EXC_BREAKPOINT = 3;
+const uint32_t EXC_LOAD_ADDRESS_MISALIGNED = 4;
+const uint32_t EXC_LOAD_ACCESS_FAULT = 5;
+const uint32_t EXC_STORE_ADDRESS_MISALIGNED = 6;
+const uint32_t EXC_STORE_ACCESS_FAULT = 7;
+const uint32_t EXC_ECALL_FROM_U_MODE = 8;
+const uint32_t EXC_INSTRUCTION_PAGE_FAULT = 12;
+const uint32_t EXC_LOAD_PAGE_FAULT = 13;
+const uint32_t EXC_STORE_PAGE_FAULT = 15;
+
+const uint32_t HPM_COUNTER_FIRST = 3;
+const uint32_t HPM_COUNTER_LAST = 10;
+const uint32_t HPM_COUNTER_MASK = 0x7ff;
+
+// 页表项
+const uint32_t PTE_V = 1u << 0;
+const uint32_t PTE_R = 1u << 1;
+const uint32_t PTE_W = 1u << 2;
+const uint32_t PTE_X = 1u << 3;
+
+// 译码后的操作
+enum Op : uint8_t {
+    OP_ILLEGAL,
+    OP_LUI, OP_AUIPC, OP_JAL, OP_JALR,
+    OP_BEQ, OP_BNE, OP_BLT, OP_BGE, OP_BLTU, OP_BGEU,
+    OP_LB, OP_LH, OP_LW, OP_LBU, OP_LHU, OP_SB, OP_SH, OP_SW,
+    OP_ADDI, OP_SLTI, OP_SLTIU, OP_XORI, OP_ORI, OP_ANDI, OP_SLLI, OP_SRLI, OP_SRAI,
+    OP_ADD, OP_SUB, OP_SLL, OP_SLT, OP_SLTU, OP_XOR, OP_SRL, OP_SRA, OP_OR, OP_AND,
+    OP_SBCLR, OP_MIN, OP_PACK, OP_XPERM8,
+    OP_ECALL, OP_EBREAK, OP_SRET, OP_MRET, OP_NOP,
+    // 同一组中的顺序与 funct3 相同
+    OP_CSRRW, OP_CSRRS, OP_CSRRC, OP_CSRRWI, OP_CSRRSI, OP_CSRRCI,
+};
+
+// 译码缓存按物理地址直接映射，取指的物理地址总是 4 字节对齐
+const uint32_t DECODE_CACHE_SIZE = 1 << 16;
+const uint32_t INVALID_PADDR = 1;
+
+inline int32_t sext(uint32_t value, int bits) {
+    return static_cast<int32_t>(value << (32 - bits)) >> (32 - bits);
+}
+
+inline uint32_t imm_i(uint32_t instr) { return static_cast<int32_t>(instr) >> 20; }
+
+inline uint32_t imm_s(uint32_t instr) {
+    return (static_cast<int32_t>(instr) >> 25 << 5) | ((instr >> 7) & 0x1f);
+}
+
+inline uint32_t imm_b(uint32_t instr) {
+    return sext((instr >> 31) << 12 | ((instr >> 7) & 1) << 11 | ((instr >> 25) & 0x3f) << 5 |
+                    ((instr >> 8) & 0xf) << 1,
+                13);
+}
+
+inline uint32_t imm_j(uint32_t instr) {
+    return sext((instr >> 31) << 20 | ((instr >> 12) & 0xff) << 12 | ((instr >> 20) & 1) << 11 |
+                    ((instr >> 21) & 0x3ff) << 1,
+                21);
+}
+
+// 计数器 CSR：cycle/time/instret/hpmcounter 及其高半部分
+inline bool is_counter(uint32_t addr) { return (addr >> 8) == 0xc && ((addr >> 5) & 3) == 0; }
+inline bool is_mcounter(uint32_t addr) { return (addr >> 8) == 0xb && ((addr >> 5) & 3) == 0; }
+inline bool is_mhpmevent(uint32_t addr) { return (addr >> 5) == 0x19; }
+inline bool is_stimecmp(uint32_t addr) {
+    return addr == CSR_STIMECMP || addr == CSR_STIMECMPH;
+}
+
+inline void set_lo(uint64_t &reg, uint32_t value) { reg = (reg & ~0xffffffffull) | value; }
+inline void set_hi(uint64_t &reg, uint32_t value) {
+    reg = (reg & 0xffffffffull) | static_cast<uint64_t>(value) << 32;
+}
+
+}  // namespace
+
+bool rv32_phy_addr_valid(uint64_t paddr) {
+    return (paddr >= 0x10000000 && paddr <= 0x1000ffff) ||
+           (paddr >= 0x0c000000 && paddr <= 0x0fffffff) ||
+           paddr == 0x2004000 || paddr == 0x2004004 ||  // mtimecmp
+           paddr == 0x200bff8 || paddr == 0x200bffc ||  // mtime
+           (paddr >= 0x80000000 && paddr <= 0x807fffff) ||
+           (paddr >= 0x81000000 && paddr <= 0x8cffffff);  // BRAM、boot ROM、flash 和各个外设
+}
+
+Rv32Core::Rv32Core(RvBus &bus) : bus(bus) { reset(0x82000000); }
+
+void Rv32Core::reset(uint32_t reset_pc) {
+    pc = reset_pc;
+    priv = PRIV_M;
+    memset(x, 0, sizeof(x));
+
+    mstatus = mtvec = mip = mie = mscratch = mepc = mcause = mtval = 0;
+    mhartid = medeleg = mideleg = 0;
+    stce = false;
+    sepc = scause = stval = stvec = sscratch = satp = 0;
+    // 很远的将来，设置之前不会产生 S 态时钟中断
+    stimecmp = ~0ull;
+    time = 0;
+
+    mcycle = minstret = 0;
+    memset(mhpmcounter, 0, sizeof(mhpmcounter));
+    memset(mhpmevent, 0, sizeof(mhpmevent));
+    mcountinhibit = 0;
+    mcounteren = scounteren = HPM_COUNTER_MASK;
+    mirqlat = 0;
+}
+
+void Rv32Core::set_irq(uint32_t mip_bit, bool level) {
+    if (level) {
+        mip |= mip_bit;
+    } else {
+        mip &= ~mip_bit;
+    }
+}
+
+void Rv32Core::set_time(uint64_t t) {
+    time = t;
+    if (stce) {
+        set_irq(MIP_STIP, time >= stimecmp);
+    }
+}
+
+// ==== 地址转换 ====
+// 与 mmu.sv 相同：satp.MODE 为 0 或在 M 态时直接使用虚拟地址；否则每次都查两级页表
+
+uint32_t Rv32Core::translate(uint32_t vaddr, Access access, uint64_t &paddr) {
+    static const uint32_t page_fault[] = {EXC_INSTRUCTION_PAGE_FAULT, EXC_LOAD_PAGE_FAULT,
+                                          EXC_STORE_PAGE_FAULT};
+    static const uint32_t access_fault[] = {EXC_INSTRUCTION_ACCESS_FAULT, EXC_LOAD_ACCESS_FAULT,
+                                            EXC_STORE_ACCESS_FAULT};
+
+    if (!(satp >> 31) || priv == PRIV_M) {
+        paddr = vaddr;
+    } else {
+        uint64_t table = static_cast<uint64_t>(satp & 0x3fffff) << 12;
+        uint32_t vpn[2] = {(vaddr >> 12) & 0x3ff, vaddr >> 22};
+        for (int level = 1;; level--) {
+            // 页表项的地址在总线上只有低 32 位
+            uint32_t pte_addr = static_cast<uint32_t>(table + vpn[level] * 4);
+            uint32_t pte = rv32_phy_addr_valid(pte_addr) ? bus.read(pte_addr, 4) : 0;
+            if (!(pte & PTE_V) || (!(pte & PTE_R) && (pte & PTE_W))) {
+                return page_fault[access];
+            }
+            uint64_t ppn = pte >> 10;
+            if (pte & (PTE_R | PTE_X)) {
+                static const uint32_t need[] = {PTE_X, PTE_R, PTE_W};
+                if (!(pte & need[access])) {
+                    return page_fault[access];
+                }
+                if (level == 1) {
+                    // 大页的 PPN[0] 必须为 0
+                    if (ppn & 0x3ff) {
+                        return page_fault[access];
+                    }
+                    paddr = ppn << 12 | (vaddr & 0x3fffff);
+                } else {
+                    paddr = ppn << 12 | (vaddr & 0xfff);
+                }
+                break;
+            }
+            if (level == 0) {
+                return page_fault[access];
+            }
+            table = ppn << 12;
+        }
+    }
+    return rv32_phy_addr_valid(paddr) ? 0 : access_fault[access];
+}
+
+// ==== CSR ====
+
+bool Rv32Core::csr_invalid(uint32_t addr, bool write) const {
+    if (priv < ((addr >> 8) & 3)) {
+        return true;
+    }
+    if (is_stimecmp(addr) && priv != PRIV_M && !stce) {
+        return true;
+    }
+    if (write) {
+        return (addr >> 10) == 3;
+    }
+    if (is_counter(addr)) {
+        uint32_t bit = 1u << (addr & 0x1f);
+        if (priv != PRIV_M && !(mcounteren & bit)) {
+            return true;
+        }
+        if (priv == PRIV_U && !(scounteren & bit)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Rv32Core::csr_is_volatile(uint32_t addr) const {
+    return addr == CSR_MIP || addr == CSR_SIP || addr == CSR_MIRQLAT || is_counter(addr) ||
+           is_mcounter(addr);
+}
+
+uint32_t Rv32Core::csr(uint32_t addr) const {
+    switch (addr) {
+    case CSR_MSTATUS: return mstatus;
+    case CSR_MTVEC: return mtvec;
+    case CSR_MIP: return mip;
+    case CSR_MIE: return mie;
+    case CSR_MSCRATCH: return mscratch;
+    case CSR_MEPC: return mepc;
+    case CSR_MCAUSE: return mcause;
+    case CSR_MHARTID: return mhartid;
+    case CSR_MEDELEG: return medeleg;
+    case CSR_MIDELEG: return mideleg;
+    case CSR_MTVAL: return mtval;
+    case CSR_MIRQLAT: return mirqlat;
+    case CSR_MENVCFG: return 0;
+    case CSR_MENVCFGH: return stce ? 1u << 31 : 0;
+    case CSR_MCOUNTEREN: return mcounteren;
+    case CSR_MCOUNTINHIBIT: return mcountinhibit;
+    case CSR_SCOUNTEREN: return scounteren;
+    case CSR_SSTATUS: return mstatus & SSTATUS_MASK;
+    case CSR_SEPC: return sepc;
+    case CSR_SCAUSE: return scause;
+    case CSR_STVAL: return stval;
+    case CSR_STVEC: return stvec;
+    case CSR_SSCRATCH: return sscratch;
+    case CSR_SIE: return mie & SIP_MASK;
+    case CSR_SIP: return mip & SIP_MASK;
+    case CSR_SATP: return satp;
+    case CSR_STIMECMP: return static_cast<uint32_t>(stimecmp);
+    case CSR_STIMECMPH: return static_cast<uint32_t>(stimecmp >> 32);
+    case CSR_TIME: return static_cast<uint32_t>(time);
+    case CSR_TIMEH: return static_cast<uint32_t>(time >> 32);
+    default: break;
+    }
+
+    uint32_t index = addr & 0x1f;
+    if (is_counter(addr) || is_mcounter(addr)) {
+        uint64_t value = 0;
+        if (index == 0) {
+            value = mcycle;
+        } else if (index == 1 && is_counter(addr)) {  // 没有 mtime CSR
+            value = time;
+        } else if (index == 2) {
+            value = minstret;
+        } else if (index >= HPM_COUNTER_FIRST && index <= HPM_COUNTER_LAST) {
+            value = mhpmcounter[index];
+        }
+        return (addr & 0x80) ? static_cast<uint32_t>(value >> 32) : static_cast<uint32_t>(value);
+    }
+    if (is_mhpmevent(addr) && index >= HPM_COUNTER_FIRST && index <= HPM_COUNTER_LAST) {
+        return mhpmevent[index];
+    }
+    return 0;
+}
+
+void Rv32Core::csr_write(uint32_t addr, uint32_t value) {
+    switch (addr) {
+    case CSR_MSTATUS: mstatus = value; return;
+    case CSR_MTVEC:
+        // 只支持直接模式和向量模式
+        if ((value & 3) < 2) mtvec = value;
+        return;
+    case CSR_MIP:
+        // 软件只能写 STIP，而且 STCE 置位时 STIP 由 stimecmp 决定
+        if (priv == PRIV_M && !stce) set_irq(MIP_STIP, value & MIP_STIP);
+        return;
+    case CSR_MIE: mie = value; return;
+    case CSR_MSCRATCH: mscratch = value; return;
+    case CSR_MEPC: mepc = value & ~3u; return;
+    case CSR_MCAUSE:
+        mcause = (value & 0x80000000) | ((value & 0x7fffffff) < 16 ? value & 0x7fffffff
+                                                                     : mcause & 0x7fffffff);
+        return;
+    case CSR_MTVAL: mtval = value; return;
+    case CSR_MHARTID: mhartid = value; return;
+    case CSR_MEDELEG: medeleg = value & ~(1u << 11); return;
+    case CSR_MIDELEG: mideleg = value; return;
+    case CSR_MENVCFGH: stce = value >> 31; return;
+    case CSR_MIRQLAT: mirqlat = value; return;
+    case CSR_MCOUNTEREN: mcounteren = value & HPM_COUNTER_MASK; return;
+    case CSR_SCOUNTEREN: scounteren = value & HPM_COUNTER_MASK; return;
+    // time 不能禁止
+    case CSR_MCOUNTINHIBIT: mcountinhibit = value & HPM_COUNTER_MASK & ~2u; return;
+    case CSR_SSTATUS: {
+        const uint32_t mask = MSTATUS_SPP | MSTATUS_SPIE | MSTATUS_UPIE | MSTATUS_SIE | MSTATUS_UIE;
+        mstatus = (mstatus & ~mask) | (value & mask);
+        return;
+    }
+    case CSR_SEPC: sepc = value & ~3u; return;
+    case CSR_SCAUSE:
+        scause = (value & 0x80000000) | ((value & 0x7fffffff) < 16 ? value & 0x7fffffff
+                                                                     : scause & 0x7fffffff);
+        return;
+    case CSR_STVAL: stval = value; return;
+    case CSR_STVEC:
+        if ((value & 3) < 2) stvec = value;
+        return;
+    case CSR_SSCRATCH: sscratch = value; return;
+    case CSR_SIE: mie = (mie & ~SIP_MASK) | (value & SIP_MASK); return;
+    case CSR_SATP: satp = value; return;
+    case CSR_STIMECMP: set_lo(stimecmp, value); return;
+    case CSR_STIMECMPH: set_hi(stimecmp, value); return;
+    default: break;
+    }
+
+    uint32_t index = addr & 0x1f;
+    bool hi = addr & 0x80;
+    if (is_mcounter(addr)) {
+        uint64_t *reg = nullptr;
+        if (index == 0) {
+            reg = &mcycle;
+        } else if (index == 2) {
+            reg = &minstret;
+        } else if (index >= HPM_COUNTER_FIRST && index <= HPM_COUNTER_LAST) {
+            reg = &mhpmcounter[index];
+        }
+        if (reg) {
+            if (hi) set_hi(*reg, value);
+            else set_lo(*reg, value);
+        }
+    } else if (is_mhpmevent(addr) && index >= HPM_COUNTER_FIRST && index <= HPM_COUNTER_LAST) {
+        mhpmevent[index] = value & 0x1f;
+    }
+}
+
+// ==== 中断和异常 ====
+
+int Rv32Core::pending_interrupt() const {
+    uint32_t pending = mip & mie;
+    uint32_t m = pending & IRQ_M_MASK, s = pending & IRQ_S_MASK, u = pending & IRQ_U_MASK;
+    bool occur;
+    switch (priv) {
+    case PRIV_M: occur = m && (mstatus & MSTATUS_MIE); break;
+    case PRIV_S: occur = m || (s && (mstatus & MSTATUS_SIE)); break;
+    default: occur = m || s || (u && (mstatus & MSTATUS_UIE)); break;
+    }
+    if (!occur) {
+        return -1;
+    }
+    // 优先级：MEI、MSI、MTI、SEI、SSI、STI、UEI、USI、UTI
+    static const int order[] = {11, 3, 7, 9, 1, 5, 8, 0, 4};
+    for (int code : order) {
+        if (pending & (1u << code)) {
+            return code;
+        }
+    }
+    return -1;
+}
+
+void Rv32Core::trap(uint32_t cause, uint32_t tval) {
+    bool interrupt = cause >> 31;
+    uint32_t code = cause & 0x7fffffff;
+    // 在 M 态时不委托
+    bool deleg = priv != PRIV_M && code < 32 && (((interrupt ? mideleg : medeleg) >> code) & 1);
+    uint32_t tvec = deleg ? stvec : mtvec;
+    uint32_t target = tvec & ~3u;
+    // 向量模式只对中断生效
+    if ((tvec & 3) == 1 && interrupt) {
+        target += code << 2;
+    }
+
+    if (!deleg) {
+        mcause = cause;
+        mtval = tval;
+        mepc = pc & ~3u;
+        mstatus = (mstatus & ~(MSTATUS_MPP | MSTATUS_MPIE | MSTATUS_MIE)) |
+                  priv << MSTATUS_MPP_SHIFT | ((mstatus & MSTATUS_MIE) ? MSTATUS_MPIE : 0);
+        priv = PRIV_M;
+    } else {
+        scause = cause;
+        stval = tval;
+        sepc = pc & ~3u;
+        mstatus = (mstatus & ~(MSTATUS_SPP | MSTATUS_SPIE | MSTATUS_SIE)) |
+                  ((priv & 1) ? MSTATUS_SPP : 0) | ((mstatus & MSTATUS_SIE) ? MSTATUS_SPIE : 0);
+        priv = PRIV_S;
+    }
+    pc = target;
+}
+
+void Rv32Core::do_xret(RvStep &s) {
+    s.kind = RvStep::XRET;
+    if ((s.instr >> 20) == 0x302) {  // mret
+        priv = (mstatus & MSTATUS_MPP) >> MSTATUS_MPP_SHIFT;
+        mstatus = (mstatus & ~(MSTATUS_MIE | MSTATUS_MPP)) | MSTATUS_MPIE |
+                  ((mstatus & MSTATUS_MPIE) ? MSTATUS_MIE : 0);
+        pc = mepc;
+    } else {  // sret
+        priv = (mstatus & MSTATUS_SPP) ? PRIV_S : PRIV_U;
+        mstatus = (mstatus & ~(MSTATUS_SIE | MSTATUS_SPP)) | MSTATUS_SPIE |
+                  ((mstatus & MSTATUS_SPIE) ? MSTATUS_SIE : 0);
+        pc = sepc;
+    }
+    if (!(mcountinhibit & 4)) {
+        minstret++;
+    }
+}
+
+// ==== 译码 ====
+
+Rv32Core::Decoded Rv32Core::decode(uint32_t instr) {
+    Decoded d = {};
+    d.instr = instr;
+    d.op = OP_ILLEGAL;
+    d.rd = (instr >> 7) & 0x1f;
+    d.rs1 = (instr >> 15) & 0x1f;
+    d.rs2 = (instr >> 20) & 0x1f;
+
+    uint32_t funct3 = (instr >> 12) & 7;
+    uint32_t funct7 = instr >> 25;
+
+    switch (instr & 0x7f) {
+    case 0x37:  // lui
+        d.op = OP_LUI;
+        d.imm = instr & 0xfffff000;
+        break;
+    case 0x17:  // auipc
+        d.op = OP_AUIPC;
+        d.imm = instr & 0xfffff000;
+        break;
+    case 0x6f:  // jal
+        d.op = OP_JAL;
+        d.imm = imm_j(instr);
+        break;
+    case 0x67:  // jalr
+        if (funct3 == 0) {
+            d.op = OP_JALR;
+            d.imm = imm_i(instr);
+        }
+        break;
+    case 0x63: {  // branch
+        static const uint8_t ops[] = {OP_BEQ,     OP_BNE, OP_ILLEGAL, OP_ILLEGAL,
+                                      OP_BLT,     OP_BGE, OP_BLTU,    OP_BGEU};
+        d.op = ops[funct3];
+        d.imm = imm_b(instr);
+        break;
+    }
+    case 0x03: {  // load
+        static const uint8_t ops[] = {OP_LB,  OP_LH,  OP_LW,      OP_ILLEGAL,
+                                      OP_LBU, OP_LHU, OP_ILLEGAL, OP_ILLEGAL};
+        d.op = ops[funct3];
+        d.imm = imm_i(instr);
+        break;
+    }
+    case 0x23: {  // store
+        static const uint8_t ops[] = {OP_SB,      OP_SH,      OP_SW,      OP_ILLEGAL,
+                                      OP_ILLEGAL, OP_ILLEGAL, OP_ILLEGAL, OP_ILLEGAL};
+        d.op = ops[funct3];
+        d.imm = imm_s(instr);
+        break;
+    }
+    case 0x13: {  // 立即数运算
+        static const uint8_t ops[] = {OP_ADDI, OP_SLLI, OP_SLTI, OP_SLTIU,
+                                      OP_XORI, OP_SRLI, OP_ORI,  OP_ANDI};
+        d.op = ops[funct3];
+        d.imm = imm_i(instr);
+        if (funct3 == 1) {
+            if (funct7 != 0) d.op = OP_ILLEGAL;
+            d.imm = d.rs2;
+        } else if (funct3 == 5) {
+            if (funct7 == 0x20) d.op = OP_SRAI;
+            else if (funct7 != 0) d.op = OP_ILLEGAL;
+            d.imm = d.rs2;
+        }
+        break;
+    }
+    case 0x33:  // 寄存器运算
+        switch (funct3 << 7 | funct7) {
+        case 0 << 7 | 0x00: d.op = OP_ADD; break;
+        case 0 << 7 | 0x20: d.op = OP_SUB; break;
+        case 1 << 7 | 0x00: d.op = OP_SLL; break;
+        case 1 << 7 | 0x24: d.op = OP_SBCLR; break;
+        case 2 << 7 | 0x00: d.op = OP_SLT; break;
+        case 3 << 7 | 0x00: d.op = OP_SLTU; break;
+        case 4 << 7 | 0x00: d.op = OP_XOR; break;
+        case 4 << 7 | 0x05: d.op = OP_MIN; break;
+        case 4 << 7 | 0x04: d.op = OP_PACK; break;
+        case 4 << 7 | 0x14: d.op = OP_XPERM8; break;
+        case 5 << 7 | 0x00: d.op = OP_SRL; break;
+        case 5 << 7 | 0x20: d.op = OP_SRA; break;
+        case 6 << 7 | 0x00: d.op = OP_OR; break;
+        case 7 << 7 | 0x00: d.op = OP_AND; break;
+        default: break;
+        }
+        break;
+    case 0x73:  // system
+        if (funct3 == 0) {
+            if (d.rs1 != 0 || d.rd != 0) {
+                // sfence.vma 可以带 rs1、rs2，但 rd 必须为 0
+                if (funct7 == 0x09 && d.rd == 0) d.op = OP_NOP;
+                break;
+            }
+            switch (funct7 << 5 | d.rs2) {
+            case 0x00 << 5 | 0: d.op = OP_ECALL; break;
+            case 0x00 << 5 | 1: d.op = OP_EBREAK; break;
+            case 0x08 << 5 | 2: d.op = OP_SRET; break;
+            case 0x18 << 5 | 2: d.op = OP_MRET; break;
+            case 0x08 << 5 | 5: d.op = OP_NOP; break;  // wfi，等待中断由使用者处理
+            default:
+                if (funct7 == 0x09) d.op = OP_NOP;  // sfence.vma，每次都查页表，不需要做什么
+                break;
+            }
+        } else if (funct3 != 4) {
+            static const uint8_t ops[] = {OP_ILLEGAL, OP_CSRRW,  OP_CSRRS,  OP_CSRRC,
+                                          OP_ILLEGAL, OP_CSRRWI, OP_CSRRSI, OP_CSRRCI};
+            d.op = ops[funct3];
+            d.imm = instr >> 20;
+        }
+        break;
+    default:  // 包括 FENCE
+        break;
+    }
+    return d;
+}
+
+// ==== 执行 ====
+
+void Rv32Core::set_decode_cache(bool enable) {
+    decode_cache.assign(enable ? DECODE_CACHE_SIZE : 0, CacheLine{INVALID_PADDR, {}});
+}
+
+void Rv32Core::invalidate(uint32_t paddr) {
+    if (decode_cache.empty()) {
+        return;
+    }
+    CacheLine &line = decode_cache[(paddr >> 2) & (DECODE_CACHE_SIZE - 1)];
+    if (line.paddr == (paddr & ~3u)) {
+        line.paddr = INVALID_PADDR;
+    }
+}
+
+RvStep Rv32Core::step() {
+    RvStep s = {};
+    s.kind = RvStep::RETIRE;
+    s.pc = pc;
+    s.priv = priv;
+
+    if (!(mcountinhibit & 1)) {
+        mcycle++;
+    }
+
+    auto raise = [&](uint32_t cause, uint32_t tval) {
+        s.kind = RvStep::TRAP;
+        s.cause = cause;
+        s.tval = tval;
+        trap(cause, tval);
+        return s;
+    };
+
+    // 取指，打开译码缓存时命中的指令不再读存储器
+    if (pc & 3) {
+        return raise(EXC_INSTRUCTION_ADDRESS_MISALIGNED, pc);
+    }
+    uint64_t paddr;
+    if (uint32_t exc = translate(pc, FETCH, paddr)) {
+        return raise(exc, pc);
+    }
+    Decoded d;
+    if (decode_cache.empty()) {
+        d = decode(bus.read(static_cast<uint32_t>(paddr), 4));
+    } else {
+        CacheLine &line = decode_cache[(paddr >> 2) & (DECODE_CACHE_SIZE - 1)];
+        if (line.paddr != paddr) {
+            line.paddr = static_cast<uint32_t>(paddr);
+            line.d = decode(bus.read(static_cast<uint32_t>(paddr), 4));
+        }
+        d = line.d;
+    }
+    s.instr = d.instr;
+
+    uint32_t a = x[d.rs1], b = x[d.rs2];
+    uint32_t next_pc = pc + 4;
+    bool wen = true;
+    uint32_t value = 0;
+
+    switch (d.op) {
+    case OP_LUI: value = d.imm; break;
+    case OP_AUIPC: value = pc + d.imm; break;
+    case OP_JAL:
+        value = pc + 4;
+        next_pc = pc + d.imm;
+        break;
+    case OP_JALR:
+        value = pc + 4;
+        next_pc = (a + d.imm) & ~1u;
+        break;
+
+    case OP_BEQ: wen = false; if (a == b) next_pc = pc + d.imm; break;
+    case OP_BNE: wen = false; if (a != b) next_pc = pc + d.imm; break;
+    case OP_BLT:
+        wen = false;
+        if (static_cast<int32_t>(a) < static_cast<int32_t>(b)) next_pc = pc + d.imm;
+        break;
+    case OP_BGE:
+        wen = false;
+        if (static_cast<int32_t>(a) >= static_cast<int32_t>(b)) next_pc = pc + d.imm;
+        break;
+    case OP_BLTU: wen = false; if (a < b) next_pc = pc + d.imm; break;
+    case OP_BGEU: wen = false; if (a >= b) next_pc = pc + d.imm; break;
+
+    case OP_LB:
+    case OP_LH:
+    case OP_LW:
+    case OP_LBU:
+    case OP_LHU: {
+        // rd 为 x0 时仍然访问总线（可能触发异常或有副作用），只是不写回
+        int size = (d.op == OP_LW) ? 4 : (d.op == OP_LH || d.op == OP_LHU) ? 2 : 1;
+        uint32_t vaddr = a + d.imm;
+        if (vaddr & (size - 1)) {
+            return raise(EXC_LOAD_ADDRESS_MISALIGNED, vaddr);
+        }
+        if (uint32_t exc = translate(vaddr, LOAD, paddr)) {
+            return raise(exc, vaddr);
+        }
+        value = bus.read(static_cast<uint32_t>(paddr), size);
+        if (d.op == OP_LB) value = sext(value, 8);
+        else if (d.op == OP_LH) value = sext(value, 16);
+        break;
+    }
+    case OP_SB:
+    case OP_SH:
+    case OP_SW: {
+        wen = false;
+        int size = (d.op == OP_SW) ? 4 : (d.op == OP_SH) ? 2 : 1;
+        uint32_t vaddr = a + d.imm;
+        if (vaddr & (size - 1)) {
+            return raise(EXC_STORE_ADDRESS_MISALIGNED, vaddr);
+        }
+        if (uint32_t exc = translate(vaddr, STORE, paddr)) {
+            return raise(exc, vaddr);
+        }
+        bus.write(static_cast<uint32_t>(paddr), size,
+                  size == 4 ? b : b & ((1u << (size * 8)) - 1));
+        invalidate(static_cast<uint32_t>(paddr));
+        break;
+    }
+
+    case OP_ADDI: value = a + d.imm; break;
+    case OP_SLTI: value = static_cast<int32_t>(a) < static_cast<int32_t>(d.imm); break;
+    case OP_SLTIU: value = a < d.imm; break;
+    case OP_XORI: value = a ^ d.imm; break;
+    case OP_ORI: value = a | d.imm; break;
+    case OP_ANDI: value = a & d.imm; break;
+    case OP_SLLI: value = a << d.imm; break;
+    case OP_SRLI: value = a >> d.imm; break;
+    case OP_SRAI: value = static_cast<int32_t>(a) >> d.imm; break;
+
+    case OP_ADD: value = a + b; break;
+    case OP_SUB: value = a - b; break;
+    case OP_SLL: value = a << (b & 0x1f); break;
+    case OP_SLT: value = static_cast<int32_t>(a) < static_cast<int32_t>(b); break;
+    case OP_SLTU: value = a < b; break;
+    case OP_XOR: value = a ^ b; break;
+    case OP_SRL: value = a >> (b & 0x1f); break;
+    case OP_SRA: value = static_cast<int32_t>(a) >> (b & 0x1f); break;
+    case OP_OR: value = a | b; break;
+    case OP_AND: value = a & b; break;
+    case OP_SBCLR: value = a & ~(1u << (b & 0x1f)); break;
+    case OP_MIN: value = static_cast<int32_t>(a) < static_cast<int32_t>(b) ? a : b; break;
+    case OP_PACK: value = (b << 16) | (a & 0xffff); break;
+    case OP_XPERM8:
+        for (int i = 0; i < 4; i++) {
+            uint32_t idx = (b >> (i * 8)) & 0xff;
+            value |= (idx <= 3 ? (a >> (idx * 8)) & 0xff : 0) << (i * 8);
+        }
+        break;
+
+    case OP_ECALL: return raise(EXC_ECALL_FROM_U_MODE + priv, 0);
+    case OP_EBREAK: return raise(EXC_BREAKPOINT, 0);
+    case OP_SRET:
+        if (priv < PRIV_S) {
+            return raise(EXC_ILLEGAL_INSTRUCTION, 0);
+        }
+        do_xret(s);
+        return s;
+    case OP_MRET:
+        if (priv != PRIV_M) {
+            return raise(EXC_ILLEGAL_INSTRUCTION, 0);
+        }
+        do_xret(s);
+        return s;
+    case OP_NOP: wen = false; break;
+
+    case OP_CSRRW:
+    case OP_CSRRS:
+    case OP_CSRRC:
+    case OP_CSRRWI:
+    case OP_CSRRSI:
+    case OP_CSRRCI: {
+        uint32_t addr = d.imm;
+        bool imm = d.op >= OP_CSRRWI;
+        uint32_t src = imm ? d.rs1 : a;
+        uint32_t kind = d.op - (imm ? OP_CSRRWI : OP_CSRRW);
+        // csrrw/csrrwi 总是写，其余的 rs1 字段为 0 时不写
+        bool csr_wen = kind == 0 || d.rs1 != 0;
+        if (csr_invalid(addr, false) || (csr_wen && csr_invalid(addr, true))) {
+            return raise(EXC_ILLEGAL_INSTRUCTION, 0);
+        }
+        uint32_t old = csr(addr);
+        s.csr_volatile = csr_is_volatile(addr);
+        if (csr_wen) {
+            switch (kind) {
+            case 0: csr_write(addr, src); break;
+            case 1: csr_write(addr, old | src); break;
+            case 2: csr_write(addr, old & ~src); break;
+            }
+        }
+        value = old;
+        break;
+    }
+
+    default:  // OP_ILLEGAL
+        return raise(EXC_ILLEGAL_INSTRUCTION, 0);
+    }
+
+    if (wen && d.rd != 0) {
+        x[d.rd] = value;
+        s.rd = d.rd;
+        s.rd_value = value;
+    }
+    pc = next_pc;
+    if (!(mcountinhibit & 4)) {
+        minstret++;
+    }
+    return s;
+}
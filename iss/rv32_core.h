@@ -0,0 +1,115 @@
+// thinpad_top 中 CPU 的参考指令集模拟器：RV32I、Zicsr、Sv32，M/S/U 三个特权级，
+// 以及 ALU 中的 sbclr、min、pack、xperm8 四条扩展指令。
+//
+// 已实现的功能按规范建模，CSR 的 WARL 字段取 RTL 的做法（exc_unit.sv）。RTL 尚未
+// 实现的功能按 RTL 的简化处理，使协同仿真不会停在这些已知的差别上：
+//   - FENCE 和 uret 是非法指令，rd 为 x0 的 load 不访问存储器、不产生异常；
+//   - 没有 MPRV、SUM、MXR、TSR、TW、TVM，页表项的 U、A、D 位不检查；
+//   - 未实现的 CSR 读出 0，写入忽略，不产生非法指令异常；
+//   - 地址转换每次都查页表，物理地址按 mmu.sv 中的 PHY_ADDR_VALID 检查。
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// 物理地址空间，由使用者实现。地址已通过 rv32_phy_addr_valid 检查并按 size 对齐，
+// size 为 1、2、4，数据按小端放在低位。
+class RvBus {
+public:
+    virtual ~RvBus() = default;
+    virtual uint32_t read(uint32_t paddr, int size) = 0;
+    virtual void write(uint32_t paddr, int size, uint32_t data) = 0;
+};
+
+// 与 mmu.sv 的 PHY_ADDR_VALID 相同，地址为 34 位
+bool rv32_phy_addr_valid(uint64_t paddr);
+
+// 特权级
+enum : uint32_t { PRIV_U = 0, PRIV_S = 1, PRIV_M = 3 };
+
+// 一步的结果，对应 RTL 的一次提交、陷入或 xRET
+struct RvStep {
+    enum Kind { RETIRE, TRAP, XRET } kind;
+    uint32_t pc;
+    uint32_t instr;     // 取指出错时为 0
+    uint32_t priv;      // 执行时的特权级
+    uint32_t rd;        // 写回的寄存器编号，不写或写 x0 时为 0
+    uint32_t rd_value;
+    uint32_t cause;     // TRAP：xcause 的值
+    uint32_t tval;
+    bool csr_volatile;  // rd 是计数器、mip 等随时间变化的 CSR 的值
+};
+
+class Rv32Core {
+public:
+    explicit Rv32Core(RvBus &bus);
+
+    void reset(uint32_t reset_pc);
+
+    // 执行一条指令，或在它之前产生同步异常。不检查中断，由使用者调用
+    // pending_interrupt 和 trap 决定在哪里进入中断
+    RvStep step();
+
+    // 按 RTL 的优先级和使能条件返回当前应进入的中断号，没有时返回 -1
+    int pending_interrupt() const;
+
+    // 在 pc 处陷入，cause 的最高位表示中断
+    void trap(uint32_t cause, uint32_t tval);
+
+    // 读 CSR 的当前值，不做权限检查，也没有副作用
+    uint32_t csr(uint32_t addr) const;
+
+    // 外部中断线（mip 的 MEIP、SEIP、MTIP 等位）
+    void set_irq(uint32_t mip_bit, bool level);
+
+    // time CSR 的值，menvcfg.STCE 置位时同时更新 STIP
+    void set_time(uint64_t time);
+
+    // 按物理地址缓存译码结果，命中时不再取指和译码。CPU 自己的 store 会清除对应的项；
+    // 打开后，CPU 以外的写入（DMA 等）须调用 invalidate
+    void set_decode_cache(bool enable);
+    void invalidate(uint32_t paddr);
+
+    uint32_t pc;
+    uint32_t priv;
+    uint32_t x[32];
+
+private:
+    enum Access { FETCH, LOAD, STORE };
+
+    struct Decoded {
+        uint32_t instr;
+        uint32_t imm;  // CSR 指令中为 CSR 地址
+        uint8_t op, rd, rs1, rs2;
+    };
+    struct CacheLine {
+        uint32_t paddr;
+        Decoded d;
+    };
+
+    static Decoded decode(uint32_t instr);
+
+    // 地址转换，成功返回 0，否则返回异常号
+    uint32_t translate(uint32_t vaddr, Access access, uint64_t &paddr);
+    bool csr_invalid(uint32_t addr, bool write) const;
+    bool csr_is_volatile(uint32_t addr) const;
+    void csr_write(uint32_t addr, uint32_t value);
+    void do_xret(RvStep &s);
+
+    RvBus &bus;
+
+    uint32_t mstatus, mtvec, mip, mie, mscratch, mepc, mcause, mtval;
+    uint32_t mhartid, medeleg, mideleg;
+    bool stce;
+    uint32_t sepc, scause, stval, stvec, sscratch, satp;
+    uint64_t stimecmp;
+    uint64_t time;
+
+    uint64_t mcycle, minstret;
+    uint64_t mhpmcounter[11];
+    uint32_t mhpmevent[11];
+    uint32_t mcountinhibit, mcounteren, scounteren;
+    uint32_t mirqlat;
+
+    std::vector<CacheLine> decode_cache;
+};
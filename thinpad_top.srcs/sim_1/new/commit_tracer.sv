@@ -0,0 +1,57 @@
+`timescale 1ns / 1ps
+
+// 仿真用的提交轨迹记录器，接到 WB 阶段的提交信号（类似 RVFI），
+// 每提交一条指令向 TRACE_FILE 写入一条 16 字节的记录：
+//   +0  pc
+//   +4  指令
+//   +8  写回寄存器的数据，不写寄存器时为 0
+//   +12 [4:0] 写回的寄存器编号（不写时为 0），[9:8] 特权级
+// mret/sret 在 MEM 阶段提交后被冲刷，不会从 WB 离开，由 xret 单独给出，
+// 记录中写回的寄存器编号和数据为 0；同一周期 WB 提交的指令更早，先写出
+// 每个字按主机字节序（x86 上为小端）写出，可以用 tools/tracedec.py --sim 分析
+module commit_tracer #(
+    parameter TRACE_FILE = ""  // 为空时不记录
+) (
+    input wire clk,
+
+    input wire        valid,
+    input wire [31:0] pc,
+    input wire [31:0] insn,
+    input wire [ 4:0] rd_addr,
+    input wire [31:0] rd_wdata,
+    input wire [ 1:0] mode,
+
+    input wire        xret,
+    input wire [31:0] xret_pc,
+    input wire [31:0] xret_insn
+);
+
+  integer fd = 0;
+  longint order = 0;
+
+  initial begin
+    if (TRACE_FILE != "") begin
+      fd = $fopen(TRACE_FILE, "wb");
+      if (!fd) $display("Failed to open trace file %s", TRACE_FILE);
+    end
+  end
+
+  always @(posedge clk) begin
+    if (fd && valid) begin
+      $fwrite(fd, "%u%u%u%u", pc, insn, rd_wdata, {22'b0, mode, 3'b0, rd_addr});
+      order = order + 1;
+    end
+    if (fd && xret) begin
+      $fwrite(fd, "%u%u%u%u", xret_pc, xret_insn, 32'b0, {22'b0, mode, 8'b0});
+      order = order + 1;
+    end
+  end
+
+  final begin
+    if (fd) begin
+      $display("Commit trace: %0d instructions written to %s", order, TRACE_FILE);
+      $fclose(fd);
+    end
+  end
+
+endmodule
@@ -0,0 +1,34 @@
+`timescale 1ns / 1ps
+
+// 快速的只读 flash 模型，引脚与 thinpad_top 的 flash 接口相同，只支持 16 位模式
+// （flash_byte_n 为 1）的读取，不响应命令，未编程的部分读出全 1。
+// 存储内容在 C 一侧（fast_models.cpp），初始化文件用 mmap 映射。
+module fast_flash_model #(
+    parameter NAME      = "flash",
+    parameter INIT_FILE = ""
+) (
+    input wire [22:0] a,  // a[0] 在 16 位模式下无意义
+    inout wire [15:0] d,
+    input wire        ce_n,
+    input wire        oe_n,
+    input wire        we_n,
+    input wire        rp_n,
+    input wire        byte_n
+);
+
+  import "DPI-C" function int fast_mem_open(input string name, input string path, input int size,
+                                            input int fill);
+  import "DPI-C" function int fast_mem_read(input int handle, input int addr, input int version);
+
+  localparam SIZE = 8 << 20;  // 4M x 16 bit
+
+  int handle = -1;
+  int rdata;
+
+  initial handle = fast_mem_open(NAME, INIT_FILE, SIZE, 32'hFF);
+
+  always_comb rdata = handle < 0 ? -1 : fast_mem_read(handle, {9'b0, a[22:2], 2'b0}, handle);
+
+  assign d = (!ce_n && !oe_n && rp_n) ? (a[1] ? rdata[31:16] : rdata[15:0]) : 16'bz;
+
+endmodule
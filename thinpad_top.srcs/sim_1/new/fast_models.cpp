@@ -0,0 +1,141 @@
+// fast_sram_model / fast_flash_model 的存储内容，通过 DPI 访问。
+// 镜像文件用 mmap 以 MAP_PRIVATE 方式映射，加载不需要拷贝，仿真中的写入也不会改动文件。
+// 可以在 xsim（xsc 编译）和 Verilator 中使用。
+
+#include "fast_models.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <map>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+struct Region {
+    std::string name;
+    uint8_t *base;
+    size_t size;
+};
+
+std::vector<Region> regions;
+std::map<std::string, std::string> file_overrides;
+
+// 文件内容映射到 [base, base + size) 的开头，超出文件的部分填充 fill
+bool map_file(uint8_t *base, size_t size, const char *path, int fill) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return false;
+    }
+    size_t len = static_cast<size_t>(st.st_size) < size ? st.st_size : size;
+    if (len > 0 &&
+        mmap(base, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED) {
+        close(fd);
+        return false;
+    }
+    close(fd);
+    // 匿名映射和文件最后一页中超出文件的部分本来就是 0
+    if (fill != 0) {
+        memset(base + len, fill, size - len);
+    }
+    fprintf(stderr, "%s: mapped %zu bytes\n", path, len);
+    return true;
+}
+
+}  // namespace
+
+extern "C" void fast_mem_set_file(const char *name, const char *path) {
+    file_overrides[name] = path;
+}
+
+extern "C" uint8_t *fast_mem_data(int handle, size_t *size) {
+    if (handle < 0 || handle >= static_cast<int>(regions.size())) {
+        return nullptr;
+    }
+    if (size) {
+        *size = regions[handle].size;
+    }
+    return regions[handle].base;
+}
+
+extern "C" int fast_mem_count() {
+    return static_cast<int>(regions.size());
+}
+
+extern "C" const char *fast_mem_name(int handle) {
+    return regions[handle].name.c_str();
+}
+
+extern "C" int fast_mem_create(const char *name, size_t size, int fill) {
+    void *base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED) {
+        perror("fast_mem_create");
+        return -1;
+    }
+    if (fill != 0) {
+        memset(base, fill, size);
+    }
+    regions.push_back({name, static_cast<uint8_t *>(base), size});
+    return static_cast<int>(regions.size() - 1);
+}
+
+extern "C" int fast_mem_find(const char *name) {
+    for (size_t i = 0; i < regions.size(); i++) {
+        if (regions[i].name == name) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+// ==== DPI ====
+
+extern "C" int fast_mem_open(const char *name, const char *path, int size, int fill) {
+    int handle = fast_mem_find(name);
+    if (handle >= 0) {
+        return handle;
+    }
+
+    auto it = file_overrides.find(name);
+    const char *file = it != file_overrides.end() ? it->second.c_str() : path;
+    bool has_file = file && file[0];
+
+    // 有初始化文件时先不填充，文件之外的部分由 map_file 填充
+    handle = fast_mem_create(name, static_cast<size_t>(size), has_file ? 0 : fill);
+    if (handle < 0 || !has_file) {
+        return handle;
+    }
+    Region &r = regions[handle];
+    if (!map_file(r.base, r.size, file, fill & 0xFF)) {
+        fprintf(stderr, "Failed to open %s init file %s\n", name, file);
+        memset(r.base, fill, r.size);
+    }
+    return handle;
+}
+
+extern "C" int fast_mem_read(int handle, int addr, int version) {
+    (void)version;
+    const Region &r = regions[handle];
+    const uint8_t *p = r.base + (static_cast<uint32_t>(addr) & (r.size - 1) & ~3u);
+    uint32_t word = p[0] | p[1] << 8 | p[2] << 16 | static_cast<uint32_t>(p[3]) << 24;
+    return static_cast<int>(word);
+}
+
+extern "C" void fast_mem_write(int handle, int addr, int data, int be) {
+    const Region &r = regions[handle];
+    uint8_t *p = r.base + (static_cast<uint32_t>(addr) & (r.size - 1) & ~3u);
+    for (int i = 0; i < 4; i++) {
+        if (be & (1 << i)) {
+            p[i] = static_cast<uint32_t>(data) >> (i * 8);
+        }
+    }
+}
@@ -0,0 +1,29 @@
+// fast_sram_model / fast_flash_model 的存储区，除 DPI 函数外供 C++ 仿真驱动使用
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+extern "C" {
+
+// 指定名为 name 的存储区的初始化文件，代替模型的 INIT_FILE 参数，需在仿真开始前调用
+void fast_mem_set_file(const char *name, const char *path);
+
+// 按名字查找已打开的存储区，没有时返回 -1
+int fast_mem_find(const char *name);
+
+// 已打开的存储区按打开的顺序编号为 0 ~ fast_mem_count() - 1，模型中保存的即这个编号
+int fast_mem_count();
+const char *fast_mem_name(int handle);
+
+// 新建一个内容为 fill 的存储区，返回编号；用于恢复检查点，此时模型不会再打开存储区
+int fast_mem_create(const char *name, size_t size, int fill);
+
+// 存储区的内容和字节数，handle 无效时返回 nullptr
+uint8_t *fast_mem_data(int handle, size_t *size);
+
+// ==== DPI ====
+int fast_mem_open(const char *name, const char *path, int size, int fill);
+int fast_mem_read(int handle, int addr, int version);
+void fast_mem_write(int handle, int addr, int data, int be);
+}
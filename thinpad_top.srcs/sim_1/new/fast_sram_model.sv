@@ -0,0 +1,45 @@
+`timescale 1ns / 1ps
+
+// 快速的异步 SRAM 模型，引脚与 thinpad_top 的 BaseRAM/ExtRAM 接口相同，
+// 一个实例代替两片 16 位的 sram_model。存储内容在 C 一侧（fast_models.cpp），
+// 初始化文件用 mmap 映射，加载不需要时间；只做零延迟的功能建模，不检查时序。
+module fast_sram_model #(
+    parameter NAME      = "sram",  // 区分实例，Verilator 仿真驱动按名字指定初始化文件
+    parameter INIT_FILE = ""       // 为空时内容全 0
+) (
+    input wire [19:0] addr,
+    inout wire [31:0] data,
+    input wire [ 3:0] be_n,
+    input wire        ce_n,
+    input wire        oe_n,
+    input wire        we_n
+);
+
+  import "DPI-C" function int fast_mem_open(input string name, input string path, input int size,
+                                            input int fill);
+  import "DPI-C" function int fast_mem_read(input int handle, input int addr, input int version);
+  import "DPI-C" function void fast_mem_write(input int handle, input int addr, input int data,
+                                              input int be);
+
+  localparam SIZE = 4 << 20;  // 1M x 32 bit
+
+  int handle = -1;
+  // 每次写入后加一，作为读函数的参数，使写过的地址被重新读取
+  int version = 0;
+  int rdata;
+
+  initial handle = fast_mem_open(NAME, INIT_FILE, SIZE, 0);
+
+  always_comb rdata = handle < 0 ? 0 : fast_mem_read(handle, {10'b0, addr, 2'b0}, version);
+
+  assign data = (!ce_n && !oe_n && we_n) ? rdata : 32'bz;
+
+  // 写脉冲结束（we_n 上升沿）时写入，sram_controller 在这时仍保持地址和数据
+  always @(posedge we_n) begin
+    if (!ce_n && handle >= 0) begin
+      fast_mem_write(handle, {10'b0, addr, 2'b0}, data, {28'b0, ~be_n});
+      version = version + 1;
+    end
+  end
+
+endmodule
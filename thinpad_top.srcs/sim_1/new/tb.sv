@@ -49,6 +49,7 @@ module tb;
   parameter BASE_RAM_INIT_FILE = "/tmp/main.bin"; // BaseRAM 初始化文件，请修改为实际的绝对路径
   parameter EXT_RAM_INIT_FILE = "/tmp/eram.bin";  // ExtRAM 初始化文件，请修改为实际的绝对路径
   parameter FLASH_INIT_FILE = "/tmp/kernel.elf";  // Flash 初始化文件，请修改为实际的绝对路径
+  parameter TRACE_FILE = "";  // 提交轨迹输出文件，例如 "/tmp/trace.bin"，为空时不记录
 
   initial begin
     // 在这里可以自定义测试输入序列，例如：
@@ -113,6 +114,21 @@ module tb;
       .flash_byte_n(flash_byte_n),
       .flash_we_n(flash_we_n)
   );
+  // 提交轨迹记录
+  commit_tracer #(
+      .TRACE_FILE(TRACE_FILE)
+  ) tracer (
+      .clk     (dut.sys_clk),
+      .valid   (dut.pipeline_retire),
+      .pc      (dut.pipeline_retire_pc),
+      .insn    (dut.pipeline_retire_instr),
+      .rd_addr (dut.pipeline_retire_rd_addr),
+      .rd_wdata(dut.pipeline_retire_rd_wdata),
+      .mode    (dut.exc_privilege),
+      .xret    (dut.exc_exc_ret),
+      .xret_pc (dut.exc_cur_pc),
+      .xret_insn(dut.u_pipeline.u_mem_stage.instr)
+  );
   // 时钟源
   clock osc (
       .clk_11M0592(clk_11M0592),
@@ -133,6 +149,43 @@ module tb;
     .rxd (txd),
     .txd (rxd)
   );
+`ifdef FAST_MODELS
+  // 快速存储器模型（fast_models.cpp），初始化文件用 mmap 映射，立即加载完成
+  fast_sram_model #(
+      .NAME     ("base"),
+      .INIT_FILE(BASE_RAM_INIT_FILE)
+  ) base_ram (
+      .addr(base_ram_addr),
+      .data(base_ram_data),
+      .be_n(base_ram_be_n),
+      .ce_n(base_ram_ce_n),
+      .oe_n(base_ram_oe_n),
+      .we_n(base_ram_we_n)
+  );
+  fast_sram_model #(
+      .NAME     ("ext"),
+      .INIT_FILE(EXT_RAM_INIT_FILE)
+  ) ext_ram (
+      .addr(ext_ram_addr),
+      .data(ext_ram_data),
+      .be_n(ext_ram_be_n),
+      .ce_n(ext_ram_ce_n),
+      .oe_n(ext_ram_oe_n),
+      .we_n(ext_ram_we_n)
+  );
+  fast_flash_model #(
+      .NAME     ("flash"),
+      .INIT_FILE(FLASH_INIT_FILE)
+  ) flash (
+      .a     (flash_a),
+      .d     (flash_d),
+      .ce_n  (flash_ce_n),
+      .oe_n  (flash_oe_n),
+      .we_n  (flash_we_n),
+      .rp_n  (flash_rp_n),
+      .byte_n(flash_byte_n)
+  );
+`else
   // BaseRAM 仿真模型
   sram_model base1 (
       .DataIO(base_ram_data[15:0]),
@@ -189,6 +242,7 @@ module tb;
       .VPP ('d1800),
       .Info(1'b1)
   );
+`endif
 
   initial begin
     wait (flash_byte_n == 1'b0);
@@ -197,6 +251,7 @@ module tb;
     $stop;
   end
 
+`ifndef FAST_MODELS
   // 从文件加载 BaseRAM
   initial begin
     reg [31:0] tmp_array[0:1048575];
@@ -240,4 +295,5 @@ module tb;
       ext2.mem_array1[i] = tmp_array[i][0+:8];
     end
   end
+`endif
 endmodule
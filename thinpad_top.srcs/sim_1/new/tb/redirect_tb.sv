@@ -0,0 +1,316 @@
+`timescale 1ns / 1ps
+`include "../../../sources_1/new/headers/exc.vh"
+`include "../../../sources_1/new/headers/privilege.vh"
+`include "../../../sources_1/new/headers/csr.vh"
+// pipeline_controller 提前重定向（spec_valid/spec_hit）的定向测试
+// 只例化 pipeline_controller，按流水线各级的时序直接驱动它的输入：
+// 下降沿改输入，上升沿前检查组合输出，上升沿后检查 spec_valid
+module redirect_tb;
+
+  reg clk = 0;
+  reg rst;
+  always #10 clk = ~clk;
+
+  // 输入
+  reg        if_busy;
+  reg [31:0] exe_if_pc;
+  reg        exe_if_pc_sel;
+  reg [31:0] exe_exe_pc;
+  reg        exe_irq_inject;
+  reg        id_xret;
+  reg        mem_busy;
+  reg        mem_tlb_flush;
+  exc_sig_t  mem_exc_sig;
+  reg [31:0] exc_pc;
+  reg [31:0] exc_irq_pc;
+  reg        exc_irq_fast;
+  reg [31:0] exc_ret_pc;
+  reg        exc_ret_fast;
+  reg        exc_same_regime;
+
+  // 输出
+  wire [31:0] if_pc;
+  wire        if_pc_sel;
+  wire if_stall, id_stall, exe_stall, mem_stall, wb_stall;
+  wire if_flush, id_flush, exe_flush, mem_flush, wb_flush;
+  wire [`HPM_EVENT_WIDTH-1:0] hpm_event;
+
+  pipeline_controller dut (
+    .clk_i(clk),
+    .rst_i(rst),
+
+    .if_if_busy_i(if_busy),
+    .if_pc_o(if_pc),
+    .if_pc_sel_o(if_pc_sel),
+
+    .exe_if_pc_i(exe_if_pc),
+    .exe_if_pc_sel_i(exe_if_pc_sel),
+    .exe_exe_pc_i(exe_exe_pc),
+    .exe_wfi_stall_i(1'b0),
+    .exe_irq_inject_i(exe_irq_inject),
+
+    .id_rf_raddr_a_i(5'd0),
+    .id_rf_raddr_b_i(5'd0),
+    .id_xret_i(id_xret),
+
+    .exe_rf_raddr_a_i(5'd0),
+    .exe_rf_raddr_b_i(5'd0),
+    .exe_mem_en_i(1'b0),
+    .exe_mem_wen_i(1'b0),
+    .exe_rf_waddr_i(5'd0),
+
+    .mem_rf_wdata_i(32'h0),
+    .mem_rf_waddr_i(5'd0),
+    .mem_rf_wen_i(1'b0),
+    .mem_mem_en_i(1'b0),
+    .mem_mem_wen_i(1'b0),
+
+    .mem_mem_busy_i(mem_busy),
+    .mem_tlb_flush_or_satp_update_i(mem_tlb_flush),
+    .mem_exc_sig_i(mem_exc_sig),
+
+    .wb_rf_wdata_i(32'h0),
+    .wb_rf_waddr_i(5'd0),
+    .wb_rf_wen_i(1'b0),
+
+    .exe_forward_alu_a_o(),
+    .exe_forward_alu_b_o(),
+    .exe_forward_alu_a_sel_o(),
+    .exe_forward_alu_b_sel_o(),
+
+    .if_stall_o(if_stall),
+    .id_stall_o(id_stall),
+    .exe_stall_o(exe_stall),
+    .mem_stall_o(mem_stall),
+    .wb_stall_o(wb_stall),
+    .if_flush_o(if_flush),
+    .id_flush_o(id_flush),
+    .exe_flush_o(exe_flush),
+    .mem_flush_o(mem_flush),
+    .wb_flush_o(wb_flush),
+
+    .exc_exc_en_o(),
+    .exc_exc_ret_o(),
+    .exc_cur_pc_o(),
+    .exc_sync_exc_code_o(),
+    .exc_mtval_o(),
+    .privilege_o(),
+
+    .exc_pc_i(exc_pc),
+    .exc_nxt_privilege_i(`PRIVILEGE_M),
+
+    .exc_irq_pc_i(exc_irq_pc),
+    .exc_irq_fast_i(exc_irq_fast),
+    .exc_ret_pc_i(exc_ret_pc),
+    .exc_ret_fast_i(exc_ret_fast),
+    .exc_same_regime_i(exc_same_regime),
+
+    .hpm_event_o(hpm_event)
+  );
+
+  localparam [31:0] MRET_PC = 32'h8000_0100;  // mret 自己的地址
+  localparam [31:0] MEPC_OLD = 32'h8000_0200; // ID 级看到的 mepc
+  localparam [31:0] MEPC_NEW = 32'h8000_0300; // csrw mepc 之后的 mepc
+  localparam [31:0] HANDLER = 32'h8000_0400;  // mtvec
+
+  int errors = 0;
+
+  task automatic expect_eq(input string what, input logic [31:0] got, input logic [31:0] want);
+    if (got !== want) begin
+      $error("%s: got %h, want %h", what, got, want);
+      errors++;
+    end
+  endtask
+
+  // 单个控制信号
+  task automatic expect_bit(input string what, input logic got, input logic want);
+    if (got !== want) begin
+      $error("%s: got %b, want %b", what, got, want);
+      errors++;
+    end
+  endtask
+
+  // 一个没有事件的周期的输入
+  task automatic quiet();
+    if_busy = 0;
+    exe_if_pc = 32'h0;
+    exe_if_pc_sel = 0;
+    exe_exe_pc = 32'h0;
+    exe_irq_inject = 0;
+    id_xret = 0;
+    mem_busy = 0;
+    mem_tlb_flush = 0;
+    mem_exc_sig = `EXC_SIG_NULL;
+    exc_pc = 32'h0;
+    exc_irq_pc = HANDLER;
+    exc_irq_fast = 1;
+    exc_ret_pc = MEPC_OLD;
+    exc_ret_fast = 1;
+    exc_same_regime = 1;
+  endtask
+
+  task automatic step();
+    @(posedge clk);
+    @(negedge clk);
+    quiet();
+  endtask
+
+  // ID 级译出 mret，提前取 mepc
+  task automatic ret_in_id(input logic [31:0] target);
+    id_xret = 1;
+    exc_ret_pc = target;
+    #1;
+    expect_bit("ret redirect: if_pc_sel", if_pc_sel, 1);
+    expect_eq("ret redirect: if_pc", if_pc, target);
+    expect_bit("ret redirect: id_flush", id_flush, 1);
+    expect_bit("ret redirect: exe_flush", exe_flush, 0);
+    step();
+    expect_bit("ret redirect: spec_valid", dut.spec_valid, 1);
+    expect_eq("ret redirect: spec_pc", dut.spec_pc, target);
+  endtask
+
+  // EXE 级注入中断，提前取处理程序
+  task automatic irq_in_exe();
+    exe_irq_inject = 1;
+    #1;
+    expect_bit("irq redirect: if_pc_sel", if_pc_sel, 1);
+    expect_eq("irq redirect: if_pc", if_pc, HANDLER);
+    expect_bit("irq redirect: id_flush", id_flush, 1);
+    expect_bit("irq redirect: exe_flush", exe_flush, 1);
+    step();
+    expect_bit("irq redirect: spec_valid", dut.spec_valid, 1);
+    expect_eq("irq redirect: spec_pc", dut.spec_pc, HANDLER);
+  endtask
+
+  // 等待提交的周期：IF 保持取到的目标指令，ID 插入气泡
+  task automatic hold();
+    #1;
+    expect_bit("hold: if_pc_sel", if_pc_sel, 0);
+    expect_bit("hold: if_stall", if_stall, 1);
+    expect_bit("hold: id_flush", id_flush, 1);
+    expect_bit("hold: exe_flush", exe_flush, 0);
+    step();
+  endtask
+
+  // MEM 级提交陷入或 xRET，hit 为 1 时应保留提前取到的指令
+  task automatic commit(input logic occur, input logic [31:0] target, input logic same, input logic hit);
+    mem_exc_sig.exc_occur = occur;
+    mem_exc_sig.exc_ret = !occur;
+    mem_exc_sig.cur_pc = MRET_PC;
+    exc_pc = target;
+    exc_same_regime = same;
+    #1;
+    expect_bit("commit: if_pc_sel", if_pc_sel, !hit);
+    expect_eq("commit: if_pc", if_pc, target);
+    expect_bit("commit: id_flush", id_flush, !hit);
+    expect_bit("commit: exe_flush", exe_flush, 1);
+    expect_bit("commit: mem_flush", mem_flush, 1);
+    expect_bit("commit: wb_flush", wb_flush, 1);
+    expect_bit("commit: redirect hit", hpm_event[`HPM_EVENT_REDIRECT_HIT], hit);
+    step();
+    expect_bit("commit: spec_valid", dut.spec_valid, 0);
+  endtask
+
+  initial begin
+    quiet();
+    rst = 1;
+    repeat (2) @(posedge clk);
+    @(negedge clk);
+    rst = 0;
+
+    // 1. 中断命中：提交时的入口与提前取的相同，不再取指
+    $display("case 1: interrupt, speculative hit");
+    irq_in_exe();
+    hold();
+    commit(1, HANDLER, 1, 1);
+
+    // 2. mret 命中
+    $display("case 2: mret, speculative hit");
+    ret_in_id(MEPC_OLD);
+    hold();
+    commit(0, MEPC_OLD, 1, 1);
+
+    // 3. 目标相同但地址翻译改变（例如 sret 回到开启分页的 U 态），必须重新取指
+    $display("case 3: mret, speculative miss on regime change");
+    ret_in_id(MEPC_OLD);
+    hold();
+    commit(0, MEPC_OLD, 0, 0);
+
+    // 4. csrw mepc 紧跟 mret：ID 级取的是旧 mepc，提交时的目标是新 mepc
+    $display("case 4: csrw mepc; mret");
+    ret_in_id(MEPC_OLD);
+    hold();  // csrw mepc 在 MEM 写回，mret 在 EXE
+    commit(0, MEPC_NEW, 1, 0);
+
+    // 5. 提前取 mret 目标后，mret 在 EXE 被中断：不再发起第二次提前取指，
+    //    中断提交时目标与 spec_pc 不同，重新取处理程序
+    $display("case 5: interrupt while a speculative redirect is outstanding");
+    ret_in_id(MEPC_OLD);
+    exe_irq_inject = 1;
+    #1;
+    expect_bit("irq during spec: if_pc_sel", if_pc_sel, 0);
+    expect_bit("irq during spec: exe_flush", exe_flush, 0);
+    expect_bit("irq during spec: if_stall", if_stall, 1);
+    step();
+    expect_eq("irq during spec: spec_pc", dut.spec_pc, MEPC_OLD);
+    commit(1, HANDLER, 1, 0);
+
+    // 6. csrw satp 紧跟 mret：satp 在 MEM 时冲刷 ID/EXE/MEM，从 mret 重新取指，
+    //    提前取到的旧目标作废
+    $display("case 6: csrw satp; mret");
+    ret_in_id(MEPC_OLD);
+    mem_tlb_flush = 1;
+    exe_exe_pc = MRET_PC;
+    #1;
+    expect_bit("satp: if_pc_sel", if_pc_sel, 1);
+    expect_eq("satp: if_pc", if_pc, MRET_PC);
+    expect_bit("satp: if_stall", if_stall, 0);
+    expect_bit("satp: id_flush", id_flush, 1);
+    expect_bit("satp: exe_flush", exe_flush, 1);
+    expect_bit("satp: mem_flush", mem_flush, 1);
+    step();
+    expect_bit("satp: spec_valid", dut.spec_valid, 0);
+    #1;
+    expect_bit("satp: if_stall after", if_stall, 0);
+    // 重新取到的 mret 按新的 satp 再提前取一次
+    @(negedge clk);
+    quiet();
+    ret_in_id(MEPC_NEW);
+    hold();
+    commit(0, MEPC_NEW, 1, 1);
+
+    // 7. sfence.vma 紧跟 mret，sfence.vma 到达 MEM 时 IF 还在取提前的目标：
+    //    忙的时候 spec_valid 保持，不忙的那一周期才冲刷、从 mret 重新取指并清除
+    $display("case 7: sfence.vma in MEM while spec_valid is set");
+    ret_in_id(MEPC_OLD);
+    mem_tlb_flush = 1;
+    if_busy = 1;
+    exe_exe_pc = MRET_PC;
+    #1;
+    expect_bit("sfence busy: if_stall", if_stall, 1);
+    expect_bit("sfence busy: mem_flush", mem_flush, 0);
+    @(posedge clk);
+    @(negedge clk);
+    expect_bit("sfence busy: spec_valid", dut.spec_valid, 1);
+    if_busy = 0;
+    #1;
+    expect_bit("sfence: if_pc_sel", if_pc_sel, 1);
+    expect_eq("sfence: if_pc", if_pc, MRET_PC);
+    expect_bit("sfence: id_flush", id_flush, 1);
+    expect_bit("sfence: exe_flush", exe_flush, 1);
+    expect_bit("sfence: mem_flush", mem_flush, 1);
+    step();
+    expect_bit("sfence: spec_valid", dut.spec_valid, 0);
+    #1;
+    expect_bit("sfence: if_stall after", if_stall, 0);
+    expect_bit("sfence: if_pc_sel after", if_pc_sel, 0);
+
+    if (errors == 0) begin
+      $display("redirect_tb: all cases passed");
+    end else begin
+      $display("redirect_tb: %0d check(s) failed", errors);
+    end
+    $finish;
+  end
+
+endmodule
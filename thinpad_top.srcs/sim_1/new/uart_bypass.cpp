@@ -0,0 +1,68 @@
+// 定义 UART_BYPASS 时 uart_controller 的 DPI 函数：发送的字节直接写到标准输出，
+// 接收的字节直接从标准输入读取，不经过串口的逐位时序。可以在 xsim 和 Verilator 中使用。
+
+#include <cstdio>
+#include <deque>
+#include <poll.h>
+#include <string>
+#include <unistd.h>
+
+namespace {
+
+// 每个周期都会调用 uart_bypass_getc，每隔这么多次才检查一次标准输入
+const int POLL_INTERVAL = 1024;
+
+std::deque<unsigned char> rx_queue;
+int poll_countdown = 0;
+bool input_closed = false;
+
+void poll_stdin() {
+    struct pollfd pfd = {STDIN_FILENO, POLLIN, 0};
+    while (!input_closed && poll(&pfd, 1, 0) > 0) {
+        unsigned char buf[64];
+        ssize_t n = read(STDIN_FILENO, buf, sizeof(buf));
+        if (n <= 0) {
+            input_closed = true;
+            break;
+        }
+        rx_queue.insert(rx_queue.end(), buf, buf + n);
+    }
+}
+
+}  // namespace
+
+extern "C" void uart_bypass_putc(int c) {
+    putchar(c & 0xFF);
+    fflush(stdout);
+}
+
+// 仿真中的主机发送一个字节，排在终端输入之后（tb.sv 中 uart.pc_send_byte 使用）
+extern "C" void uart_bypass_send(int c) {
+    rx_queue.push_back(c & 0xFF);
+}
+
+// 返回下一个输入的字节，没有时返回 -1
+extern "C" int uart_bypass_getc() {
+    if (rx_queue.empty()) {
+        if (--poll_countdown > 0) {
+            return -1;
+        }
+        poll_countdown = POLL_INTERVAL;
+        poll_stdin();
+        if (rx_queue.empty()) {
+            return -1;
+        }
+    }
+    int c = rx_queue.front();
+    rx_queue.pop_front();
+    return c;
+}
+
+// 检查点（sim_1/verilator/sim_main.cpp）保存和恢复已经读入、RTL 尚未取走的字节
+std::string uart_bypass_pending() {
+    return std::string(rx_queue.begin(), rx_queue.end());
+}
+
+void uart_bypass_set_pending(const std::string &bytes) {
+    rx_queue.assign(bytes.begin(), bytes.end());
+}
@@ -0,0 +1,264 @@
+// 协同仿真：每个周期读取 sim_top 引出的提交、陷入和 xRET，让参考模型执行同一步并比较。
+//   - 提交：比较 PC、指令、特权级、写回的寄存器和数据，以及下面列出的 CSR；
+//     读设备和计数器等 CSR 的结果取 RTL 的值。
+//   - 同步异常：参考模型执行同一条指令，应在同一个 PC 以同样的原因和 tval 陷入。
+//   - 中断：由 RTL 决定在哪条指令之前进入，参考模型在同一个 PC 进入同一个中断。
+//   - xRET：参考模型执行同一条指令，也应是 xRET。
+
+#include "cosim.h"
+
+#include <cstdio>
+#include <cstring>
+
+#include "Vsim_top.h"
+#include "fast_models.h"
+
+namespace {
+
+// 与 sim_top.sv 中 cosim_csrs 的顺序相同，第 0 个在最低位
+const struct {
+    const char *name;
+    uint32_t addr;
+} compared_csrs[] = {
+    {"mstatus", 0x300},  {"mie", 0x304},      {"mtvec", 0x305}, {"mscratch", 0x340},
+    {"mepc", 0x341},     {"mcause", 0x342},   {"mtval", 0x343}, {"medeleg", 0x302},
+    {"mideleg", 0x303},  {"menvcfgh", 0x31a}, {"sepc", 0x141},  {"scause", 0x142},
+    {"stval", 0x143},    {"stvec", 0x105},    {"sscratch", 0x140}, {"satp", 0x180},
+};
+
+const uint32_t BASE_RAM = 0x80000000, EXT_RAM = 0x80400000, SRAM_SIZE = 4 << 20;
+const uint32_t FLASH = 0x83000000, FLASH_WINDOW = 16 << 20, FLASH_SIZE = 8 << 20;
+const uint32_t BOOT_ROM = 0x82000000, ROM_WINDOW = 16 << 20, ROM_SIZE = 1 << 10;
+
+bool copy_region(const char *name, std::vector<uint8_t> &out) {
+    size_t size;
+    uint8_t *data = fast_mem_data(fast_mem_find(name), &size);
+    if (!data) {
+        fprintf(stderr, "cosim: memory %s is not open\n", name);
+        return false;
+    }
+    out.assign(data, data + size);
+    return true;
+}
+
+}  // namespace
+
+// ==== 存储器 ====
+
+bool CosimBus::init() {
+    if (!copy_region("base", base_ram) || !copy_region("ext", ext_ram) ||
+        !copy_region("flash", flash)) {
+        return false;
+    }
+    // 与 boot_rom 一样在当前目录下读取 bootrom.mem，每行一个字
+    rom.assign(ROM_SIZE, 0);
+    FILE *f = fopen("bootrom.mem", "r");
+    if (!f) {
+        fprintf(stderr, "cosim: failed to open bootrom.mem\n");
+        return false;
+    }
+    uint32_t word;
+    for (size_t off = 0; off < ROM_SIZE && fscanf(f, "%x", &word) == 1; off += 4) {
+        memcpy(&rom[off], &word, 4);
+    }
+    fclose(f);
+    return true;
+}
+
+uint8_t *CosimBus::find(uint32_t paddr, bool writable) {
+    if (paddr - BASE_RAM < SRAM_SIZE) {
+        return &base_ram[paddr - BASE_RAM];
+    }
+    if (paddr - EXT_RAM < SRAM_SIZE) {
+        return &ext_ram[paddr - EXT_RAM];
+    }
+    if (writable) {
+        return nullptr;
+    }
+    // flash 和 boot ROM 的地址窗口中按容量重复
+    if (paddr - FLASH < FLASH_WINDOW) {
+        return &flash[(paddr - FLASH) & (FLASH_SIZE - 1)];
+    }
+    if (paddr - BOOT_ROM < ROM_WINDOW) {
+        return &rom[(paddr - BOOT_ROM) & (ROM_SIZE - 1)];
+    }
+    return nullptr;
+}
+
+uint32_t CosimBus::read(uint32_t paddr, int size) {
+    const uint8_t *p = find(paddr, false);
+    if (!p) {
+        io = true;
+        return 0;
+    }
+    uint32_t data = 0;
+    memcpy(&data, p, size);
+    return data;
+}
+
+void CosimBus::write(uint32_t paddr, int size, uint32_t data) {
+    if (uint8_t *p = find(paddr, true)) {
+        memcpy(p, &data, size);
+    }
+}
+
+void CosimBus::dma_write(uint32_t paddr, uint32_t data, uint32_t sel) {
+    uint8_t *p = find(paddr & ~3u, true);
+    if (!p) {
+        return;
+    }
+    for (int i = 0; i < 4; i++) {
+        if (sel & (1 << i)) {
+            p[i] = data >> (i * 8);
+        }
+    }
+}
+
+// ==== 比较 ====
+
+void Cosim::record(const RvStep &s) { history[steps++ % HISTORY] = s; }
+
+void Cosim::report(const char *what, uint32_t rtl, uint32_t iss) {
+    fprintf(stderr, "\ncosim: mismatch at cycle %llu after %llu instructions\n",
+            (unsigned long long)cycle, (unsigned long long)retired);
+    fprintf(stderr, "  %-10s RTL %08x  ISS %08x\n", what, rtl, iss);
+    fprintf(stderr, "  last steps of the ISS:\n");
+    uint64_t first = steps > HISTORY ? steps - HISTORY : 0;
+    for (uint64_t i = first; i < steps; i++) {
+        const RvStep &s = history[i % HISTORY];
+        fprintf(stderr, "    %08x  %08x  %c", s.pc, s.instr, "USHM"[s.priv]);
+        if (s.kind == RvStep::TRAP) {
+            fprintf(stderr, "  trap cause %08x tval %08x", s.cause, s.tval);
+        } else if (s.kind == RvStep::XRET) {
+            fprintf(stderr, "  xret");
+        } else if (s.rd) {
+            fprintf(stderr, "  x%-2u = %08x", s.rd, s.rd_value);
+        }
+        fprintf(stderr, "\n");
+    }
+}
+
+bool Cosim::check_csrs(const Vsim_top &top) {
+    for (size_t i = 0; i < sizeof(compared_csrs) / sizeof(compared_csrs[0]); i++) {
+        uint32_t rtl = top.cosim_csrs[i];
+        uint32_t iss = core.csr(compared_csrs[i].addr);
+        if (rtl != iss) {
+            report(compared_csrs[i].name, rtl, iss);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Cosim::check_retire(const Vsim_top &top) {
+    bus.io = false;
+    RvStep s = core.step();
+    // 设备和随时间变化的 CSR 的值无法预测，取 RTL 的写回值
+    if ((bus.io || s.csr_volatile) && s.rd && s.rd == top.cosim_retire_rd) {
+        core.x[s.rd] = s.rd_value = top.cosim_retire_rd_wdata;
+    }
+    record(s);
+    retired++;
+
+    if (s.kind != RvStep::RETIRE) {
+        report(s.kind == RvStep::TRAP ? "ISS trap" : "ISS xret", top.cosim_retire_pc, s.pc);
+        return false;
+    }
+    if (top.cosim_retire_pc != s.pc) {
+        report("pc", top.cosim_retire_pc, s.pc);
+        return false;
+    }
+    if (top.cosim_retire_instr != s.instr) {
+        report("instr", top.cosim_retire_instr, s.instr);
+        return false;
+    }
+    if (top.cosim_privilege != s.priv) {
+        report("privilege", top.cosim_privilege, s.priv);
+        return false;
+    }
+    if (top.cosim_retire_rd != s.rd) {
+        report("rd", top.cosim_retire_rd, s.rd);
+        return false;
+    }
+    if (top.cosim_retire_rd_wdata != s.rd_value) {
+        report("rd value", top.cosim_retire_rd_wdata, s.rd_value);
+        return false;
+    }
+    return check_csrs(top);
+}
+
+bool Cosim::check_trap(const Vsim_top &top) {
+    uint32_t cause = top.cosim_trap_cause;
+    if (cause >> 31) {
+        // 中断在 RTL 中注入到 EXE 阶段的指令，参考模型在这条指令之前进入
+        if (core.pc != top.cosim_trap_pc) {
+            report("irq pc", top.cosim_trap_pc, core.pc);
+            return false;
+        }
+        RvStep s = {};
+        s.kind = RvStep::TRAP;
+        s.pc = core.pc;
+        s.priv = core.priv;
+        s.cause = cause;
+        core.trap(cause, 0);
+        record(s);
+        return true;
+    }
+
+    RvStep s = core.step();
+    record(s);
+    if (s.kind != RvStep::TRAP) {
+        report("RTL trap", top.cosim_trap_pc, s.pc);
+        return false;
+    }
+    if (top.cosim_trap_pc != s.pc) {
+        report("trap pc", top.cosim_trap_pc, s.pc);
+        return false;
+    }
+    if (cause != s.cause) {
+        report("cause", cause, s.cause);
+        return false;
+    }
+    if (top.cosim_trap_tval != s.tval) {
+        report("tval", top.cosim_trap_tval, s.tval);
+        return false;
+    }
+    return true;
+}
+
+bool Cosim::check_xret(const Vsim_top &top) {
+    RvStep s = core.step();
+    record(s);
+    if (s.kind != RvStep::XRET || top.cosim_trap_pc != s.pc) {
+        report("RTL xret", top.cosim_trap_pc, s.pc);
+        return false;
+    }
+    return true;
+}
+
+bool Cosim::tick(const Vsim_top &top, uint64_t now) {
+    cycle = now;
+    if (!started) {
+        // 存储器模型在第一次 eval 时打开
+        if (!bus.init()) {
+            return false;
+        }
+        core.reset(0x82000000);
+        started = true;
+    }
+
+    // 同一个周期里 WB 阶段的提交比 MEM 阶段的陷入更早
+    if (top.cosim_retire && !check_retire(top)) {
+        return false;
+    }
+    if (top.cosim_trap && !check_trap(top)) {
+        return false;
+    }
+    if (top.cosim_xret && !check_xret(top)) {
+        return false;
+    }
+    if (top.cosim_dma_we) {
+        bus.dma_write(top.cosim_dma_adr, top.cosim_dma_dat, top.cosim_dma_sel);
+    }
+    return true;
+}
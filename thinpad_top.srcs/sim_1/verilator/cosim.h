@@ -0,0 +1,59 @@
+// 协同仿真：参考模型（iss/rv32_core）跟随 RTL 的提交逐条执行，在第一处不一致时停止。
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "rv32_core.h"
+
+class Vsim_top;
+
+// 参考模型看到的物理地址空间。SRAM、flash 和 boot ROM 有自己的一份内容，
+// 开始时从存储器模型复制；其余地址都是设备，load 的结果取 RTL 的写回值。
+class CosimBus : public RvBus {
+public:
+    bool init();
+
+    uint32_t read(uint32_t paddr, int size) override;
+    void write(uint32_t paddr, int size, uint32_t data) override;
+
+    // blitter 写入存储器
+    void dma_write(uint32_t paddr, uint32_t data, uint32_t sel);
+
+    // 上一次 read 之后是否访问过设备
+    bool io = false;
+
+private:
+    uint8_t *find(uint32_t paddr, bool writable);
+
+    std::vector<uint8_t> base_ram, ext_ram, flash, rom;
+};
+
+class Cosim {
+public:
+    Cosim() : core(bus) {}
+
+    // 每个周期在时钟下降沿之后调用，返回 false 表示出现了不一致
+    bool tick(const Vsim_top &top, uint64_t cycle);
+
+    uint64_t checked() const { return retired; }
+
+private:
+    bool check_retire(const Vsim_top &top);
+    bool check_trap(const Vsim_top &top);
+    bool check_xret(const Vsim_top &top);
+    bool check_csrs(const Vsim_top &top);
+    void report(const char *what, uint32_t rtl, uint32_t iss);
+    void record(const RvStep &s);
+
+    CosimBus bus;
+    Rv32Core core;
+    bool started = false;
+    uint64_t cycle = 0;
+    uint64_t retired = 0;
+
+    // 最近执行的指令，出现不一致时打印
+    static const int HISTORY = 16;
+    RvStep history[HISTORY];
+    uint64_t steps = 0;
+};
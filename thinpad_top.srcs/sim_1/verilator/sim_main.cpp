@@ -0,0 +1,310 @@
+// thinpad_top 的 Verilator 仿真驱动：加载存储器镜像，产生时钟和复位，
+// 把直连串口桥接到终端。用法见 README 或 --help。
+
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <getopt.h>
+#include <memory>
+#include <string>
+#include <termios.h>
+#include <unistd.h>
+
+#include "Vsim_top.h"
+#include "verilated.h"
+#include "verilated_save.h"
+#if VM_TRACE
+#include "verilated_vcd_c.h"
+#endif
+
+#include "cosim.h"
+#include "fast_models.h"
+#include "sim_uart.h"
+
+// RTL 中 uart_controller 的 CLK_FREQ，仿真中一个时钟周期即一个系统周期
+static const double SYS_CLK_FREQ = 20e6;
+
+static volatile sig_atomic_t interrupted = 0;
+static struct termios saved_termios;
+static bool termios_saved = false;
+
+static void on_sigint(int) { interrupted = 1; }
+
+static void restore_terminal() {
+    if (termios_saved) {
+        tcsetattr(STDIN_FILENO, TCSANOW, &saved_termios);
+    }
+}
+
+// 终端按字符输入、不回显，Ctrl-C 仍然产生 SIGINT
+static void setup_terminal() {
+    if (!isatty(STDIN_FILENO) || tcgetattr(STDIN_FILENO, &saved_termios) != 0) {
+        return;
+    }
+    termios_saved = true;
+    atexit(restore_terminal);
+    struct termios raw = saved_termios;
+    raw.c_lflag &= ~(ICANON | ECHO);
+    raw.c_iflag &= ~ICRNL;
+    raw.c_cc[VMIN] = 0;
+    raw.c_cc[VTIME] = 0;
+    tcsetattr(STDIN_FILENO, TCSANOW, &raw);
+}
+
+// ==== 检查点 ====
+// Verilator 保存的模型状态（寄存器、BRAM 等）之后依次是：周期数、串口桥的状态
+// （UART=dpi 时为 uart_bypass.cpp 中尚未被 RTL 取走的输入）、各个存储区（SRAM、flash）
+// 的名字、大小和内容。VerilatedRestore 会检查模型是否由同一次编译得到。
+
+#ifdef UART_BYPASS
+std::string uart_bypass_pending();
+void uart_bypass_set_pending(const std::string &bytes);
+#endif
+
+static void save_checkpoint(const std::string &path, Vsim_top &top, const SimUart &uart,
+                            uint64_t cycle) {
+    VerilatedSave os;
+    os.open(path.c_str());
+    os << top;
+    os.write(&cycle, sizeof(cycle));
+#ifdef UART_BYPASS
+    (void)uart;
+    std::string pending = uart_bypass_pending();
+    uint32_t pending_len = pending.size();
+    os.write(&pending_len, sizeof(pending_len));
+    os.write(pending.data(), pending_len);
+#else
+    uart.save(os);
+#endif
+    int count = fast_mem_count();
+    os.write(&count, sizeof(count));
+    for (int i = 0; i < count; i++) {
+        std::string name = fast_mem_name(i);
+        uint32_t len = name.size();
+        size_t size;
+        uint8_t *data = fast_mem_data(i, &size);
+        uint64_t size64 = size;
+        os.write(&len, sizeof(len));
+        os.write(name.data(), len);
+        os.write(&size64, sizeof(size64));
+        os.write(data, size);
+    }
+    os.close();
+    fprintf(stderr, "Checkpoint at cycle %llu saved to %s\n", (unsigned long long)cycle,
+            path.c_str());
+}
+
+// 在第一次 eval 之前调用，存储区按保存时的顺序重建，使模型中保存的编号仍然有效
+static bool restore_checkpoint(const std::string &path, Vsim_top &top, SimUart &uart,
+                               uint64_t &cycle) {
+    if (access(path.c_str(), R_OK) != 0) {
+        fprintf(stderr, "Failed to open checkpoint %s\n", path.c_str());
+        return false;
+    }
+    VerilatedRestore is;
+    is.open(path.c_str());
+    is >> top;
+    is.read(&cycle, sizeof(cycle));
+#ifdef UART_BYPASS
+    (void)uart;
+    uint32_t pending_len;
+    is.read(&pending_len, sizeof(pending_len));
+    std::string pending(pending_len, '\0');
+    is.read(&pending[0], pending_len);
+    uart_bypass_set_pending(pending);
+#else
+    uart.restore(is);
+#endif
+    int count;
+    is.read(&count, sizeof(count));
+    for (int i = 0; i < count; i++) {
+        uint32_t len;
+        is.read(&len, sizeof(len));
+        std::string name(len, '\0');
+        is.read(&name[0], len);
+        uint64_t size;
+        is.read(&size, sizeof(size));
+        if (fast_mem_create(name.c_str(), size, 0) != i) {
+            fprintf(stderr, "Failed to restore memory %s\n", name.c_str());
+            return false;
+        }
+        is.read(fast_mem_data(i, nullptr), size);
+    }
+    is.close();
+    fprintf(stderr, "Restored checkpoint at cycle %llu from %s\n", (unsigned long long)cycle,
+            path.c_str());
+    return true;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "Usage: %s [options]\n"
+            "  -b, --base FILE         load FILE into BaseRAM (e.g. main.bin)\n"
+            "  -e, --ext FILE          load FILE into ExtRAM (e.g. eram.bin)\n"
+            "  -f, --flash FILE        load FILE into flash (e.g. kernel.elf)\n"
+            "  -d, --dip VALUE         DIP switches (default 0x2, as in tb.sv)\n"
+            "  -c, --max-cycles N      stop after N cycles (default: run until Ctrl-C)\n"
+            "  -S, --save FILE         save a checkpoint to FILE when the run stops\n"
+            "  -r, --restore FILE      start from a checkpoint instead of reset\n"
+            "      --cosim             check every retired instruction against the reference ISS\n"
+            "  -t, --trace FILE        write a VCD waveform (needs a TRACE=1 build)\n"
+            "  -s, --trace-start N     start the waveform at cycle N\n"
+            "      --baud N            baud rate of the UART bridge (default 115200)\n"
+            "  -h, --help              show this message\n",
+            prog);
+}
+
+int main(int argc, char **argv) {
+    Verilated::commandArgs(argc, argv);
+
+    std::string base_file, ext_file, flash_file, trace_file;
+    std::string save_file, restore_file;
+    uint32_t dip_sw = 0x2;
+    uint64_t max_cycles = 0;
+    uint64_t trace_start = 0;
+    double baud = 115200;
+    bool cosim_on = false;
+
+    static const struct option long_opts[] = {
+        {"base", required_argument, nullptr, 'b'},
+        {"ext", required_argument, nullptr, 'e'},
+        {"flash", required_argument, nullptr, 'f'},
+        {"dip", required_argument, nullptr, 'd'},
+        {"max-cycles", required_argument, nullptr, 'c'},
+        {"save", required_argument, nullptr, 'S'},
+        {"restore", required_argument, nullptr, 'r'},
+        {"trace", required_argument, nullptr, 't'},
+        {"trace-start", required_argument, nullptr, 's'},
+        {"baud", required_argument, nullptr, 'B'},
+        {"cosim", no_argument, nullptr, 'C'},
+        {"help", no_argument, nullptr, 'h'},
+        {nullptr, 0, nullptr, 0},
+    };
+    int opt;
+    while ((opt = getopt_long(argc, argv, "b:e:f:d:c:S:r:t:s:h", long_opts, nullptr)) != -1) {
+        switch (opt) {
+        case 'b': base_file = optarg; break;
+        case 'e': ext_file = optarg; break;
+        case 'f': flash_file = optarg; break;
+        case 'd': dip_sw = strtoul(optarg, nullptr, 0); break;
+        case 'c': max_cycles = strtoull(optarg, nullptr, 0); break;
+        case 'S': save_file = optarg; break;
+        case 'r': restore_file = optarg; break;
+        case 't': trace_file = optarg; break;
+        case 's': trace_start = strtoull(optarg, nullptr, 0); break;
+        case 'B': baud = strtod(optarg, nullptr); break;
+        case 'C': cosim_on = true; break;
+        case 'h': usage(argv[0]); return 0;
+        default: usage(argv[0]); return 1;
+        }
+    }
+
+    if (!restore_file.empty() && !(base_file.empty() && ext_file.empty() && flash_file.empty())) {
+        fprintf(stderr, "Memory contents come from the checkpoint, drop -b/-e/-f\n");
+        return 1;
+    }
+    if (!restore_file.empty() && cosim_on) {
+        fprintf(stderr, "Co-simulation starts from reset and cannot be used with -r\n");
+        return 1;
+    }
+
+    // ==== 初始化文件 ====
+    // 由存储器模型在仿真开始时用 mmap 映射，仿真中的写入不会改动文件
+    for (auto &img : {std::make_pair("base", base_file), std::make_pair("ext", ext_file),
+                      std::make_pair("flash", flash_file)}) {
+        if (img.second.empty()) {
+            continue;
+        }
+        if (access(img.second.c_str(), R_OK) != 0) {
+            fprintf(stderr, "Failed to open %s init file %s\n", img.first, img.second.c_str());
+            return 1;
+        }
+        fast_mem_set_file(img.first, img.second.c_str());
+    }
+
+    auto top = std::make_unique<Vsim_top>();
+
+#if VM_TRACE
+    std::unique_ptr<VerilatedVcdC> vcd;
+    if (!trace_file.empty()) {
+        Verilated::traceEverOn(true);
+        vcd = std::make_unique<VerilatedVcdC>();
+        top->trace(vcd.get(), 99);
+        vcd->open(trace_file.c_str());
+    }
+#else
+    (void)trace_start;
+    if (!trace_file.empty()) {
+        fprintf(stderr, "Waveform tracing is not built in, rebuild with TRACE=1\n");
+        return 1;
+    }
+#endif
+
+    std::unique_ptr<Cosim> cosim;
+    if (cosim_on) {
+        cosim = std::make_unique<Cosim>();
+    }
+
+    SimUart uart(SYS_CLK_FREQ / baud);
+    uint64_t cycle = 0;
+    if (!restore_file.empty() && !restore_checkpoint(restore_file, *top, uart, cycle)) {
+        return 1;
+    }
+    setup_terminal();
+    signal(SIGINT, on_sigint);
+
+    top->clk_50M = 0;
+    top->reset_btn = 1;
+    top->push_btn = 0;
+    top->touch_btn = 0;
+    top->dip_sw = dip_sw;
+    top->rxd = 1;
+
+    auto wall_start = std::chrono::steady_clock::now();
+    const uint64_t start_cycle = cycle;
+    bool diverged = false;
+    while (!Verilated::gotFinish() && !interrupted &&
+           (max_cycles == 0 || cycle - start_cycle < max_cycles)) {
+        // 复位按钮保持若干周期
+        top->reset_btn = cycle < 16;
+
+        top->clk_50M = 1;
+        top->eval();
+#if VM_TRACE
+        if (vcd && cycle >= trace_start) vcd->dump(cycle * 2);
+#endif
+        top->clk_50M = 0;
+        top->eval();
+#if VM_TRACE
+        if (vcd && cycle >= trace_start) vcd->dump(cycle * 2 + 1);
+#endif
+        if (cosim && !cosim->tick(*top, cycle)) {
+            diverged = true;
+            break;
+        }
+
+#ifndef UART_BYPASS
+        top->rxd = uart.tick(top->txd);
+#endif
+        cycle++;
+    }
+
+    if (!save_file.empty()) {
+        save_checkpoint(save_file, *top, uart, cycle);
+    }
+
+    top->final();
+#if VM_TRACE
+    if (vcd) vcd->close();
+#endif
+
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+    uint64_t run = cycle - start_cycle;
+    fprintf(stderr, "\n%llu cycles in %.2f s (%.1f kHz)\n", (unsigned long long)run, secs,
+            secs > 0 ? run / secs / 1e3 : 0.0);
+    if (cosim) {
+        fprintf(stderr, "cosim: %llu instructions checked\n", (unsigned long long)cosim->checked());
+    }
+    return diverged ? 1 : 0;
+}
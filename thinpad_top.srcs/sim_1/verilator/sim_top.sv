@@ -0,0 +1,195 @@
+`timescale 1ns / 1ps
+
+// Verilator 仿真的顶层，代替 tb.sv：连接 thinpad_top 与存储器模型（sim_1/new/fast_*_model.sv），
+// 时钟、复位、串口和按键由 C++ 驱动（sim_main.cpp）。
+module sim_top (
+    input wire clk_50M,
+    input wire reset_btn,
+
+    input wire        push_btn,
+    input wire [ 3:0] touch_btn,
+    input wire [31:0] dip_sw,
+
+    output wire [15:0] leds,
+    output wire [ 7:0] dpy0,
+    output wire [ 7:0] dpy1,
+
+    // 直连串口
+    output wire txd,
+    input  wire rxd,
+
+    // 协同仿真（sim_main.cpp 的 --cosim）观察的 CPU 状态，引自 dut 内部
+    output wire        cosim_retire,
+    output wire [31:0] cosim_retire_pc,
+    output wire [31:0] cosim_retire_instr,
+    output wire [ 4:0] cosim_retire_rd,
+    output wire [31:0] cosim_retire_rd_wdata,
+    output wire [ 1:0] cosim_privilege,
+    output wire        cosim_trap,
+    output wire        cosim_xret,
+    output wire [31:0] cosim_trap_cause,
+    output wire [31:0] cosim_trap_pc,
+    output wire [31:0] cosim_trap_tval,
+    output wire [511:0] cosim_csrs,  // 16 个 CSR，顺序见 cosim.cpp
+    // blitter 写存储器，协同仿真中同样写入参考模型的存储器
+    output wire        cosim_dma_we,
+    output wire [31:0] cosim_dma_adr,
+    output wire [31:0] cosim_dma_dat,
+    output wire [ 3:0] cosim_dma_sel
+);
+
+  wire [31:0] base_ram_data;
+  wire [19:0] base_ram_addr;
+  wire [ 3:0] base_ram_be_n;
+  wire        base_ram_ce_n;
+  wire        base_ram_oe_n;
+  wire        base_ram_we_n;
+
+  wire [31:0] ext_ram_data;
+  wire [19:0] ext_ram_addr;
+  wire [ 3:0] ext_ram_be_n;
+  wire        ext_ram_ce_n;
+  wire        ext_ram_oe_n;
+  wire        ext_ram_we_n;
+
+  wire [22:0] flash_a;
+  wire [15:0] flash_d;
+  wire        flash_rp_n;
+  wire        flash_vpen;
+  wire        flash_ce_n;
+  wire        flash_oe_n;
+  wire        flash_we_n;
+  wire        flash_byte_n;
+
+  thinpad_top dut (
+      .clk_50M       (clk_50M),
+      .clk_11M0592   (clk_50M),
+      .push_btn      (push_btn),
+      .reset_btn     (reset_btn),
+      .touch_btn     (touch_btn),
+      .dip_sw        (dip_sw),
+      .leds          (leds),
+      .dpy0          (dpy0),
+      .dpy1          (dpy1),
+      .uart_rdn      (),
+      .uart_wrn      (),
+      .uart_dataready(1'b0),
+      .uart_tbre     (1'b0),
+      .uart_tsre     (1'b0),
+      .base_ram_data (base_ram_data),
+      .base_ram_addr (base_ram_addr),
+      .base_ram_be_n (base_ram_be_n),
+      .base_ram_ce_n (base_ram_ce_n),
+      .base_ram_oe_n (base_ram_oe_n),
+      .base_ram_we_n (base_ram_we_n),
+      .ext_ram_data  (ext_ram_data),
+      .ext_ram_addr  (ext_ram_addr),
+      .ext_ram_be_n  (ext_ram_be_n),
+      .ext_ram_ce_n  (ext_ram_ce_n),
+      .ext_ram_oe_n  (ext_ram_oe_n),
+      .ext_ram_we_n  (ext_ram_we_n),
+      .txd           (txd),
+      .rxd           (rxd),
+      .flash_a       (flash_a),
+      .flash_d       (flash_d),
+      .flash_rp_n    (flash_rp_n),
+      .flash_vpen    (flash_vpen),
+      .flash_ce_n    (flash_ce_n),
+      .flash_oe_n    (flash_oe_n),
+      .flash_we_n    (flash_we_n),
+      .flash_byte_n  (flash_byte_n),
+      .sl811_a0      (),
+      .sl811_wr_n    (),
+      .sl811_rd_n    (),
+      .sl811_cs_n    (),
+      .sl811_rst_n   (),
+      .sl811_dack_n  (),
+      .sl811_intrq   (1'b0),
+      .sl811_drq_n   (1'b1),
+      .dm9k_cmd      (),
+      .dm9k_sd       (),
+      .dm9k_iow_n    (),
+      .dm9k_ior_n    (),
+      .dm9k_cs_n     (),
+      .dm9k_pwrst_n  (),
+      .dm9k_int      (1'b0),
+      .video_red     (),
+      .video_green   (),
+      .video_blue    (),
+      .video_hsync   (),
+      .video_vsync   (),
+      .video_clk     (),
+      .video_de      ()
+  );
+
+  // WB 阶段的提交在 MEM 阶段的陷入之前，两者可能在同一个周期
+  assign cosim_retire = dut.pipeline_retire;
+  assign cosim_retire_pc = dut.pipeline_retire_pc;
+  assign cosim_retire_instr = dut.pipeline_retire_instr;
+  assign cosim_retire_rd = dut.pipeline_retire_rd_addr;
+  assign cosim_retire_rd_wdata = dut.pipeline_retire_rd_wdata;
+  assign cosim_privilege = dut.exc_privilege;
+  assign cosim_trap = dut.exc_exc_en;
+  assign cosim_xret = dut.exc_exc_ret;
+  assign cosim_trap_cause = {dut.exc_interrupt, dut.u_exc_unit.exc_code};
+  assign cosim_trap_pc = dut.exc_cur_pc;
+  assign cosim_trap_tval = dut.exc_mtval;
+  assign cosim_csrs = {
+    dut.u_exc_unit.satp_reg,
+    dut.u_exc_unit.sscratch_reg,
+    dut.u_exc_unit.stvec_reg,
+    dut.u_exc_unit.stval_reg,
+    dut.u_exc_unit.scause_reg,
+    dut.u_exc_unit.sepc_reg,
+    dut.u_exc_unit.menvcfg_reg[63:32],
+    dut.u_exc_unit.mideleg_reg,
+    dut.u_exc_unit.medeleg_reg,
+    dut.u_exc_unit.mtval_reg,
+    dut.u_exc_unit.mcause_reg,
+    dut.u_exc_unit.mepc_reg,
+    dut.u_exc_unit.mscratch_reg,
+    dut.u_exc_unit.mtvec_reg,
+    dut.u_exc_unit.mie_reg,
+    dut.u_exc_unit.mstatus_reg
+  };
+  assign cosim_dma_we = dut.blit_wbm_cyc_o & dut.blit_wbm_stb_o & dut.blit_wbm_we_o & dut.blit_wbm_ack_i;
+  assign cosim_dma_adr = dut.blit_wbm_adr_o;
+  assign cosim_dma_dat = dut.blit_wbm_dat_o;
+  assign cosim_dma_sel = dut.blit_wbm_sel_o;
+
+  // 存储器模型与 tb.sv 的 FAST_MODELS 模式相同，初始化文件由 sim_main.cpp 指定
+  fast_sram_model #(
+      .NAME("base")
+  ) base_ram (
+      .addr(base_ram_addr),
+      .data(base_ram_data),
+      .be_n(base_ram_be_n),
+      .ce_n(base_ram_ce_n),
+      .oe_n(base_ram_oe_n),
+      .we_n(base_ram_we_n)
+  );
+
+  fast_sram_model #(
+      .NAME("ext")
+  ) ext_ram (
+      .addr(ext_ram_addr),
+      .data(ext_ram_data),
+      .be_n(ext_ram_be_n),
+      .ce_n(ext_ram_ce_n),
+      .oe_n(ext_ram_oe_n),
+      .we_n(ext_ram_we_n)
+  );
+
+  fast_flash_model #(
+      .NAME("flash")
+  ) flash (
+      .a     (flash_a),
+      .d     (flash_d),
+      .ce_n  (flash_ce_n),
+      .oe_n  (flash_oe_n),
+      .we_n  (flash_we_n),
+      .rp_n  (flash_rp_n),
+      .byte_n(flash_byte_n)
+  );
+
+endmodule
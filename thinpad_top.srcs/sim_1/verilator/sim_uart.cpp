@@ -0,0 +1,114 @@
+#include "sim_uart.h"
+
+#include <cstdio>
+#include <poll.h>
+#include <unistd.h>
+#include <vector>
+
+#include "verilated_save.h"
+
+SimUart::SimUart(double cycles_per_bit) : cycles_per_bit_(cycles_per_bit) {}
+
+void SimUart::poll_stdin() {
+    struct pollfd pfd = {STDIN_FILENO, POLLIN, 0};
+    if (poll(&pfd, 1, 0) <= 0) {
+        return;
+    }
+    uint8_t buf[64];
+    ssize_t n = read(STDIN_FILENO, buf, sizeof(buf));
+    if (n <= 0) {
+        stdin_eof_ = true;
+        return;
+    }
+    input_.insert(input_.end(), buf, buf + n);
+}
+
+int SimUart::tick(int txd) {
+    cycle_++;
+
+    // ==== FPGA -> 主机 ====
+    if (!rx_busy_) {
+        if (rx_prev_ && !txd) {
+            // 起始位的下降沿
+            rx_busy_ = true;
+            rx_start_ = cycle_;
+            rx_bit_ = 0;
+            rx_shift_ = 0;
+        }
+    } else {
+        // 在每一位的中间采样，第 0 位为起始位，第 9 位为停止位
+        double sample = rx_start_ + (rx_bit_ + 0.5) * cycles_per_bit_;
+        if (cycle_ >= sample) {
+            if (rx_bit_ == 0) {
+                if (txd) {
+                    rx_busy_ = false;  // 毛刺
+                }
+            } else if (rx_bit_ <= 8) {
+                rx_shift_ |= (txd & 1) << (rx_bit_ - 1);
+            } else {
+                putchar(rx_shift_);
+                fflush(stdout);
+                tx_bytes_++;
+                rx_busy_ = false;
+            }
+            rx_bit_++;
+        }
+    }
+    rx_prev_ = txd;
+
+    // ==== 主机 -> FPGA ====
+    if (!tx_busy_) {
+        if (input_.empty() && !stdin_eof_ && (cycle_ & 0x3FF) == 0) {
+            poll_stdin();
+        }
+        if (input_.empty()) {
+            return 1;
+        }
+        // 停止位、8 位数据（低位在前）、起始位
+        tx_frame_ = 1 << 9 | input_.front() << 1;
+        input_.pop_front();
+        tx_busy_ = true;
+        tx_start_ = cycle_;
+    }
+    int bit = static_cast<int>((cycle_ - tx_start_) / cycles_per_bit_);
+    if (bit >= 10) {
+        tx_busy_ = false;
+        return 1;
+    }
+    return (tx_frame_ >> bit) & 1;
+}
+
+void SimUart::save(VerilatedSerialize &os) const {
+    os.write(&cycle_, sizeof(cycle_));
+    os.write(&rx_busy_, sizeof(rx_busy_));
+    os.write(&rx_prev_, sizeof(rx_prev_));
+    os.write(&rx_start_, sizeof(rx_start_));
+    os.write(&rx_bit_, sizeof(rx_bit_));
+    os.write(&rx_shift_, sizeof(rx_shift_));
+    os.write(&tx_bytes_, sizeof(tx_bytes_));
+    os.write(&tx_busy_, sizeof(tx_busy_));
+    os.write(&tx_start_, sizeof(tx_start_));
+    os.write(&tx_frame_, sizeof(tx_frame_));
+    std::vector<uint8_t> input(input_.begin(), input_.end());
+    uint64_t n = input.size();
+    os.write(&n, sizeof(n));
+    os.write(input.data(), n);
+}
+
+void SimUart::restore(VerilatedDeserialize &is) {
+    is.read(&cycle_, sizeof(cycle_));
+    is.read(&rx_busy_, sizeof(rx_busy_));
+    is.read(&rx_prev_, sizeof(rx_prev_));
+    is.read(&rx_start_, sizeof(rx_start_));
+    is.read(&rx_bit_, sizeof(rx_bit_));
+    is.read(&rx_shift_, sizeof(rx_shift_));
+    is.read(&tx_bytes_, sizeof(tx_bytes_));
+    is.read(&tx_busy_, sizeof(tx_busy_));
+    is.read(&tx_start_, sizeof(tx_start_));
+    is.read(&tx_frame_, sizeof(tx_frame_));
+    uint64_t n;
+    is.read(&n, sizeof(n));
+    std::vector<uint8_t> input(n);
+    is.read(input.data(), n);
+    input_.assign(input.begin(), input.end());
+}
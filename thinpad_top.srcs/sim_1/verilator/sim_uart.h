@@ -0,0 +1,45 @@
+// 把直连串口的 txd/rxd 引脚桥接到标准输入输出，按 8N1 逐位收发
+#pragma once
+
+#include <cstdint>
+#include <deque>
+
+class VerilatedSerialize;
+class VerilatedDeserialize;
+
+class SimUart {
+  public:
+    // cycles_per_bit 为每一位占用的系统周期数
+    explicit SimUart(double cycles_per_bit);
+
+    // 每个系统周期调用一次，txd 为 FPGA 的发送端，返回 FPGA 接收端 rxd 的电平
+    int tick(int txd);
+
+    // 输出的字节数
+    uint64_t tx_bytes() const { return tx_bytes_; }
+
+    // 检查点中的状态，包括收发到一半的字节和尚未送出的输入
+    void save(VerilatedSerialize &os) const;
+    void restore(VerilatedDeserialize &is);
+
+  private:
+    void poll_stdin();
+
+    double cycles_per_bit_;
+    uint64_t cycle_ = 0;
+
+    // FPGA -> 主机
+    bool rx_busy_ = false;
+    int rx_prev_ = 1;
+    uint64_t rx_start_ = 0;
+    int rx_bit_ = 0;
+    uint8_t rx_shift_ = 0;
+    uint64_t tx_bytes_ = 0;
+
+    // 主机 -> FPGA
+    std::deque<uint8_t> input_;
+    bool stdin_eof_ = false;
+    bool tx_busy_ = false;
+    uint64_t tx_start_ = 0;
+    uint16_t tx_frame_ = 0;
+};
@@ -0,0 +1,34 @@
+`timescale 1ns / 1ps
+
+// Verilator 仿真用的 pic_bram 替身，按 IP 的配置实现：A 口 32 位写、带字节使能，
+// 32768 项；B 口 8 位读，地址低两位选择字节（字节 0 为低 8 位），
+// 打开了原语输出寄存器，读延迟为 2 个周期。初始内容为 0，不加载 coe 文件。
+module pic_bram (
+    input  wire        clka,
+    input  wire        ena,
+    input  wire [ 3:0] wea,
+    input  wire [14:0] addra,
+    input  wire [31:0] dina,
+    input  wire        clkb,
+    input  wire        enb,
+    input  wire [16:0] addrb,
+    output reg  [ 7:0] doutb
+);
+
+  reg [31:0] mem[0:32767];
+  reg [ 7:0] q;
+
+  always @(posedge clka) begin
+    if (ena) begin
+      for (integer i = 0; i < 4; i = i + 1) begin
+        if (wea[i]) mem[addra][i*8+:8] <= dina[i*8+:8];
+      end
+    end
+  end
+
+  always @(posedge clkb) begin
+    if (enb) q <= mem[addrb[16:2]][{addrb[1:0], 3'b000}+:8];
+    doutb <= q;
+  end
+
+endmodule
@@ -0,0 +1,28 @@
+`timescale 1ns / 1ps
+
+// Verilator 仿真用的 pic_mem_1 替身，配置与 pic_bram 相同
+module pic_mem_1 (
+    input  wire        clka,
+    input  wire        ena,
+    input  wire [ 3:0] wea,
+    input  wire [14:0] addra,
+    input  wire [31:0] dina,
+    input  wire        clkb,
+    input  wire        enb,
+    input  wire [16:0] addrb,
+    output wire [ 7:0] doutb
+);
+
+  pic_bram mem (
+      .clka (clka),
+      .ena  (ena),
+      .wea  (wea),
+      .addra(addra),
+      .dina (dina),
+      .clkb (clkb),
+      .enb  (enb),
+      .addrb(addrb),
+      .doutb(doutb)
+  );
+
+endmodule
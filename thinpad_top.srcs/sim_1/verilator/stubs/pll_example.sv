@@ -0,0 +1,29 @@
+`timescale 1ns / 1ps
+
+// Verilator 仿真用的 pll_example 替身。仿真中不区分时钟频率，两个输出都直接
+// 使用输入时钟，输入时钟的每个周期即为一个系统周期。
+module pll_example (
+    input  wire clk_in1,
+    output wire clk_out1,
+    output wire clk_out2,
+    input  wire reset,
+    output reg  locked
+);
+
+  assign clk_out1 = clk_in1;
+  assign clk_out2 = clk_in1;
+
+  // 复位释放后若干周期再给出 locked，与真实 PLL 一样让后级电路晚于输入时钟解除复位
+  reg [3:0] lock_cnt;
+  always @(posedge clk_in1 or posedge reset) begin
+    if (reset) begin
+      lock_cnt <= 4'd0;
+      locked <= 1'b0;
+    end else if (lock_cnt != 4'hF) begin
+      lock_cnt <= lock_cnt + 4'd1;
+    end else begin
+      locked <= 1'b1;
+    end
+  end
+
+endmodule
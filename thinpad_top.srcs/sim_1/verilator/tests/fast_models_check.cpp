@@ -0,0 +1,150 @@
+// fast_models.cpp 的自检：按 fast_sram_model / fast_flash_model 调用 DPI 函数的方式访问存储区，
+// 与直接读文件、逐字节的参考数组比较。不需要 Verilator，用法见 Makefile 的 fast_models_check。
+//
+//   fast_models_check FLASH_IMAGE BASE_IMAGE
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "fast_models.h"
+
+namespace {
+
+const int SRAM_SIZE = 4 << 20;
+const int FLASH_SIZE = 8 << 20;
+
+int errors = 0;
+
+void expect(bool ok, const char *what, long addr, unsigned got, unsigned want) {
+    if (!ok && errors++ < 10) {
+        fprintf(stderr, "%s at 0x%06lx: got 0x%x, expected 0x%x\n", what, addr, got, want);
+    }
+}
+
+std::vector<uint8_t> read_file(const char *path) {
+    std::ifstream f(path, std::ios::binary);
+    if (!f) {
+        fprintf(stderr, "Failed to open %s\n", path);
+        exit(1);
+    }
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(f), {});
+}
+
+// fast_flash_model：a[22:2] 选字，a[1] 选半字
+unsigned flash_read16(int handle, unsigned a) {
+    unsigned word = fast_mem_read(handle, a & ~3u, handle);
+    return (a & 2) ? word >> 16 : word & 0xffff;
+}
+
+void check_flash(const char *path) {
+    std::vector<uint8_t> file = read_file(path);
+    fast_mem_set_file("flash", path);
+    int h = fast_mem_open("flash", "", FLASH_SIZE, 0xFF);
+    expect(h >= 0, "flash open", 0, h, 0);
+    for (unsigned a = 0; a < static_cast<unsigned>(FLASH_SIZE); a += 2) {
+        unsigned want = 0xffff;
+        if (a < file.size()) {
+            want = (want & 0xff00) | file[a];
+        }
+        if (a + 1 < file.size()) {
+            want = (want & 0x00ff) | file[a + 1] << 8;
+        }
+        unsigned got = flash_read16(h, a);
+        expect(got == want, "flash read", a, got, want);
+    }
+    expect(fast_mem_open("flash", "", FLASH_SIZE, 0xFF) == h, "flash reopen", 0, 0, 0);
+}
+
+// fast_sram_model：addr 为字地址，be 为 ~be_n
+void check_sram(const char *name, const char *path) {
+    std::vector<uint8_t> ref(SRAM_SIZE, 0);
+    std::vector<uint8_t> file;
+    if (path) {
+        file = read_file(path);
+        memcpy(ref.data(), file.data(), std::min(file.size(), ref.size()));
+        fast_mem_set_file(name, path);
+    }
+    int h = fast_mem_open(name, "", SRAM_SIZE, 0);
+    expect(h >= 0, "sram open", 0, h, 0);
+
+    std::mt19937 rng(1);
+    int version = 0;
+    for (int n = 0; n < 200000; n++) {
+        // 集中在开头和结尾，使写过的地址会被再次读写
+        unsigned word = rng() % 4096;
+        if (rng() & 1) {
+            word = SRAM_SIZE / 4 - 1 - word;
+        }
+        unsigned addr = word << 2;
+        if (rng() & 1) {
+            unsigned data = rng();
+            int be = rng() & 0xf;
+            fast_mem_write(h, addr, data, be);
+            version++;
+            for (int i = 0; i < 4; i++) {
+                if (be & (1 << i)) {
+                    ref[addr + i] = data >> (i * 8);
+                }
+            }
+        } else {
+            unsigned got = fast_mem_read(h, addr, version);
+            unsigned want = ref[addr] | ref[addr + 1] << 8 | ref[addr + 2] << 16 |
+                            static_cast<unsigned>(ref[addr + 3]) << 24;
+            expect(got == want, name, addr, got, want);
+        }
+    }
+    size_t size;
+    uint8_t *data = fast_mem_data(h, &size);
+    expect(size == ref.size() && memcmp(data, ref.data(), size) == 0, "sram contents", 0, 0, 0);
+
+    // MAP_PRIVATE：仿真中的写入不能改动初始化文件
+    if (path) {
+        expect(read_file(path) == file, "init file modified", 0, 0, 0);
+    }
+}
+
+// 检查点恢复时按保存的顺序重建存储区，内容整块复制
+void check_recreate() {
+    int count = fast_mem_count();
+    std::vector<std::vector<uint8_t>> saved;
+    for (int i = 0; i < count; i++) {
+        size_t size;
+        uint8_t *data = fast_mem_data(i, &size);
+        saved.emplace_back(data, data + size);
+    }
+    for (int i = 0; i < count; i++) {
+        std::string name = std::string(fast_mem_name(i)) + ".restored";
+        int h = fast_mem_create(name.c_str(), saved[i].size(), 0);
+        expect(h == count + i, "create handle", i, h, count + i);
+        memcpy(fast_mem_data(h, nullptr), saved[i].data(), saved[i].size());
+        unsigned got = fast_mem_read(h, 0, 0);
+        unsigned want = fast_mem_read(i, 0, 0);
+        expect(got == want, "restored word 0", i, got, want);
+    }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        fprintf(stderr, "Usage: %s FLASH_IMAGE BASE_IMAGE\n", argv[0]);
+        return 1;
+    }
+    check_flash(argv[1]);
+    check_sram("base", argv[2]);
+    check_sram("ext", nullptr);
+    check_recreate();
+    if (errors) {
+        printf("fast_models_check: %d check(s) failed\n", errors);
+        return 1;
+    }
+    printf("fast_models_check: all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,52 @@
+// Synchronous first-word-fall-through FIFO.
+// rd_data_o shows the head entry whenever empty_o is low; rd_en_i pops it.
+// Pushing when full or popping when empty is ignored.
+module sync_fifo #(
+    parameter DATA_WIDTH = 8,
+    parameter DEPTH_LOG2 = 4
+) (
+    input wire clk_i,
+    input wire rst_i,
+    input wire clr_i,  // drop all entries
+
+    input wire                  wr_en_i,
+    input wire [DATA_WIDTH-1:0] wr_data_i,
+    input wire                  rd_en_i,
+    output wire [DATA_WIDTH-1:0] rd_data_o,
+
+    output wire                full_o,
+    output wire                empty_o,
+    output wire [DEPTH_LOG2:0] count_o
+);
+
+  localparam DEPTH = 2 ** DEPTH_LOG2;
+
+  reg [DATA_WIDTH-1:0] mem [0:DEPTH-1];
+  reg [DEPTH_LOG2:0] wr_ptr;
+  reg [DEPTH_LOG2:0] rd_ptr;
+
+  wire do_write = wr_en_i && !full_o;
+  wire do_read = rd_en_i && !empty_o;
+
+  assign count_o = wr_ptr - rd_ptr;
+  assign full_o = count_o == DEPTH;
+  assign empty_o = count_o == 0;
+  assign rd_data_o = mem[rd_ptr[DEPTH_LOG2-1:0]];
+
+  always_ff @(posedge clk_i) begin
+    if (do_write) begin
+      mem[wr_ptr[DEPTH_LOG2-1:0]] <= wr_data_i;
+    end
+  end
+
+  always_ff @(posedge clk_i) begin
+    if (rst_i || clr_i) begin
+      wr_ptr <= 0;
+      rd_ptr <= 0;
+    end else begin
+      if (do_write) wr_ptr <= wr_ptr + 1;
+      if (do_read) rd_ptr <= rd_ptr + 1;
+    end
+  end
+
+endmodule
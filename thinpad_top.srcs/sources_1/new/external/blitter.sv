@@ -0,0 +1,377 @@
+module blitter #(
+    parameter WISHBONE_DATA_WIDTH = 32,
+    parameter WISHBONE_ADDR_WIDTH = 32,
+
+    // 两块显存在总线上的基地址
+    parameter BRAM_0_BASE = 32'h8100_0000,
+    parameter BRAM_1_BASE = 32'h8400_0000
+) (
+    // clock and reset
+    input wire clk_i,
+    input wire rst_i,
+
+    // wishbone slave interface（寄存器读写）
+    input wire wb_cyc_i,
+    input wire wb_stb_i,
+    output reg wb_ack_o,
+    input wire [WISHBONE_ADDR_WIDTH-1:0] wb_adr_i,
+    input wire [WISHBONE_DATA_WIDTH-1:0] wb_dat_i,
+    output reg [WISHBONE_DATA_WIDTH-1:0] wb_dat_o,
+    input wire [WISHBONE_DATA_WIDTH/8-1:0] wb_sel_i,
+    input wire wb_we_i,
+
+    // wishbone master interface（搬运像素）
+    output reg wbm_cyc_o,
+    output reg wbm_stb_o,
+    input wire wbm_ack_i,
+    output reg [WISHBONE_ADDR_WIDTH-1:0] wbm_adr_o,
+    output reg [WISHBONE_DATA_WIDTH-1:0] wbm_dat_o,
+    input wire [WISHBONE_DATA_WIDTH-1:0] wbm_dat_i,
+    output reg [WISHBONE_DATA_WIDTH/8-1:0] wbm_sel_o,
+    output reg wbm_we_o,
+
+    // 当前后台缓冲区（0: bram 0，1: bram 1）
+    input wire back_sele,
+
+    // 搬运完成时拉高一个周期，接到 PLIC
+    output reg done_o
+);
+
+    // 寄存器地址
+    // 0x8700_0000 控制寄存器，写 1 到 bit0 启动一次搬运
+    //   bit0 START    启动
+    //   bit1 KEY_EN   跳过与关键色相同的源像素（透明色）
+    //   bit2 HFLIP    水平翻转源矩形
+    //   bit3 DST_ABS  目的地址为总线绝对地址，否则为后台缓冲区内的偏移
+    //   bit4 FILL     不读源，直接用填充色填满目的矩形
+    //   bit5 WORD     按字搬运（宽度以字为单位，忽略 KEY_EN 和 HFLIP），用作 DMA
+    // 0x8700_0004 状态寄存器
+    //   bit0 BUSY
+    //   bit1 ERROR    上一次启动被拒绝：显存只有写口，不能作为源（FILL 除外）
+    // 0x8700_0008 源地址（总线地址，矩形左上角）
+    // 0x8700_000C 源行跨度（字节）
+    // 0x8700_0010 目的地址
+    // 0x8700_0014 目的行跨度（字节），一般为 800 >> vga_scale
+    // 0x8700_0018 矩形大小，[15:0] 宽（像素或字），[31:16] 高
+    // 0x8700_001C 透明关键色 [7:0]
+    // 0x8700_0020 填充色 [7:0]
+    localparam REG_CTRL       = 8'h00;
+    localparam REG_STATUS     = 8'h04;
+    localparam REG_SRC_ADDR   = 8'h08;
+    localparam REG_SRC_STRIDE = 8'h0C;
+    localparam REG_DST_ADDR   = 8'h10;
+    localparam REG_DST_STRIDE = 8'h14;
+    localparam REG_SIZE       = 8'h18;
+    localparam REG_KEY        = 8'h1C;
+    localparam REG_COLOR      = 8'h20;
+
+    localparam CTRL_START   = 0;
+    localparam CTRL_KEY_EN  = 1;
+    localparam CTRL_HFLIP   = 2;
+    localparam CTRL_DST_ABS = 3;
+    localparam CTRL_FILL    = 4;
+    localparam CTRL_WORD    = 5;
+
+    /* =========== 寄存器接口 =========== */
+
+    // 状态转移
+    typedef enum logic [1:0] {
+        IDLE = 0,
+        READ = 1,
+        WRITE = 2
+    } state_t;
+    state_t state, next_state;
+
+    always @(posedge clk_i) begin
+        if (rst_i) begin
+            state <= IDLE;
+        end else begin
+            state <= next_state;
+        end
+    end
+
+    always_comb begin
+        next_state = IDLE;
+        case(state)
+            IDLE: begin
+                if (wb_cyc_i && wb_stb_i) begin
+                    if (wb_we_i) begin  // write
+                        next_state = WRITE;
+                    end else begin  // read
+                        next_state = READ;
+                    end
+                end
+            end
+
+            READ: begin
+                next_state = IDLE;  // 两周期读
+            end
+
+            WRITE: begin
+                next_state = IDLE;  // 两周期写
+            end
+
+            default: ;
+        endcase
+    end
+
+    reg [31:0] ctrl_reg;
+    reg [31:0] src_addr_reg;
+    reg [31:0] src_stride_reg;
+    reg [31:0] dst_addr_reg;
+    reg [31:0] dst_stride_reg;
+    reg [31:0] size_reg;
+    reg [31:0] key_reg;
+    reg [31:0] color_reg;
+
+    reg busy;
+    reg error;
+    reg start_req;
+
+    logic [WISHBONE_DATA_WIDTH-1:0] wb_dat_o_tmp;
+
+    // 数据转移
+    always_comb begin
+        // 根据不同地址，选择不同的寄存器
+        case (wb_adr_i[7:0])
+            REG_CTRL:       wb_dat_o_tmp = ctrl_reg;
+            REG_STATUS:     wb_dat_o_tmp = {30'b0, error, busy | start_req};
+            REG_SRC_ADDR:   wb_dat_o_tmp = src_addr_reg;
+            REG_SRC_STRIDE: wb_dat_o_tmp = src_stride_reg;
+            REG_DST_ADDR:   wb_dat_o_tmp = dst_addr_reg;
+            REG_DST_STRIDE: wb_dat_o_tmp = dst_stride_reg;
+            REG_SIZE:       wb_dat_o_tmp = size_reg;
+            REG_KEY:        wb_dat_o_tmp = key_reg;
+            REG_COLOR:      wb_dat_o_tmp = color_reg;
+            // if address is not valid, return 15
+            default:        wb_dat_o_tmp = 32'h0000_1111;
+        endcase
+    end
+
+    always_ff @ (posedge clk_i) begin
+        if (rst_i) begin
+            wb_ack_o <= 0;
+
+            ctrl_reg <= 32'h0;
+            src_addr_reg <= 32'h0;
+            src_stride_reg <= 32'h0;
+            dst_addr_reg <= 32'h0;
+            dst_stride_reg <= 32'h0;
+            size_reg <= 32'h0;
+            key_reg <= 32'h0;
+            color_reg <= 32'h0;
+
+            start_req <= 0;
+        end else begin
+            // 搬运引擎接受请求后清除
+            if (start_req && !busy) begin
+                start_req <= 0;
+            end
+
+            case(state)
+                IDLE: begin
+                    if (wb_cyc_i && wb_stb_i) begin
+                        if (!wb_we_i) begin  // read
+                            wb_dat_o <= wb_dat_o_tmp;
+                        end else begin       // write
+                            case (wb_adr_i[7:0])
+                                REG_CTRL: begin
+                                    // START 位不保存，只产生一次启动请求
+                                    ctrl_reg <= {wb_dat_i[31:1], 1'b0};
+                                    if (wb_dat_i[CTRL_START]) begin
+                                        start_req <= 1;
+                                    end
+                                end
+                                REG_SRC_ADDR:   src_addr_reg <= wb_dat_i;
+                                REG_SRC_STRIDE: src_stride_reg <= wb_dat_i;
+                                REG_DST_ADDR:   dst_addr_reg <= wb_dat_i;
+                                REG_DST_STRIDE: dst_stride_reg <= wb_dat_i;
+                                REG_SIZE:       size_reg <= wb_dat_i;
+                                REG_KEY:        key_reg <= wb_dat_i;
+                                REG_COLOR:      color_reg <= wb_dat_i;
+                                default: ;
+                            endcase
+                        end
+                        wb_ack_o <= 1;
+                    end
+                end
+
+                READ: begin
+                    wb_ack_o <= 0;
+                end
+
+                WRITE: begin
+                    wb_ack_o <= 0;
+                end
+
+                default: ;
+            endcase
+        end
+    end
+
+    /* =========== 搬运引擎 =========== */
+
+    // 每个像素先读源（FILL 模式跳过），再写目的（关键色跳过）
+    // 每次总线访问结束后释放 cyc，使仲裁器可以轮流服务 CPU
+    typedef enum logic [1:0] {
+        BLIT_IDLE = 0,
+        BLIT_READ = 1,
+        BLIT_WRITE = 2,
+        BLIT_NEXT = 3
+    } blit_state_t;
+    blit_state_t blit_state;
+
+    // 启动时锁存的参数，运行期间寄存器可以被改写
+    reg key_en;
+    reg hflip;
+    reg fill;
+    reg word;
+    reg [7:0] key;
+    reg [15:0] width;
+    reg [15:0] height;
+    reg [31:0] src_stride;
+    reg [31:0] dst_stride;
+
+    // 当前行的起始地址和行列计数
+    reg [31:0] src_row;
+    reg [31:0] dst_row;
+    reg [15:0] col;
+    reg [15:0] row;
+    reg [7:0] pixel;
+    reg [31:0] word_data;
+
+    wire [31:0] src_addr;
+    wire [31:0] dst_addr;
+    assign src_addr = src_row + (word ? {14'b0, col, 2'b00} : {16'b0, hflip ? width - 16'd1 - col : col});
+    assign dst_addr = dst_row + (word ? {14'b0, col, 2'b00} : {16'b0, col});
+
+    // 显存的总线一侧只能写，从这里读出的不是像素
+    wire src_in_bram;
+    assign src_in_bram = src_addr_reg[31:24] == BRAM_0_BASE[31:24] ||
+                         src_addr_reg[31:24] == BRAM_1_BASE[31:24];
+
+    // 读回的数据按字节位置取出
+    wire [7:0] src_pixel;
+    assign src_pixel = wbm_dat_i[{wbm_adr_o[1:0], 3'b000} +: 8];
+
+    always_ff @ (posedge clk_i) begin
+        if (rst_i) begin
+            blit_state <= BLIT_IDLE;
+            busy <= 0;
+            error <= 0;
+            done_o <= 0;
+
+            wbm_cyc_o <= 0;
+            wbm_stb_o <= 0;
+            wbm_we_o <= 0;
+            wbm_sel_o <= 0;
+            wbm_adr_o <= 0;
+            wbm_dat_o <= 0;
+        end else begin
+            done_o <= 0;
+            case (blit_state)
+                BLIT_IDLE: begin
+                    if (start_req) begin
+                        key_en <= ctrl_reg[CTRL_KEY_EN];
+                        hflip <= ctrl_reg[CTRL_HFLIP];
+                        fill <= ctrl_reg[CTRL_FILL];
+                        word <= ctrl_reg[CTRL_WORD];
+                        key <= key_reg[7:0];
+                        pixel <= color_reg[7:0];
+                        word_data <= {4{color_reg[7:0]}};
+                        width <= size_reg[15:0];
+                        height <= size_reg[31:16];
+                        src_stride <= src_stride_reg;
+                        dst_stride <= dst_stride_reg;
+
+                        src_row <= src_addr_reg;
+                        // 目的地址默认相对于后台缓冲区
+                        if (ctrl_reg[CTRL_DST_ABS]) begin
+                            dst_row <= dst_addr_reg;
+                        end else begin
+                            dst_row <= (back_sele ? BRAM_1_BASE : BRAM_0_BASE) + dst_addr_reg;
+                        end
+                        col <= 0;
+                        row <= 0;
+
+                        error <= 0;
+                        if (!ctrl_reg[CTRL_FILL] && src_in_bram) begin
+                            // 拒绝搬运，仍然给出完成脉冲，等待中断的软件读 STATUS 得知出错
+                            error <= 1;
+                            done_o <= 1;
+                            blit_state <= BLIT_IDLE;
+                        end else if (size_reg[15:0] == 0 || size_reg[31:16] == 0) begin
+                            // 空矩形没有可搬运的像素，同样给出完成脉冲，等待中断的软件不会挂起
+                            done_o <= 1;
+                            blit_state <= BLIT_IDLE;
+                        end else if (ctrl_reg[CTRL_FILL]) begin
+                            busy <= 1;
+                            blit_state <= BLIT_WRITE;
+                        end else begin
+                            busy <= 1;
+                            blit_state <= BLIT_READ;
+                        end
+                    end
+                end
+
+                BLIT_READ: begin
+                    if (!wbm_cyc_o) begin
+                        wbm_cyc_o <= 1;
+                        wbm_stb_o <= 1;
+                        wbm_we_o <= 0;
+                        wbm_adr_o <= src_addr;
+                        wbm_sel_o <= word ? 4'b1111 : 4'b0001 << src_addr[1:0];
+                    end else if (wbm_ack_i) begin
+                        wbm_cyc_o <= 0;
+                        wbm_stb_o <= 0;
+                        pixel <= src_pixel;
+                        word_data <= wbm_dat_i;
+                        blit_state <= BLIT_WRITE;
+                    end
+                end
+
+                BLIT_WRITE: begin
+                    if (!wbm_cyc_o) begin
+                        if (key_en && !word && pixel == key) begin
+                            // 透明像素，不写入
+                            blit_state <= BLIT_NEXT;
+                        end else begin
+                            wbm_cyc_o <= 1;
+                            wbm_stb_o <= 1;
+                            wbm_we_o <= 1;
+                            wbm_adr_o <= dst_addr;
+                            // 数据在每个字节上都复制一份，不同从设备的字节对齐方式都能正确写入
+                            wbm_dat_o <= word ? word_data : {4{pixel}};
+                            wbm_sel_o <= word ? 4'b1111 : 4'b0001 << dst_addr[1:0];
+                        end
+                    end else if (wbm_ack_i) begin
+                        wbm_cyc_o <= 0;
+                        wbm_stb_o <= 0;
+                        wbm_we_o <= 0;
+                        blit_state <= BLIT_NEXT;
+                    end
+                end
+
+                BLIT_NEXT: begin
+                    if (col == width - 1) begin
+                        col <= 0;
+                        row <= row + 1;
+                        src_row <= src_row + src_stride;
+                        dst_row <= dst_row + dst_stride;
+                        if (row == height - 1) begin
+                            busy <= 0;
+                            done_o <= 1;
+                            blit_state <= BLIT_IDLE;
+                        end else begin
+                            blit_state <= fill ? BLIT_WRITE : BLIT_READ;
+                        end
+                    end else begin
+                        col <= col + 1;
+                        blit_state <= fill ? BLIT_WRITE : BLIT_READ;
+                    end
+                end
+            endcase
+        end
+    end
+
+endmodule
@@ -0,0 +1,100 @@
+module boot_rom #(
+    parameter WISHBONE_DATA_WIDTH = 32,
+    parameter WISHBONE_ADDR_WIDTH = 32,
+
+    parameter ROM_ADDR_WIDTH = 8,           // 字地址宽度，默认 1KB
+    parameter INIT_FILE = "bootrom.mem"     // 由 bootrom/bootrom.S 生成
+) (
+    // clock and reset
+    input wire clk_i,
+    input wire rst_i,
+
+    // wishbone slave interface
+    input wire wb_cyc_i,
+    input wire wb_stb_i,
+    output reg wb_ack_o,
+    input wire [WISHBONE_ADDR_WIDTH-1:0] wb_adr_i,
+    input wire [WISHBONE_DATA_WIDTH-1:0] wb_dat_i,
+    output reg [WISHBONE_DATA_WIDTH-1:0] wb_dat_o,
+    input wire [WISHBONE_DATA_WIDTH/8-1:0] wb_sel_i,
+    input wire wb_we_i
+);
+
+    // 复位向量处的只读启动代码，写入直接应答并丢弃
+    (* rom_style = "block" *)
+    reg [31:0] rom [0:2**ROM_ADDR_WIDTH-1];
+
+    initial begin
+        $readmemh(INIT_FILE, rom);
+    end
+
+    // 状态转移
+    typedef enum logic [1:0] {
+        IDLE = 0,
+        READ = 1,
+        WRITE = 2
+    } state_t;
+    state_t state, next_state;
+
+    always @(posedge clk_i) begin
+        if (rst_i) begin
+            state <= IDLE;
+        end else begin
+            state <= next_state;
+        end
+    end
+
+    always_comb begin
+        next_state = IDLE;
+        case(state)
+            IDLE: begin
+                if (wb_cyc_i && wb_stb_i) begin
+                    if (wb_we_i) begin  // write
+                        next_state = WRITE;
+                    end else begin  // read
+                        next_state = READ;
+                    end
+                end
+            end
+
+            READ: begin
+                next_state = IDLE;  // 两周期读
+            end
+
+            WRITE: begin
+                next_state = IDLE;  // 两周期写
+            end
+
+            default: ;
+        endcase
+    end
+
+    // 数据转移
+    always_ff @ (posedge clk_i) begin
+        if (rst_i) begin
+            wb_ack_o <= 0;
+        end else begin
+            case(state)
+                IDLE: begin
+                    if (wb_cyc_i && wb_stb_i) begin
+                        if (!wb_we_i) begin  // read
+                            wb_dat_o <= rom[wb_adr_i[ROM_ADDR_WIDTH+1:2]];
+                        end
+                        wb_ack_o <= 1;
+                    end
+                end
+
+                READ: begin
+                    wb_ack_o <= 0;
+                end
+
+                WRITE: begin
+                    wb_ack_o <= 0;
+                end
+
+                default: ;
+            endcase
+        end
+    end
+
+endmodule
@@ -2,8 +2,8 @@ module bram_controller #(
     parameter WISHBONE_DATA_WIDTH = 32,
     parameter WISHBONE_ADDR_WIDTH = 32,
 
-    parameter BRAM_DATA_WIDTH = 8,
-    parameter BRAM_ADDR_WIDTH = 19
+    parameter BRAM_DATA_WIDTH = 32,
+    parameter BRAM_ADDR_WIDTH = 15     // 字地址宽度
 )(
     // clock and reset
     input wire clk_i,
@@ -20,7 +20,7 @@ module bram_controller #(
     input wire wb_we_i,
 
     // block ram interface
-    input wire [BRAM_DATA_WIDTH-1:0] bram_data_i,
+    // pic_bram/pic_mem_1 是简单双口 ram，总线一侧只有写口，读显存总是得到 0
     output reg  [BRAM_DATA_WIDTH-1:0] bram_data_o,
     output reg  [BRAM_ADDR_WIDTH-1:0] bram_addr_a_o,
     output reg  [BRAM_ADDR_WIDTH-1:0] bram_addr_b_o,
@@ -63,60 +63,56 @@ module bram_controller #(
             WRITE: begin
                 next_state = IDLE;  // 两周期写
             end
+
+            default: ;
         endcase
     end
 
-    // 单字节读取、写入，不做地址对齐
+    // 按字访问，wb_sel_i 作为字节写使能，一次 sw 可以写入 4 个像素
     wire [BRAM_ADDR_WIDTH-1:0] addr_a;
     wire [BRAM_ADDR_WIDTH-1:0] addr_b;
-    wire [BRAM_DATA_WIDTH-1:0] w_data;
-    assign addr_a = wb_adr_i[BRAM_ADDR_WIDTH-1:0];
-    assign addr_b = wb_adr_i[BRAM_ADDR_WIDTH-1:0];
-    assign w_data = wb_dat_i[7:0];
-
-    // 读取数据
-    logic [BRAM_DATA_WIDTH-1:0] data_reg;
-
-    wire [1:0] addr_sel;
-    assign addr_sel = wb_adr_i[1:0];
-    wire [WISHBONE_DATA_WIDTH-1:0] wb_data_tmp;
-    assign wb_data_tmp = $signed(data_reg)<<8*(addr_sel);
+    assign addr_a = wb_adr_i[BRAM_ADDR_WIDTH+1:2];
+    assign addr_b = wb_adr_i[BRAM_ADDR_WIDTH+1:2];
 
+    // 写数据在低位，按 sel 移到对应的字节上，与 sram_controller 一致
+    logic [BRAM_DATA_WIDTH-1:0] w_data;
 
+    always_comb begin
+        case (wb_sel_i)
+            4'b0010: w_data = {16'b0, wb_dat_i[7:0], 8'b0};
+            4'b0100: w_data = {8'b0, wb_dat_i[7:0], 16'b0};
+            4'b1000: w_data = {wb_dat_i[7:0], 24'b0};
+            4'b1100: w_data = {wb_dat_i[15:0], 16'b0};
+            default: w_data = wb_dat_i;
+        endcase
+    end
 
     // 数据转移
     always_comb begin
         // 默认不写入字节，不读取字节
-        // 将写数据硬连线到 bram 的写口
-        // 将 bram 读数据硬连线到寄存器
+        // 写数据和字节使能在 IDLE 周期直接送到 bram 的写口
         bram_wea_o = 0;
-        data_reg = bram_data_i;
-        bram_addr_a_o = 0;
-        bram_addr_b_o = 0;
+        bram_data_o = w_data;
+        bram_addr_a_o = addr_a;
+        bram_addr_b_o = addr_b;
 
         case(state)
             IDLE: begin
-                if (wb_cyc_i && wb_stb_i) begin
-                    if (wb_we_i) begin  // write
-                        bram_addr_a_o = addr_a;
-                        bram_wea_o = 1;
-                    end else begin      // read
-                        bram_addr_b_o = addr_b;
-                        bram_wea_o = 0;
-                    end
+                if (wb_cyc_i && wb_stb_i && wb_we_i) begin  // write
+                    bram_wea_o = wb_sel_i;
                 end
             end
 
             // 在读写期间时钟保持地址信号不变
             READ: begin
-                bram_addr_a_o = addr_a;
                 bram_wea_o = 0;
             end
 
             WRITE: begin
-                bram_addr_b_o = addr_b;
-                bram_wea_o = 1;
+                bram_wea_o = 0;
             end
+
+            default: ;
         endcase
     end
 
@@ -130,9 +126,8 @@ module bram_controller #(
             IDLE: begin
                 if (wb_cyc_i && wb_stb_i) begin
                     if(!wb_we_i) begin      // read
-                        wb_dat_o <= wb_data_tmp;
-                    end else begin 
-                        bram_data_o <= w_data;
+                        // 没有读口，返回确定的 0
+                        wb_dat_o <= 0;
                     end
                     wb_ack_o <= 1;
                 end
@@ -145,6 +140,8 @@ module bram_controller #(
             WRITE: begin
                 wb_ack_o <= 0;
             end
+
+            default: ;
         endcase
     end
 
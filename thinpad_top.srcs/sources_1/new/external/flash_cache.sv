@@ -0,0 +1,267 @@
+module flash_cache #(
+    parameter WISHBONE_DATA_WIDTH = 32,
+    parameter WISHBONE_ADDR_WIDTH = 32,
+
+    parameter FLASH_ADDR_WIDTH = 23,
+    parameter LINE_WORDS_LOG2 = 2,      // 每行 4 个字
+    parameter SETS_LOG2 = 6             // 64 组，两路共 2KB
+) (
+    // clock and reset
+    input wire clk_i,
+    input wire rst_i,
+
+    // wishbone slave interface（来自总线）
+    input wire wb_cyc_i,
+    input wire wb_stb_i,
+    output reg wb_ack_o,
+    input wire [WISHBONE_ADDR_WIDTH-1:0] wb_adr_i,
+    input wire [WISHBONE_DATA_WIDTH-1:0] wb_dat_i,
+    output reg [WISHBONE_DATA_WIDTH-1:0] wb_dat_o,
+    input wire [WISHBONE_DATA_WIDTH/8-1:0] wb_sel_i,
+    input wire wb_we_i,
+
+    // wishbone master interface（到 flash_controller）
+    output reg wbm_cyc_o,
+    output reg wbm_stb_o,
+    input wire wbm_ack_i,
+    output reg [WISHBONE_ADDR_WIDTH-1:0] wbm_adr_o,
+    output wire [WISHBONE_DATA_WIDTH-1:0] wbm_dat_o,
+    input wire [WISHBONE_DATA_WIDTH-1:0] wbm_dat_i,
+    output wire [WISHBONE_DATA_WIDTH/8-1:0] wbm_sel_o,
+    output wire wbm_we_o
+);
+
+    // 两路组相联只读 cache，按行从 flash 取回
+    // 每次访问后预取下一行，顺序执行代码和连续读取素材时大多能命中
+    // flash 只在复位期间由云平台改写，所以只在复位时清空
+    localparam OFFSET_BITS = LINE_WORDS_LOG2 + 2;
+    localparam TAG_BITS = FLASH_ADDR_WIDTH - OFFSET_BITS - SETS_LOG2;
+    localparam SETS = 2 ** SETS_LOG2;
+    localparam LINE_WORDS = 2 ** LINE_WORDS_LOG2;
+
+    // 只读，写入直接应答并丢弃，与 flash_controller 一致
+    // flash_controller 只使用低 FLASH_ADDR_WIDTH 位地址，高位补 0
+    assign wbm_dat_o = 0;
+    assign wbm_sel_o = 4'b1111;
+    assign wbm_we_o = 0;
+
+    typedef enum logic [2:0] {
+        IDLE = 0,
+        DONE = 1,
+        FILL = 2,
+        PREFETCH = 3,
+        COMMIT = 4
+    } state_t;
+    state_t state;
+
+    // 标签和数据
+    reg [SETS-1:0] valid_0;
+    reg [SETS-1:0] valid_1;
+    reg [SETS-1:0] lru;                 // 最近使用的一路，替换另一路
+    reg [TAG_BITS-1:0] tag_0 [0:SETS-1];
+    reg [TAG_BITS-1:0] tag_1 [0:SETS-1];
+    reg [31:0] data_0 [0:SETS*LINE_WORDS-1];
+    reg [31:0] data_1 [0:SETS*LINE_WORDS-1];
+
+    // 总线请求的查找
+    wire [SETS_LOG2-1:0] req_index;
+    wire [TAG_BITS-1:0] req_tag;
+    wire [LINE_WORDS_LOG2-1:0] req_word;
+    assign req_index = wb_adr_i[OFFSET_BITS +: SETS_LOG2];
+    assign req_tag = wb_adr_i[FLASH_ADDR_WIDTH-1 -: TAG_BITS];
+    assign req_word = wb_adr_i[2 +: LINE_WORDS_LOG2];
+
+    wire hit_0;
+    wire hit_1;
+    assign hit_0 = valid_0[req_index] && tag_0[req_index] == req_tag;
+    assign hit_1 = valid_1[req_index] && tag_1[req_index] == req_tag;
+
+    // 预取行的查找
+    reg pf_pending;
+    reg [FLASH_ADDR_WIDTH-OFFSET_BITS-1:0] pf_line;
+
+    wire [SETS_LOG2-1:0] pf_index;
+    wire [TAG_BITS-1:0] pf_tag;
+    wire pf_present;
+    assign pf_index = pf_line[SETS_LOG2-1:0];
+    assign pf_tag = pf_line[FLASH_ADDR_WIDTH-OFFSET_BITS-1 -: TAG_BITS];
+    assign pf_present = (valid_0[pf_index] && tag_0[pf_index] == pf_tag)
+                     || (valid_1[pf_index] && tag_1[pf_index] == pf_tag);
+
+    wire req;
+    assign req = wb_cyc_i && wb_stb_i;
+
+    // 正在填充的行
+    reg fill_way;
+    reg [SETS_LOG2-1:0] fill_index;
+    reg [TAG_BITS-1:0] fill_tag;
+    reg [LINE_WORDS_LOG2-1:0] fill_cnt;
+    reg [LINE_WORDS_LOG2-1:0] fill_want;
+
+    wire [FLASH_ADDR_WIDTH-1:0] fill_addr;
+    assign fill_addr = {fill_tag, fill_index, fill_cnt, 2'b00};
+
+    // 预取的行先放在这里，取完整行后再写入被替换的一路，
+    // 预取被放弃时被替换的一路仍然有效
+    reg [31:0] pf_buf [0:LINE_WORDS-1];
+
+    wire fill_we;
+    wire [31:0] fill_data;
+    assign fill_we = (state == FILL && wbm_ack_i) || state == COMMIT;
+    assign fill_data = (state == COMMIT) ? pf_buf[fill_cnt] : wbm_dat_i;
+
+    always_ff @ (posedge clk_i) begin
+        if (fill_we) begin
+            if (fill_way) begin
+                data_1[{fill_index, fill_cnt}] <= fill_data;
+            end else begin
+                data_0[{fill_index, fill_cnt}] <= fill_data;
+            end
+        end
+        if (state == PREFETCH && wbm_ack_i) begin
+            pf_buf[fill_cnt] <= wbm_dat_i;
+        end
+    end
+
+    always_ff @ (posedge clk_i) begin
+        if (rst_i) begin
+            state <= IDLE;
+            wb_ack_o <= 0;
+            wbm_cyc_o <= 0;
+            wbm_stb_o <= 0;
+            wbm_adr_o <= 0;
+
+            valid_0 <= 0;
+            valid_1 <= 0;
+            lru <= 0;
+            pf_pending <= 0;
+            pf_line <= 0;
+        end else begin
+            case (state)
+                IDLE: begin
+                    if (req) begin
+                        if (wb_we_i) begin
+                            wb_ack_o <= 1;
+                            state <= DONE;
+                        end else if (hit_0 || hit_1) begin
+                            // 命中，两周期读
+                            wb_dat_o <= hit_1 ? data_1[{req_index, req_word}] : data_0[{req_index, req_word}];
+                            wb_ack_o <= 1;
+                            lru[req_index] <= hit_1;
+                            state <= DONE;
+                        end else begin
+                            // 缺失，替换最近未使用的一路
+                            fill_way <= ~lru[req_index];
+                            fill_index <= req_index;
+                            fill_tag <= req_tag;
+                            fill_cnt <= 0;
+                            fill_want <= req_word;
+                            if (lru[req_index]) begin
+                                valid_0[req_index] <= 0;
+                            end else begin
+                                valid_1[req_index] <= 0;
+                            end
+
+                            wbm_cyc_o <= 1;
+                            wbm_stb_o <= 1;
+                            wbm_adr_o <= WISHBONE_ADDR_WIDTH'({req_tag, req_index, {OFFSET_BITS{1'b0}}});
+                            state <= FILL;
+                        end
+                        pf_pending <= 1;
+                        pf_line <= wb_adr_i[FLASH_ADDR_WIDTH-1:OFFSET_BITS] + 1;
+                    end else if (pf_pending) begin
+                        pf_pending <= 0;
+                        if (!pf_present) begin
+                            fill_way <= ~lru[pf_index];
+                            fill_index <= pf_index;
+                            fill_tag <= pf_tag;
+                            fill_cnt <= 0;
+
+                            wbm_cyc_o <= 1;
+                            wbm_stb_o <= 1;
+                            wbm_adr_o <= WISHBONE_ADDR_WIDTH'({pf_line, {OFFSET_BITS{1'b0}}});
+                            state <= PREFETCH;
+                        end
+                    end
+                end
+
+                DONE: begin
+                    wb_ack_o <= 0;
+                    state <= IDLE;
+                end
+
+                FILL: begin
+                    if (wbm_ack_i) begin
+                        if (fill_cnt == fill_want) begin
+                            wb_dat_o <= wbm_dat_i;
+                        end
+                        if (fill_cnt == LINE_WORDS - 1) begin
+                            wbm_cyc_o <= 0;
+                            wbm_stb_o <= 0;
+                            if (fill_way) begin
+                                valid_1[fill_index] <= 1;
+                                tag_1[fill_index] <= fill_tag;
+                            end else begin
+                                valid_0[fill_index] <= 1;
+                                tag_0[fill_index] <= fill_tag;
+                            end
+                            lru[fill_index] <= fill_way;
+                            wb_ack_o <= 1;
+                            state <= DONE;
+                        end else begin
+                            // 每个字之间释放一次 stb，flash_controller 回到 IDLE 后再发下一个
+                            wbm_stb_o <= 0;
+                            fill_cnt <= fill_cnt + 1;
+                        end
+                    end else if (!wbm_stb_o) begin
+                        wbm_stb_o <= 1;
+                        wbm_adr_o <= WISHBONE_ADDR_WIDTH'(fill_addr);
+                    end
+                end
+
+                PREFETCH: begin
+                    if (wbm_ack_i) begin
+                        if (fill_cnt == LINE_WORDS - 1) begin
+                            wbm_cyc_o <= 0;
+                            wbm_stb_o <= 0;
+                            fill_cnt <= 0;
+                            state <= COMMIT;
+                        end else if (req) begin
+                            // 总线上有新请求，放弃预取，被替换的一路还没有改动
+                            wbm_cyc_o <= 0;
+                            wbm_stb_o <= 0;
+                            state <= IDLE;
+                        end else begin
+                            wbm_stb_o <= 0;
+                            fill_cnt <= fill_cnt + 1;
+                        end
+                    end else if (!wbm_stb_o) begin
+                        wbm_stb_o <= 1;
+                        wbm_adr_o <= WISHBONE_ADDR_WIDTH'(fill_addr);
+                    end
+                end
+
+                COMMIT: begin
+                    // 每周期把一个字写入被替换的一路，最后一个字写入时换上新的标签
+                    if (fill_cnt == LINE_WORDS - 1) begin
+                        if (fill_way) begin
+                            valid_1[fill_index] <= 1;
+                            tag_1[fill_index] <= fill_tag;
+                        end else begin
+                            valid_0[fill_index] <= 1;
+                            tag_0[fill_index] <= fill_tag;
+                        end
+                        state <= IDLE;
+                    end else begin
+                        fill_cnt <= fill_cnt + 1;
+                    end
+                end
+
+                default: begin
+                    state <= IDLE;
+                end
+            endcase
+        end
+    end
+
+endmodule
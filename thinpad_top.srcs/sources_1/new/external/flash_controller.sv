@@ -2,8 +2,14 @@ module flash_controller #(
     parameter WISHBONE_DATA_WIDTH = 32,
     parameter WISHBONE_ADDR_WIDTH = 32,
 
-    parameter FLASH_DATA_WIDTH = 8,
-    parameter FLASH_ADDR_WIDTH = 23
+    parameter FLASH_DATA_WIDTH = 16,
+    parameter FLASH_ADDR_WIDTH = 23,
+
+    // 时序参数，按系统时钟换算成周期数
+    parameter CLK_FREQ = 20_000_000,
+    parameter T_ACC_NS = 110,           // 随机访问时间 tAVQV
+    parameter T_PAGE_NS = 25,           // 页内访问时间 tAPA
+    parameter PAGE_BYTES_LOG2 = 3       // 异步页大小，P30 为 4 个半字
 ) (
     // clock and reset
     input wire clk_i,
@@ -27,11 +33,20 @@ module flash_controller #(
     output reg flash_oe_o
 );
 
+    // 周期数向上取整，至少为 1
+    localparam CLK_PERIOD_NS = 1_000_000_000 / CLK_FREQ;
+    localparam READ_CYCLES = (T_ACC_NS + CLK_PERIOD_NS - 1) / CLK_PERIOD_NS;
+    localparam PAGE_CYCLES_RAW = (T_PAGE_NS + CLK_PERIOD_NS - 1) / CLK_PERIOD_NS;
+    localparam PAGE_CYCLES = PAGE_CYCLES_RAW < 1 ? 1 : PAGE_CYCLES_RAW;
+
+    // 16 bit 模式，一个字分两次读取：先读低半字，再在同一页内读高半字
     // flash 的 write 指令空转，不进行操作，两个周期后返回正常
-    typedef enum logic [1:0] {
+    typedef enum logic [2:0] {
         IDLE = 0,
-        READ = 1,
-        WRITE = 2
+        READ_LO = 1,
+        READ_HI = 2,
+        DONE = 3,
+        WRITE = 4
     } state_t;
     state_t state, next_state;
 
@@ -44,6 +59,8 @@ module flash_controller #(
         end
     end
 
+    reg [7:0] wait_cnt;
+
     always_comb begin
         next_state = IDLE;
         case(state)
@@ -52,73 +69,55 @@ module flash_controller #(
                     if (wb_we_i) begin  // write
                         next_state = WRITE;
                     end else begin  // read
-                        next_state = READ;
+                        next_state = READ_LO;
                     end
                 end
             end
 
-            READ: begin
-                next_state = IDLE;  // 两周期读
+            READ_LO: begin
+                next_state = (wait_cnt == 0) ? READ_HI : READ_LO;
+            end
+
+            READ_HI: begin
+                next_state = (wait_cnt == 0) ? DONE : READ_HI;
+            end
+
+            DONE: begin
+                next_state = IDLE;
             end
 
             WRITE: begin
                 next_state = IDLE;  // 两周期写
             end
+
+            default: ;
         endcase
     end
 
-    // 单字节读取，写入，不做地址对齐
-    wire [FLASH_ADDR_WIDTH-1:0] flash_addr;
-    wire [1:0] addr_sel;
-    assign flash_addr = wb_adr_i[FLASH_ADDR_WIDTH-1:0];
-    assign addr_sel = wb_adr_i[1:0];
+    // 按字读取，地址按 4 字节对齐
+    // 主设备的总线周期（wb_cyc_i）没有结束时保持片选和读使能，下一次读同一页时只需页内访问时间；
+    // 回到 IDLE 且 wb_cyc_i 撤销后立即释放片选，空闲时不再选中 flash
+    reg [FLASH_ADDR_WIDTH-3:0] word_addr;
+    reg page_open;
+    reg [15:0] data_lo;
 
+    wire page_hit;
+    assign page_hit = page_open && word_addr[FLASH_ADDR_WIDTH-3:PAGE_BYTES_LOG2-2]
+                                == wb_adr_i[FLASH_ADDR_WIDTH-1:PAGE_BYTES_LOG2];
 
-    wire [WISHBONE_DATA_WIDTH-1:0] wb_data_tmp;
     wire [15:0] flash_data_i_comb;
-    wire [7:0] flash_data_i_low;
-    reg [15:0] flash_data_o_comb;
-    reg flash_data_t_comb;
-
-    assign flash_d = flash_data_t_comb ? 8'bz : flash_data_o_comb;
+    assign flash_d = 16'bz;
     assign flash_data_i_comb = flash_d;
-    assign flash_data_i_low = flash_data_i_comb[7:0];
-    assign flash_data_t_comb = 1;
-    assign wb_data_tmp = $signed(flash_data_i_low)<<8*(addr_sel);
 
 
     // 数据转移
     always_comb begin
         // 规定不写入字节
-        // 默认不读取字节
         flash_rp_o = 1;  // 暂时不管 flash 的 reset 按钮
-        flash_oe_o = 1;
-        flash_ce_o = 1;
-        flash_a_o  = 0;
-
-        case(state) 
-            IDLE: begin
-                if (wb_cyc_i && wb_stb_i) begin
-                    if(wb_we_i) begin       // write
-                        // pass
-                    end else begin          // read
-                        flash_oe_o = 0;
-                        flash_ce_o = 0;
-                        flash_a_o = flash_addr;
-                    end
-                end
-            end
-
-            READ: begin
-                flash_oe_o = 0;
-                flash_ce_o = 0;
-                flash_a_o = flash_addr;
-            end
-
-            WRITE: begin
-                // pass
-            end
-        endcase
+        flash_oe_o = !((page_open && wb_cyc_i) || state == READ_LO || state == READ_HI);
+        flash_ce_o = !((page_open && wb_cyc_i) || state == READ_LO || state == READ_HI);
+        // a0 在 16 bit 模式下无意义
+        flash_a_o = {word_addr, state != READ_LO, 1'b0};
     end
 
 
@@ -126,29 +125,55 @@ module flash_controller #(
     always_ff @ (posedge clk_i) begin
         if (rst_i) begin
             wb_ack_o <= 0;
-            // pass for flash reset
-        end
+            word_addr <= 0;
+            page_open <= 0;
+            wait_cnt <= 0;
+        end else begin
+            case(state)
+                IDLE: begin
+                    if (!wb_cyc_i) begin
+                        page_open <= 0;
+                    end
+                    if (wb_cyc_i && wb_stb_i) begin
+                        if (wb_we_i) begin       // write
+                            wb_ack_o <= 1;
+                            page_open <= 0;
+                        end else begin          // read
+                            word_addr <= wb_adr_i[FLASH_ADDR_WIDTH-1:2];
+                            wait_cnt <= 8'((page_hit ? PAGE_CYCLES : READ_CYCLES) - 1);
+                        end
+                    end
+                end
 
-        case(state)
-            IDLE: begin
-                if (wb_cyc_i && wb_stb_i) begin
-                    if (wb_we_i) begin       // write
-                        // pass
-                    end else begin          // read
-                        wb_dat_o <= wb_data_tmp;
+                READ_LO: begin
+                    if (wait_cnt == 0) begin
+                        data_lo <= flash_data_i_comb;
+                        wait_cnt <= 8'(PAGE_CYCLES - 1);
+                    end else begin
+                        wait_cnt <= wait_cnt - 1;
                     end
-                    wb_ack_o <= 1;
                 end
-            end
 
-            READ: begin
-                wb_ack_o <= 0;
-            end
+                READ_HI: begin
+                    if (wait_cnt == 0) begin
+                        wb_dat_o <= {flash_data_i_comb, data_lo};
+                        wb_ack_o <= 1;
+                        page_open <= 1;
+                    end else begin
+                        wait_cnt <= wait_cnt - 1;
+                    end
+                end
 
-            WRITE: begin
-                wb_ack_o <= 0;
-            end
-        endcase
+                DONE: begin
+                    wb_ack_o <= 0;
+                end
+
+                WRITE: begin
+                    wb_ack_o <= 0;
+                end
 
+                default: ;
+            endcase
+        end
     end
-endmodule
\ No newline at end of file
+endmodule
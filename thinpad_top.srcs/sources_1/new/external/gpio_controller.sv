@@ -1,6 +1,9 @@
 module gpio_controller #(
     parameter WISHBONE_DATA_WIDTH = 32,
-    parameter WISHBONE_ADDR_WIDTH = 32
+    parameter WISHBONE_ADDR_WIDTH = 32,
+
+    parameter DEBOUNCE_CYCLES = 200_000,    // 复位后的消抖采样间隔，20M 时钟下为 10ms
+    parameter EVT_DEPTH_LOG2 = 4            // 事件 FIFO 深度 16
 ) (
     // clock and reset
     input wire clk_i,
@@ -19,9 +22,37 @@ module gpio_controller #(
     // gpio interface
     input wire [31:0] dip_sw,
     input wire [3:0] touch_btn,
-    input wire push_btn
+    input wire push_btn,
+
+    // 事件时间戳，来自 csr_mtime 的 mtime 低 32 位
+    input wire [31:0] mtime_i,
+
+    // 事件 FIFO 非空时拉高，接到 PLIC
+    output wire irq_o
 );
 
+    // 地址划分
+    // 0x8500_0000 SW          拨码开关的实时电平
+    // 0x8500_0004 BTN         按键的实时电平，bit0 push_btn，[4:1] touch_btn
+    // 0x8500_0008 DEBOUNCE    消抖采样间隔（时钟周期数），连续两次采样相同才认为电平稳定
+    // 0x8500_000C SW_EDGE     拨码开关消抖后的边沿（上升或下降），写 1 清除
+    // 0x8500_0010 BTN_EDGE    按键消抖后的边沿，[4:0] 上升沿，[12:8] 下降沿，写 1 清除
+    // 0x8500_0014 EVT_EN      哪些边沿写入事件 FIFO，[4:0] 按键上升沿，[12:8] 按键下降沿，bit16 拨码开关
+    // 0x8500_0018 EVT_STATUS  bit0 FIFO 非空，[12:8] 事件个数，bit16 溢出（写 1 清除）
+    // 0x8500_001C EVT_TIME    队首事件的时间戳，不出队
+    // 0x8500_0020 EVT_DATA    队首事件，读取后出队
+    //   [5:0] 输入编号（0 ~ 31 拨码开关，32 push_btn，33 ~ 36 touch_btn），bit8 为 1 表示上升沿，bit31 有效位
+    // 应先读 EVT_TIME 再读 EVT_DATA
+    localparam REG_SW         = 8'h00;
+    localparam REG_BTN        = 8'h04;
+    localparam REG_DEBOUNCE   = 8'h08;
+    localparam REG_SW_EDGE    = 8'h0C;
+    localparam REG_BTN_EDGE   = 8'h10;
+    localparam REG_EVT_EN     = 8'h14;
+    localparam REG_EVT_STATUS = 8'h18;
+    localparam REG_EVT_TIME   = 8'h1C;
+    localparam REG_EVT_DATA   = 8'h20;
+
     // 定义状态机
     typedef enum logic [1:0] {
         IDLE = 0,
@@ -59,6 +90,8 @@ module gpio_controller #(
             WRITE: begin
                 next_state = IDLE;  // 两周期写
             end
+
+            default: ;
         endcase
     end
 
@@ -68,21 +101,182 @@ module gpio_controller #(
     wire [WISHBONE_DATA_WIDTH-1:0] btn_data;
     assign btn_data = {27'b0, touch_btn, push_btn};
 
+    /* =========== 消抖与边沿检测 =========== */
+
+    // 37 个输入：[31:0] 拨码开关，[36:32] 按键
+    wire [36:0] raw_in;
+    assign raw_in = {touch_btn, push_btn, dip_sw};
+
+    reg [36:0] in_sync_0;
+    reg [36:0] in_sync_1;
+    reg [36:0] sample;
+    reg [36:0] stable;
+
+    reg [31:0] debounce_reg;
+    reg [31:0] debounce_cnt;
+    reg [1:0] warmup;
+    wire sample_tick;
+    assign sample_tick = debounce_cnt == 0;
+
+    // 所有输入共用一个采样节拍，相邻两次采样相同时更新稳定电平
+    always_ff @ (posedge clk_i) begin
+        if (rst_i) begin
+            in_sync_0 <= 0;
+            in_sync_1 <= 0;
+            sample <= 0;
+            stable <= 0;
+            debounce_cnt <= 0;
+            warmup <= 0;
+        end else begin
+            in_sync_0 <= raw_in;
+            in_sync_1 <= in_sync_0;
+            if (sample_tick) begin
+                debounce_cnt <= debounce_reg;
+                sample <= in_sync_1;
+                stable <= (in_sync_1 & sample) | (stable & (in_sync_1 | sample));
+                if (warmup != 2'd3) warmup <= warmup + 1;
+            end else begin
+                debounce_cnt <= debounce_cnt - 1;
+            end
+        end
+    end
+
+    // 复位后的前几次采样只用来得到初始电平，不产生边沿
+    reg [36:0] stable_d;
+    wire [36:0] rise;
+    wire [36:0] fall;
+    assign rise = warmup == 2'd3 ? stable & ~stable_d : 37'b0;
+    assign fall = warmup == 2'd3 ? ~stable & stable_d : 37'b0;
+
+    /* =========== 事件 FIFO =========== */
+
+    reg [31:0] sw_edge_reg;
+    reg [4:0] btn_rise_reg;
+    reg [4:0] btn_fall_reg;
+    reg [31:0] evt_en_reg;
+    reg evt_overflow;
+
+    // 同一周期可能有多个边沿，先记在 evt_queued 中，每周期写入编号最小的一个
+    reg [36:0] evt_queued;
+    reg [36:0] evt_rising;
+
+    wire [36:0] evt_mask;
+    assign evt_mask = {{5{1'b0}}, {32{evt_en_reg[16]}}};
+
+    wire [36:0] evt_new_rise;
+    wire [36:0] evt_new_fall;
+    assign evt_new_rise = rise & ({evt_en_reg[4:0], 32'b0} | evt_mask);
+    assign evt_new_fall = fall & ({evt_en_reg[12:8], 32'b0} | evt_mask);
+
+    logic [5:0] evt_index;
+    logic evt_found;
+    always_comb begin
+        evt_index = 0;
+        evt_found = 0;
+        for (int i = 36; i >= 0; i--) begin
+            if (evt_queued[i]) begin
+                evt_index = 6'(i);
+                evt_found = 1;
+            end
+        end
+    end
+
+    wire evt_push;
+    wire evt_pop;
+    wire evt_full;
+    wire evt_empty;
+    wire [EVT_DEPTH_LOG2:0] evt_count;
+    wire [38:0] evt_head;
+
+    assign evt_push = evt_found;
+    assign evt_pop = state == IDLE && wb_cyc_i && wb_stb_i && !wb_we_i
+                     && wb_adr_i[7:0] == REG_EVT_DATA;
+
+    sync_fifo #(
+        .DATA_WIDTH(39),
+        .DEPTH_LOG2(EVT_DEPTH_LOG2)
+    ) u_evt_fifo (
+        .clk_i(clk_i),
+        .rst_i(rst_i),
+        .clr_i(1'b0),
+        .wr_en_i(evt_push),
+        .wr_data_i({mtime_i, evt_rising[evt_index], evt_index}),
+        .rd_en_i(evt_pop),
+        .rd_data_o(evt_head),
+        .full_o(evt_full),
+        .empty_o(evt_empty),
+        .count_o(evt_count)
+    );
+
+    assign irq_o = !evt_empty;
+
     logic [WISHBONE_DATA_WIDTH-1:0] wb_data_tmp;
 
     // 数据转移
     always_comb begin
-        
-        wb_data_tmp = gpio_data;
-
-        // 根据不同的数据输出不同的数据
-        if (wb_adr_i[3:0] == 4'h0) begin
-            wb_data_tmp = gpio_data;
-        end else if (wb_adr_i[3:0] == 4'h4) begin
-            wb_data_tmp = btn_data;
-        end else begin
+        case (wb_adr_i[7:0])
+            REG_SW:         wb_data_tmp = gpio_data;
+            REG_BTN:        wb_data_tmp = btn_data;
+            REG_DEBOUNCE:   wb_data_tmp = debounce_reg;
+            REG_SW_EDGE:    wb_data_tmp = sw_edge_reg;
+            REG_BTN_EDGE:   wb_data_tmp = {19'b0, btn_fall_reg, 3'b0, btn_rise_reg};
+            REG_EVT_EN:     wb_data_tmp = evt_en_reg;
+            REG_EVT_STATUS: wb_data_tmp = {15'b0, evt_overflow, 3'b0, 5'(evt_count), 7'b0, !evt_empty};
+            REG_EVT_TIME:   wb_data_tmp = evt_head[38:7];
+            REG_EVT_DATA:   wb_data_tmp = evt_empty ? 32'h0 : {1'b1, 22'b0, evt_head[6], 2'b0, evt_head[5:0]};
             // if address is not valid, return 15
-            wb_data_tmp = 32'h0000_1111;
+            default:        wb_data_tmp = 32'h0000_1111;
+        endcase
+    end
+
+    wire reg_we;
+    assign reg_we = state == IDLE && wb_cyc_i && wb_stb_i && wb_we_i;
+
+    always_ff @ (posedge clk_i) begin
+        if (rst_i) begin
+            stable_d <= 0;
+            sw_edge_reg <= 0;
+            btn_rise_reg <= 0;
+            btn_fall_reg <= 0;
+            evt_en_reg <= 32'h0000_1F1F;
+            debounce_reg <= DEBOUNCE_CYCLES;
+            evt_overflow <= 0;
+            evt_queued <= 0;
+            evt_rising <= 0;
+        end else begin
+            stable_d <= stable;
+
+            // 新的边沿与写 1 清除同时发生时保留边沿
+            sw_edge_reg <= (sw_edge_reg & ~(reg_we && wb_adr_i[7:0] == REG_SW_EDGE ? wb_dat_i : 32'b0))
+                           | rise[31:0] | fall[31:0];
+            btn_rise_reg <= (btn_rise_reg & ~(reg_we && wb_adr_i[7:0] == REG_BTN_EDGE ? wb_dat_i[4:0] : 5'b0))
+                            | rise[36:32];
+            btn_fall_reg <= (btn_fall_reg & ~(reg_we && wb_adr_i[7:0] == REG_BTN_EDGE ? wb_dat_i[12:8] : 5'b0))
+                            | fall[36:32];
+
+            // 写入后清除队列中的这一位，再并入新的边沿
+            for (int i = 0; i < 37; i++) begin
+                if (evt_new_rise[i] || evt_new_fall[i]) begin
+                    evt_queued[i] <= 1;
+                    evt_rising[i] <= evt_new_rise[i];
+                end else if (evt_found && evt_index == 6'(i)) begin
+                    evt_queued[i] <= 0;
+                end
+            end
+
+            if (evt_push && evt_full) begin
+                evt_overflow <= 1;
+            end else if (reg_we && wb_adr_i[7:0] == REG_EVT_STATUS && wb_dat_i[16]) begin
+                evt_overflow <= 0;
+            end
+
+            if (reg_we) begin
+                case (wb_adr_i[7:0])
+                    REG_DEBOUNCE: debounce_reg <= wb_dat_i;
+                    REG_EVT_EN:   evt_en_reg <= wb_dat_i;
+                    default: ;
+                endcase
+            end
         end
     end
 
@@ -94,10 +288,10 @@ module gpio_controller #(
         case (state)
             IDLE: begin
                 if (wb_cyc_i && wb_stb_i) begin
-                    if(!wb_we_i) begin          // only for read
+                    if(!wb_we_i) begin          // read
                         wb_dat_o <= wb_data_tmp;
                         wb_ack_o <= 1;
-                    end else begin              // not prehibit write but not support
+                    end else begin              // write
                         wb_ack_o <= 1;
                     end
                 end
@@ -110,7 +304,9 @@ module gpio_controller #(
             WRITE: begin
                 wb_ack_o <= 0;
             end
+
+            default: ;
         endcase
     end
 
-endmodule
\ No newline at end of file
+endmodule
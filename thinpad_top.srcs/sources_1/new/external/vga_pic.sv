@@ -28,7 +28,11 @@ module vga_pic #(
     // bram 输出数据
     input wire [7:0] r_data,
     // 画面渲染结束脉冲
-    output reg vga_end
+    output reg vga_end,
+
+    // 精灵平面像素，与 r_data 同拍，覆盖在 bram 画面之上
+    input wire [7:0] sprite_pixel,
+    input wire sprite_hit
 );
     parameter RED = 8'hA0;
     parameter GREEN = 8'h08;
@@ -61,18 +65,19 @@ module vga_pic #(
     // ---------------------------------
 
     always_comb begin
-        width_x = hdata >> vga_scale;
-        height_y = vdata >> vga_scale;
+        width_x = 10'(hdata >> vga_scale);
+        height_y = 10'(vdata >> vga_scale);
 
-        r_addr = r_addr_st + (height_y * picwidth) + width_x;
+        r_addr = r_addr_st + (BRAMADDR_WIDTH'(height_y) * BRAMADDR_WIDTH'(picwidth)) + BRAMADDR_WIDTH'(width_x);
     end
 
     always_ff @ (posedge vga_clk) begin
         if (hdata < HSIZE && vdata < VSIZE) begin
-            pixel <= r_data;
+            pixel <= sprite_hit ? sprite_pixel : r_data;
             vga_end <= 0;
         end else begin
-            if (vdata == VMAX - 1 && hdata > HMAX - 15) begin
+            // 在场消隐开始时给出脉冲，留出整个消隐期完成显存交换
+            if (vdata == VSIZE && hdata < 16) begin
                 vga_end <= 1;
             end else begin
                 vga_end <= 0;
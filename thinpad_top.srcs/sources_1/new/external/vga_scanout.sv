@@ -0,0 +1,143 @@
+module vga_scanout #(
+    parameter WIDTH = 12,
+    parameter HSIZE = 800,
+    parameter VSIZE = 600,
+    parameter VMAX = 666,
+
+    parameter SRAM_ADDR_WIDTH = 20,
+    parameter BURST_LEN = 16            // 与 sram_controller 的 BURST_LEN 保持一致
+) (
+    // 系统时钟域
+    input wire clk_i,
+    input wire rst_i,
+
+    // 帧缓冲配置，来自 vga_selector，只在场消隐时变化
+    input wire fb_enable,
+    input wire [SRAM_ADDR_WIDTH-1:0] fb_base,   // ExtRAM 内的字地址
+
+    // ExtRAM 突发读口
+    output wire burst_req_o,
+    output reg [SRAM_ADDR_WIDTH-1:0] burst_addr_o,
+    input wire burst_valid_i,
+    input wire [31:0] burst_data_i,
+    input wire burst_done_i,
+
+    // vga 时钟域
+    input wire vga_clk,
+    input wire [WIDTH-1:0] hdata,
+    input wire [WIDTH-1:0] vdata,
+    // 与 bram 读出数据同拍的像素
+    output wire [7:0] scan_pixel
+);
+
+    // 每行 800 字节，即 200 个字
+    localparam LINE_WORDS = HSIZE / 4;
+
+    // 双行缓冲：显示第 L 行的同时，把第 L + 1 行取到另一半缓冲中
+    // 行消隐只有 240 个像素周期，不足以搬完一整行，所以预取与上一行的显示重叠进行
+    reg [31:0] line_buf [0:511];
+
+    /* =========== 预取请求（vga 时钟域） =========== */
+
+    reg req_toggle = 0;
+    reg [9:0] req_line = 0;
+
+    wire [WIDTH-1:0] next_line;
+    assign next_line = (vdata == VMAX - 1) ? 0 : vdata + 1;
+
+    always_ff @ (posedge vga_clk) begin
+        if (hdata == 0 && next_line < VSIZE) begin
+            req_line <= next_line[9:0];
+            req_toggle <= ~req_toggle;
+        end
+    end
+
+    /* =========== 行读取（系统时钟域） =========== */
+
+    // 请求翻转信号打三拍，req_line 在翻转后一整行内保持不变
+    reg [2:0] req_sync;
+    wire new_req;
+    assign new_req = req_sync[2] ^ req_sync[1];
+
+    reg fetching;
+    reg fetch_buf;
+    reg [7:0] fetch_idx;
+    reg [7:0] remaining;
+
+    // 突发开始后地址必须保持到 burst_done_i，突发进行中到来的新行先记在这里
+    reg start_pending;
+    reg [9:0] pending_line;
+
+    wire want_start;
+    wire [9:0] start_line;
+    wire can_start;
+    assign want_start = fb_enable && (new_req || start_pending);
+    assign start_line = new_req ? req_line : pending_line;
+    assign can_start = !fetching || burst_done_i;
+
+    // 每次突发结束的那一拍撤销请求，避免控制器重复发起突发
+    assign burst_req_o = fetching && !burst_done_i;
+
+    always_ff @ (posedge clk_i) begin
+        if (rst_i) begin
+            req_sync <= 0;
+            fetching <= 0;
+            fetch_buf <= 0;
+            fetch_idx <= 0;
+            remaining <= 0;
+            burst_addr_o <= 0;
+            start_pending <= 0;
+            pending_line <= 0;
+        end else begin
+            req_sync <= {req_sync[1:0], req_toggle};
+
+            if (want_start && can_start) begin
+                // 新的一行，当前的突发结束后放弃旧行剩下的部分
+                start_pending <= 0;
+                fetching <= 1;
+                fetch_buf <= start_line[0];
+                fetch_idx <= 0;
+                remaining <= 8'(LINE_WORDS);
+                burst_addr_o <= fb_base + SRAM_ADDR_WIDTH'(start_line) * LINE_WORDS;
+            end else begin
+                if (want_start) begin
+                    start_pending <= 1;
+                    pending_line <= start_line;
+                end
+                if (fetching) begin
+                    if (burst_valid_i) begin
+                        fetch_idx <= fetch_idx + 1;
+                    end
+                    if (burst_done_i) begin
+                        if (remaining <= BURST_LEN) begin
+                            fetching <= 0;
+                        end else begin
+                            remaining <= remaining - BURST_LEN;
+                            burst_addr_o <= burst_addr_o + BURST_LEN;
+                        end
+                    end
+                end
+            end
+        end
+    end
+
+    // 最后一次突发多读出的字丢弃
+    always_ff @ (posedge clk_i) begin
+        if (fetching && burst_valid_i && fetch_idx < 8'(LINE_WORDS)) begin
+            line_buf[{fetch_buf, fetch_idx}] <= burst_data_i;
+        end
+    end
+
+    /* =========== 像素输出（vga 时钟域） =========== */
+
+    reg [31:0] line_data;
+    reg [1:0] lane;
+
+    always_ff @ (posedge vga_clk) begin
+        line_data <= line_buf[{vdata[0], hdata[9:2]}];
+        lane <= hdata[1:0];
+    end
+
+    assign scan_pixel = line_data[{lane, 3'b000} +: 8];
+
+endmodule
@@ -20,18 +20,28 @@ module vga_selector #(
     output reg [2:0] vga_scale,
     input wire vga_end,
 
+    // 场消隐中断
+    output wire irq_o,
+
     // bram read interface
     input wire [7:0] bram_0_data,
     input wire [7:0] bram_1_data,    
-    output reg [7:0] real_bram_data
+    input wire [7:0] scan_pixel,
+    output reg [7:0] real_bram_data,
+
+    // ExtRAM 帧缓冲配置，供 vga_scanout 使用
+    output wire fb_enable,
+    output wire [19:0] fb_base,
+
+    // 后台缓冲区（不在显示的 bram），供 blitter 使用
+    output wire back_sele
 );
 
     // 状态转移
     typedef enum logic [1:0] {
         IDLE = 0,
         READ = 1,
-        WRITE = 2,
-        WRITE_2 = 3
+        WRITE = 2
     } state_t;
     state_t state, next_state;
 
@@ -61,16 +71,10 @@ module vga_selector #(
             end
 
             WRITE: begin
-                if(vga_end) begin
-                    next_state = WRITE_2;
-                end else begin
-                    next_state = WRITE;
-                end
+                next_state = IDLE;  // 两周期写，交换请求挂起到场消隐时生效
             end
 
-            WRITE_2: begin
-                next_state = IDLE;  // 多周期写（等待 vga end 信号）
-            end
+            default: ;
         endcase
     end
 
@@ -79,12 +83,46 @@ module vga_selector #(
     reg [31:0] vga_scale_reg = 32'h0000_0003;
     // 0x8600_0004 - 0x8600_0008 bram address register (0 or 1)
     reg [31:0] bram_sele_reg = 32'h0000_0000;
+    // 0x8600_0008 - 0x8600_000C status register
+    //   bit0 FLIP_PENDING 交换请求尚未生效（只读）
+    //   bit1 VBLANK       发生过场消隐，写 1 清除
+    // 0x8600_000C - 0x8600_0010 interrupt enable register
+    //   bit0 VBLANK       场消隐中断使能
+    // 0x8600_0010 - 0x8600_0014 framebuffer control register
+    //   bit0 ENABLE       从 ExtRAM 帧缓冲扫描输出（需 vga_scale 为 0）
+    // 0x8600_0014 - 0x8600_0018 framebuffer base register（ExtRAM 总线地址，4 字节对齐）
+    reg flip_pending;
+    reg vblank_flag;
+    reg vblank_irq_en;
+    reg [31:0] fb_ctrl_reg;
+    reg [31:0] fb_base_reg;
 
     logic sele_sync = 0;
     logic [2:0] vga_scale_sync = 3'b001;
+    logic fb_enable_sync = 0;
+    logic [19:0] fb_base_sync = 0;
+
+    // vga_end 来自 vga 时钟域，同步后取上升沿
+    logic vga_end_sync_0;
+    logic vga_end_sync_1;
+    logic vga_end_sync_2;
+    wire vblank;
+    assign vblank = vga_end_sync_1 && !vga_end_sync_2;
+
+    always_ff @ (posedge clk_i) begin
+        vga_end_sync_0 <= vga_end;
+        vga_end_sync_1 <= vga_end_sync_0;
+        vga_end_sync_2 <= vga_end_sync_1;
+    end
+
+    assign irq_o = vblank_flag & vblank_irq_en;
 
     assign vga_scale = vga_scale_sync;
-    assign real_bram_data = sele_sync ? bram_1_data : bram_0_data;
+    assign real_bram_data = fb_enable_sync ? scan_pixel :
+                            sele_sync ? bram_1_data : bram_0_data;
+    assign back_sele = ~bram_sele_reg[0];
+    assign fb_enable = fb_enable_sync;
+    assign fb_base = fb_base_sync;
 
     logic [WISHBONE_DATA_WIDTH-1:0] wb_dat_o_tmp;
 
@@ -117,6 +155,14 @@ module vga_selector #(
             wb_dat_o_tmp = vga_scale_reg;
         end else if(wb_adr_i[7:0] == 8'h04) begin
             wb_dat_o_tmp = bram_sele_reg;
+        end else if(wb_adr_i[7:0] == 8'h08) begin
+            wb_dat_o_tmp = {30'b0, vblank_flag, flip_pending};
+        end else if(wb_adr_i[7:0] == 8'h0C) begin
+            wb_dat_o_tmp = {31'b0, vblank_irq_en};
+        end else if(wb_adr_i[7:0] == 8'h10) begin
+            wb_dat_o_tmp = fb_ctrl_reg;
+        end else if(wb_adr_i[7:0] == 8'h14) begin
+            wb_dat_o_tmp = fb_base_reg;
         end else begin
             // if address is not valid, return 15 
             wb_dat_o_tmp = 32'h0000_1111;
@@ -132,45 +178,71 @@ module vga_selector #(
 
             sele_sync <= 1;
             vga_scale_sync <= 3'b001;
-        end
 
-        case(state)
-            IDLE: begin
-                if (wb_cyc_i && wb_stb_i) begin
-                    if (!wb_we_i) begin  // read
-                        wb_dat_o <= wb_dat_o_tmp;
-                        wb_ack_o <= 1;
-                    end else begin       // write
-                        if (wb_adr_i[7:0] == 8'h00) begin
-                            vga_scale_reg <= wb_dat_i;
-                        end else if(wb_adr_i[7:0] == 8'h04) begin
-                            bram_sele_reg <= wb_dat_i;
-                        end
-                        wb_ack_o <= 0;
-                    end
+            flip_pending <= 0;
+            vblank_flag <= 0;
+            vblank_irq_en <= 0;
+
+            fb_ctrl_reg <= 32'h0;
+            fb_base_reg <= 32'h0;
+            fb_enable_sync <= 0;
+            fb_base_sync <= 0;
+        end else begin
+            // 场消隐时让挂起的交换生效
+            if (vblank) begin
+                vblank_flag <= 1;
+                if (flip_pending) begin
+                    // 时序逻辑修改
+                    sele_sync <= bram_sele_reg[0];
+                    vga_scale_sync <= vga_scale_reg[2:0];
+                    fb_enable_sync <= fb_ctrl_reg[0];
+                    fb_base_sync <= fb_base_reg[21:2];
+                    flip_pending <= 0;
                 end
             end
 
-            READ: begin
-                wb_ack_o <= 0;
-            end
+            case(state)
+                IDLE: begin
+                    if (wb_cyc_i && wb_stb_i) begin
+                        if (!wb_we_i) begin  // read
+                            wb_dat_o <= wb_dat_o_tmp;
+                        end else begin       // write
+                            // 写入立即返回，不再等待 vga_end
+                            if (wb_adr_i[7:0] == 8'h00) begin
+                                vga_scale_reg <= wb_dat_i;
+                                flip_pending <= 1;
+                            end else if(wb_adr_i[7:0] == 8'h04) begin
+                                bram_sele_reg <= wb_dat_i;
+                                flip_pending <= 1;
+                            end else if(wb_adr_i[7:0] == 8'h08) begin
+                                if (wb_dat_i[1] && !vblank) begin
+                                    vblank_flag <= 0;
+                                end
+                            end else if(wb_adr_i[7:0] == 8'h0C) begin
+                                vblank_irq_en <= wb_dat_i[0];
+                            end else if(wb_adr_i[7:0] == 8'h10) begin
+                                fb_ctrl_reg <= wb_dat_i;
+                                flip_pending <= 1;
+                            end else if(wb_adr_i[7:0] == 8'h14) begin
+                                fb_base_reg <= wb_dat_i;
+                                flip_pending <= 1;
+                            end
+                        end
+                        wb_ack_o <= 1;
+                    end
+                end
 
-            WRITE: begin
-                if(vga_end) begin
-                    wb_ack_o <= 1;
+                READ: begin
+                    wb_ack_o <= 0;
+                end
 
-                    // 时序逻辑修改
-                    sele_sync <= bram_sele_reg[0];
-                    vga_scale_sync <= vga_scale_reg[2:0];
-                end else begin 
+                WRITE: begin
                     wb_ack_o <= 0;
                 end
-            end
 
-            WRITE_2: begin
-                wb_ack_o <= 0;
-            end
-        endcase
+                default: ;
+            endcase
+        end
     end
 
 endmodule
\ No newline at end of file
@@ -0,0 +1,337 @@
+module vga_sprite #(
+    parameter WISHBONE_DATA_WIDTH = 32,
+    parameter WISHBONE_ADDR_WIDTH = 32,
+
+    parameter WIDTH = 12,
+    parameter HSIZE = 800,
+    parameter VSIZE = 600,
+
+    parameter SPRITE_NUM = 4,           // 精灵平面个数，最多 8 个
+    parameter SPRITE_RAM_ADDR_WIDTH = 13  // 每个平面的位图空间（字节地址宽度）
+) (
+    // clock and reset
+    input wire clk_i,
+    input wire rst_i,
+
+    // wishbone slave interface
+    input wire wb_cyc_i,
+    input wire wb_stb_i,
+    output reg wb_ack_o,
+    input wire [WISHBONE_ADDR_WIDTH-1:0] wb_adr_i,
+    input wire [WISHBONE_DATA_WIDTH-1:0] wb_dat_i,
+    output reg [WISHBONE_DATA_WIDTH-1:0] wb_dat_o,
+    input wire [WISHBONE_DATA_WIDTH/8-1:0] wb_sel_i,
+    input wire wb_we_i,
+
+    // vga 扫描接口（vga 时钟域）
+    input wire vga_clk,
+    input wire [WIDTH-1:0] hdata,
+    input wire [WIDTH-1:0] vdata,
+    input wire [2:0] vga_scale,
+    input wire vga_end,
+
+    // 与 bram 读出数据同拍的精灵像素
+    output reg [7:0] sprite_pixel,
+    output reg sprite_hit
+);
+
+    // 地址划分
+    // 0x8800_0000 + p * 0x20 平面 p 的寄存器
+    //   0x00 CTRL   bit0 使能
+    //   0x04 POS    [15:0] x，[31:16] y，有符号数，可以移出屏幕
+    //   0x08 SIZE   [15:0] 宽，[31:16] 高
+    //   0x0C SRC    位图在平面位图空间中的起始偏移，行跨度等于宽度
+    //   0x10 KEY    [7:0] 透明关键色
+    // 0x8800_0100 碰撞标志，bit p 表示上一帧平面 p 与其他平面的不透明像素重叠
+    // 0x8801_0000 + p * 2^SPRITE_RAM_ADDR_WIDTH 平面 p 的位图空间
+    // 坐标均为缩放后的画布坐标，与 vga_scale 保持一致
+    localparam REG_CTRL = 3'h0;
+    localparam REG_POS  = 3'h1;
+    localparam REG_SIZE = 3'h2;
+    localparam REG_SRC  = 3'h3;
+    localparam REG_KEY  = 3'h4;
+
+    localparam RAM_WORDS = 2 ** (SPRITE_RAM_ADDR_WIDTH - 2);
+    localparam PLANE_BITS = SPRITE_NUM > 1 ? $clog2(SPRITE_NUM) : 1;
+
+    // 状态转移
+    typedef enum logic [1:0] {
+        IDLE = 0,
+        READ = 1,
+        WRITE = 2
+    } state_t;
+    state_t state, next_state;
+
+    always @(posedge clk_i) begin
+        if (rst_i) begin
+            state <= IDLE;
+        end else begin
+            state <= next_state;
+        end
+    end
+
+    always_comb begin
+        next_state = IDLE;
+        case(state)
+            IDLE: begin
+                if (wb_cyc_i && wb_stb_i) begin
+                    if (wb_we_i) begin  // write
+                        next_state = WRITE;
+                    end else begin  // read
+                        next_state = READ;
+                    end
+                end
+            end
+
+            READ: begin
+                next_state = IDLE;  // 两周期读
+            end
+
+            WRITE: begin
+                next_state = IDLE;  // 两周期写
+            end
+
+            default: ;
+        endcase
+    end
+
+    /* =========== 寄存器（系统时钟域） =========== */
+
+    reg        enable_reg [0:SPRITE_NUM-1];
+    reg [31:0] pos_reg    [0:SPRITE_NUM-1];
+    reg [31:0] size_reg   [0:SPRITE_NUM-1];
+    reg [31:0] src_reg    [0:SPRITE_NUM-1];
+    reg [7:0]  key_reg    [0:SPRITE_NUM-1];
+
+    // 碰撞标志从 vga 时钟域同步过来，一整帧内保持不变
+    reg [SPRITE_NUM-1:0] collision_frame;
+    reg [SPRITE_NUM-1:0] collision_sync_0;
+    reg [SPRITE_NUM-1:0] collision_sync_1;
+
+    always_ff @ (posedge clk_i) begin
+        collision_sync_0 <= collision_frame;
+        collision_sync_1 <= collision_sync_0;
+    end
+
+    wire is_ram;
+    wire is_collision;
+    wire [2:0] reg_plane;
+    wire [2:0] reg_index;
+    wire [2:0] ram_plane;
+    assign is_ram = wb_adr_i[16];
+    assign is_collision = wb_adr_i[8];
+    assign reg_plane = wb_adr_i[7:5];
+    assign reg_index = wb_adr_i[4:2];
+    assign ram_plane = wb_adr_i[SPRITE_RAM_ADDR_WIDTH+2:SPRITE_RAM_ADDR_WIDTH];
+
+    // 寄存器数组的下标，只在 reg_plane < SPRITE_NUM 时使用
+    wire [PLANE_BITS-1:0] plane_sel;
+    assign plane_sel = reg_plane[PLANE_BITS-1:0];
+
+    logic [WISHBONE_DATA_WIDTH-1:0] wb_dat_o_tmp;
+
+    // 写数据在低位，按 sel 移到对应的字节上，与 sram_controller 一致
+    logic [WISHBONE_DATA_WIDTH-1:0] ram_wdata;
+
+    always_comb begin
+        case (wb_sel_i)
+            4'b0010: ram_wdata = {16'b0, wb_dat_i[7:0], 8'b0};
+            4'b0100: ram_wdata = {8'b0, wb_dat_i[7:0], 16'b0};
+            4'b1000: ram_wdata = {wb_dat_i[7:0], 24'b0};
+            4'b1100: ram_wdata = {wb_dat_i[15:0], 16'b0};
+            default: ram_wdata = wb_dat_i;
+        endcase
+    end
+
+    // 寄存器同样按 sel 逐字节写入，sb/sh 只改动对应的字节
+    function automatic [31:0] merge_sel(input [31:0] old, input [31:0] wdata, input [3:0] sel);
+        for (int b = 0; b < 4; b++) begin
+            merge_sel[8*b +: 8] = sel[b] ? wdata[8*b +: 8] : old[8*b +: 8];
+        end
+    endfunction
+
+    // 数据转移
+    always_comb begin
+        wb_dat_o_tmp = 32'h0000_1111;
+
+        if (is_ram) begin
+            // 位图空间只写
+            wb_dat_o_tmp = 32'h0000_0000;
+        end else if (is_collision) begin
+            wb_dat_o_tmp = 32'(collision_sync_1);
+        end else if (reg_plane < SPRITE_NUM) begin
+            case (reg_index)
+                REG_CTRL: wb_dat_o_tmp = {31'b0, enable_reg[plane_sel]};
+                REG_POS:  wb_dat_o_tmp = pos_reg[plane_sel];
+                REG_SIZE: wb_dat_o_tmp = size_reg[plane_sel];
+                REG_SRC:  wb_dat_o_tmp = src_reg[plane_sel];
+                REG_KEY:  wb_dat_o_tmp = {24'b0, key_reg[plane_sel]};
+                // if address is not valid, return 15
+                default:  wb_dat_o_tmp = 32'h0000_1111;
+            endcase
+        end
+    end
+
+    always_ff @ (posedge clk_i) begin
+        if (rst_i) begin
+            wb_ack_o <= 0;
+
+            for (int i = 0; i < SPRITE_NUM; i++) begin
+                enable_reg[i] <= 0;
+                pos_reg[i] <= 32'h0;
+                size_reg[i] <= 32'h0;
+                src_reg[i] <= 32'h0;
+                key_reg[i] <= 8'h0;
+            end
+        end else begin
+            case(state)
+                IDLE: begin
+                    if (wb_cyc_i && wb_stb_i) begin
+                        if (!wb_we_i) begin  // read
+                            wb_dat_o <= wb_dat_o_tmp;
+                        end else if (!is_ram && !is_collision && reg_plane < SPRITE_NUM) begin  // write
+                            case (reg_index)
+                                REG_CTRL: if (wb_sel_i[0]) enable_reg[plane_sel] <= ram_wdata[0];
+                                REG_POS:  pos_reg[plane_sel] <= merge_sel(pos_reg[plane_sel], ram_wdata, wb_sel_i);
+                                REG_SIZE: size_reg[plane_sel] <= merge_sel(size_reg[plane_sel], ram_wdata, wb_sel_i);
+                                REG_SRC:  src_reg[plane_sel] <= merge_sel(src_reg[plane_sel], ram_wdata, wb_sel_i);
+                                REG_KEY:  if (wb_sel_i[0]) key_reg[plane_sel] <= ram_wdata[7:0];
+                                default: ;
+                            endcase
+                        end
+                        wb_ack_o <= 1;
+                    end
+                end
+
+                READ: begin
+                    wb_ack_o <= 0;
+                end
+
+                WRITE: begin
+                    wb_ack_o <= 0;
+                end
+
+                default: ;
+            endcase
+        end
+    end
+
+    /* =========== 扫描输出（vga 时钟域） =========== */
+
+    // 寄存器在每帧结束时锁存一次，帧内位置不变，避免画面撕裂
+    logic vga_end_d;
+    wire frame_start;
+    assign frame_start = vga_end && !vga_end_d;
+
+    reg               en_s   [0:SPRITE_NUM-1];
+    reg signed [15:0] x_s    [0:SPRITE_NUM-1];
+    reg signed [15:0] y_s    [0:SPRITE_NUM-1];
+    reg [9:0]         w_s    [0:SPRITE_NUM-1];
+    reg [9:0]         h_s    [0:SPRITE_NUM-1];
+    reg [SPRITE_RAM_ADDR_WIDTH-1:0] src_s [0:SPRITE_NUM-1];
+    reg [7:0]         key_s  [0:SPRITE_NUM-1];
+
+    always_ff @ (posedge vga_clk) begin
+        vga_end_d <= vga_end;
+        if (frame_start) begin
+            for (int i = 0; i < SPRITE_NUM; i++) begin
+                en_s[i] <= enable_reg[i];
+                x_s[i] <= pos_reg[i][15:0];
+                y_s[i] <= pos_reg[i][31:16];
+                w_s[i] <= size_reg[i][9:0];
+                h_s[i] <= size_reg[i][25:16];
+                src_s[i] <= src_reg[i][SPRITE_RAM_ADDR_WIDTH-1:0];
+                key_s[i] <= key_reg[i];
+            end
+        end
+    end
+
+    // 画布坐标，与 vga_pic 相同
+    wire signed [16:0] canvas_x;
+    wire signed [16:0] canvas_y;
+    assign canvas_x = {7'b0, hdata[9:0] >> vga_scale};
+    assign canvas_y = {7'b0, vdata[9:0] >> vga_scale};
+
+    wire active;
+    assign active = hdata < HSIZE && vdata < VSIZE;
+
+    // 每个平面一块双口位图 ram，写口在系统时钟域，读口在 vga 时钟域
+    logic [SPRITE_NUM-1:0] inside;
+    logic [SPRITE_NUM-1:0] inside_d;
+    logic [1:0] lane_d [0:SPRITE_NUM-1];
+    logic [31:0] ram_data [0:SPRITE_NUM-1];
+    logic [7:0] plane_pixel [0:SPRITE_NUM-1];
+    logic [SPRITE_NUM-1:0] opaque;
+    logic active_d;
+
+    genvar p;
+    generate
+        for (p = 0; p < SPRITE_NUM; p++) begin : plane
+            (* ram_style = "block" *)
+            reg [31:0] ram [0:RAM_WORDS-1];
+
+            wire ram_we;
+            assign ram_we = state == IDLE && wb_cyc_i && wb_stb_i && wb_we_i && is_ram && ram_plane == 3'(p);
+
+            always_ff @ (posedge clk_i) begin
+                if (ram_we) begin
+                    for (int b = 0; b < 4; b++) begin
+                        if (wb_sel_i[b]) begin
+                            ram[wb_adr_i[SPRITE_RAM_ADDR_WIDTH-1:2]][8*b +: 8] <= ram_wdata[8*b +: 8];
+                        end
+                    end
+                end
+            end
+
+            wire signed [16:0] dx;
+            wire signed [16:0] dy;
+            wire [SPRITE_RAM_ADDR_WIDTH-1:0] offset;
+            assign dx = canvas_x - {x_s[p][15], x_s[p]};
+            assign dy = canvas_y - {y_s[p][15], y_s[p]};
+            assign offset = src_s[p] + SPRITE_RAM_ADDR_WIDTH'(dy[9:0]) * SPRITE_RAM_ADDR_WIDTH'(w_s[p])
+                          + SPRITE_RAM_ADDR_WIDTH'(dx[9:0]);
+
+            always_comb begin
+                inside[p] = en_s[p] && dx >= 0 && dx < $signed({7'b0, w_s[p]})
+                                   && dy >= 0 && dy < $signed({7'b0, h_s[p]});
+            end
+
+            always_ff @ (posedge vga_clk) begin
+                ram_data[p] <= ram[offset[SPRITE_RAM_ADDR_WIDTH-1:2]];
+                lane_d[p] <= offset[1:0];
+                inside_d[p] <= inside[p];
+            end
+
+            assign plane_pixel[p] = ram_data[p][{lane_d[p], 3'b000} +: 8];
+            assign opaque[p] = inside_d[p] && plane_pixel[p] != key_s[p];
+        end
+    endgenerate
+
+    // 编号小的平面在上层
+    always_comb begin
+        sprite_hit = 0;
+        sprite_pixel = 8'h00;
+        for (int i = SPRITE_NUM - 1; i >= 0; i--) begin
+            if (opaque[i]) begin
+                sprite_hit = 1;
+                sprite_pixel = plane_pixel[i];
+            end
+        end
+    end
+
+    // 碰撞检测：同一像素上有两个以上不透明平面
+    reg [SPRITE_NUM-1:0] collision_acc;
+    wire overlap;
+    assign overlap = (opaque & (opaque - 1)) != 0;
+
+    always_ff @ (posedge vga_clk) begin
+        active_d <= active;
+        if (frame_start) begin
+            collision_frame <= collision_acc;
+            collision_acc <= 0;
+        end else if (active_d && overlap) begin
+            collision_acc <= collision_acc | opaque;
+        end
+    end
+
+endmodule
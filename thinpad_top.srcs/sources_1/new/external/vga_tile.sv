@@ -0,0 +1,291 @@
+module vga_tile #(
+    parameter WISHBONE_DATA_WIDTH = 32,
+    parameter WISHBONE_ADDR_WIDTH = 32,
+
+    parameter WIDTH = 12,
+    parameter HSIZE = 800,
+    parameter VSIZE = 600,
+    parameter HMAX = 1040,
+    parameter VMAX = 666
+) (
+    // clock and reset
+    input wire clk_i,
+    input wire rst_i,
+
+    // wishbone slave interface
+    input wire wb_cyc_i,
+    input wire wb_stb_i,
+    output reg wb_ack_o,
+    input wire [WISHBONE_ADDR_WIDTH-1:0] wb_adr_i,
+    input wire [WISHBONE_DATA_WIDTH-1:0] wb_dat_i,
+    output reg [WISHBONE_DATA_WIDTH-1:0] wb_dat_o,
+    input wire [WISHBONE_DATA_WIDTH/8-1:0] wb_sel_i,
+    input wire wb_we_i,
+
+    // vga 扫描接口（vga 时钟域）
+    input wire vga_clk,
+    input wire [WIDTH-1:0] hdata,
+    input wire [WIDTH-1:0] vdata,
+    input wire [2:0] vga_scale,
+    input wire vga_end,
+
+    // 位图层像素（与 bram 读出数据同拍），输出与瓦片层合成后的像素
+    input wire [7:0] bitmap_pixel,
+    output reg [7:0] layer_pixel
+);
+
+    // 地址划分
+    // 0x8900_0000 CTRL    bit0 使能，bit1 ABOVE 瓦片层在位图层之上
+    // 0x8900_0004 SCROLL  [8:0] x，[24:16] y，瓦片地图的滚动偏移，超出 512 后回绕
+    // 0x8900_0008 KEY     [7:0] 透明关键色
+    //   ABOVE = 1 时瓦片中等于关键色的像素透明，显示下面的位图
+    //   ABOVE = 0 时位图中等于关键色的像素透明，显示下面的瓦片
+    // 0x8901_0000 瓦片地图，64 x 64 个字节，每个字节是一个瓦片编号
+    // 0x8902_0000 瓦片集，256 个 8x8 瓦片，每个瓦片 64 字节，按行存放
+    // 坐标均为缩放后的画布坐标，与 vga_scale 保持一致
+    localparam REG_CTRL   = 8'h00;
+    localparam REG_SCROLL = 8'h04;
+    localparam REG_KEY    = 8'h08;
+
+    localparam CTRL_EN    = 0;
+    localparam CTRL_ABOVE = 1;
+
+    localparam MAP_WORDS = 1024;
+    localparam SET_WORDS = 4096;
+
+    // 状态转移
+    typedef enum logic [1:0] {
+        IDLE = 0,
+        READ = 1,
+        WRITE = 2
+    } state_t;
+    state_t state, next_state;
+
+    always @(posedge clk_i) begin
+        if (rst_i) begin
+            state <= IDLE;
+        end else begin
+            state <= next_state;
+        end
+    end
+
+    always_comb begin
+        next_state = IDLE;
+        case(state)
+            IDLE: begin
+                if (wb_cyc_i && wb_stb_i) begin
+                    if (wb_we_i) begin  // write
+                        next_state = WRITE;
+                    end else begin  // read
+                        next_state = READ;
+                    end
+                end
+            end
+
+            READ: begin
+                next_state = IDLE;  // 两周期读
+            end
+
+            WRITE: begin
+                next_state = IDLE;  // 两周期写
+            end
+
+            default: ;
+        endcase
+    end
+
+    /* =========== 寄存器（系统时钟域） =========== */
+
+    reg [31:0] ctrl_reg;
+    reg [31:0] scroll_reg;
+    reg [31:0] key_reg;
+
+    wire is_map;
+    wire is_set;
+    assign is_map = wb_adr_i[17:16] == 2'b01;
+    assign is_set = wb_adr_i[17];
+
+    logic [WISHBONE_DATA_WIDTH-1:0] wb_dat_o_tmp;
+
+    // 写数据在低位，按 sel 移到对应的字节上，与 sram_controller 一致
+    logic [WISHBONE_DATA_WIDTH-1:0] ram_wdata;
+
+    always_comb begin
+        case (wb_sel_i)
+            4'b0010: ram_wdata = {16'b0, wb_dat_i[7:0], 8'b0};
+            4'b0100: ram_wdata = {8'b0, wb_dat_i[7:0], 16'b0};
+            4'b1000: ram_wdata = {wb_dat_i[7:0], 24'b0};
+            4'b1100: ram_wdata = {wb_dat_i[15:0], 16'b0};
+            default: ram_wdata = wb_dat_i;
+        endcase
+    end
+
+    // 寄存器同样按 sel 逐字节写入，sb/sh 只改动对应的字节
+    function automatic [31:0] merge_sel(input [31:0] old, input [31:0] wdata, input [3:0] sel);
+        for (int b = 0; b < 4; b++) begin
+            merge_sel[8*b +: 8] = sel[b] ? wdata[8*b +: 8] : old[8*b +: 8];
+        end
+    endfunction
+
+    // 数据转移
+    always_comb begin
+        if (is_map || is_set) begin
+            // 地图和瓦片集只写
+            wb_dat_o_tmp = 32'h0000_0000;
+        end else begin
+            case (wb_adr_i[7:0])
+                REG_CTRL:   wb_dat_o_tmp = ctrl_reg;
+                REG_SCROLL: wb_dat_o_tmp = scroll_reg;
+                REG_KEY:    wb_dat_o_tmp = key_reg;
+                // if address is not valid, return 15
+                default:    wb_dat_o_tmp = 32'h0000_1111;
+            endcase
+        end
+    end
+
+    always_ff @ (posedge clk_i) begin
+        if (rst_i) begin
+            wb_ack_o <= 0;
+
+            ctrl_reg <= 32'h0;
+            scroll_reg <= 32'h0;
+            key_reg <= 32'h0;
+        end else begin
+            case(state)
+                IDLE: begin
+                    if (wb_cyc_i && wb_stb_i) begin
+                        if (!wb_we_i) begin  // read
+                            wb_dat_o <= wb_dat_o_tmp;
+                        end else if (!is_map && !is_set) begin  // write
+                            case (wb_adr_i[7:0])
+                                REG_CTRL:   ctrl_reg <= merge_sel(ctrl_reg, ram_wdata, wb_sel_i);
+                                REG_SCROLL: scroll_reg <= merge_sel(scroll_reg, ram_wdata, wb_sel_i);
+                                REG_KEY:    key_reg <= merge_sel(key_reg, ram_wdata, wb_sel_i);
+                                default: ;
+                            endcase
+                        end
+                        wb_ack_o <= 1;
+                    end
+                end
+
+                READ: begin
+                    wb_ack_o <= 0;
+                end
+
+                WRITE: begin
+                    wb_ack_o <= 0;
+                end
+
+                default: ;
+            endcase
+        end
+    end
+
+    // 地图和瓦片集各一块双口 ram，写口在系统时钟域，读口在 vga 时钟域
+    (* ram_style = "block" *)
+    reg [31:0] map_ram [0:MAP_WORDS-1];
+    (* ram_style = "block" *)
+    reg [31:0] set_ram [0:SET_WORDS-1];
+
+    wire ram_we;
+    assign ram_we = state == IDLE && wb_cyc_i && wb_stb_i && wb_we_i;
+
+    always_ff @ (posedge clk_i) begin
+        if (ram_we && is_map) begin
+            for (int b = 0; b < 4; b++) begin
+                if (wb_sel_i[b]) begin
+                    map_ram[wb_adr_i[11:2]][8*b +: 8] <= ram_wdata[8*b +: 8];
+                end
+            end
+        end
+    end
+
+    always_ff @ (posedge clk_i) begin
+        if (ram_we && is_set) begin
+            for (int b = 0; b < 4; b++) begin
+                if (wb_sel_i[b]) begin
+                    set_ram[wb_adr_i[13:2]][8*b +: 8] <= ram_wdata[8*b +: 8];
+                end
+            end
+        end
+    end
+
+    /* =========== 扫描输出（vga 时钟域） =========== */
+
+    // 寄存器在每帧结束时锁存一次，帧内滚动位置不变，避免画面撕裂
+    logic vga_end_d;
+    wire frame_start;
+    assign frame_start = vga_end && !vga_end_d;
+
+    reg       en_s;
+    reg       above_s;
+    reg [8:0] scroll_x_s;
+    reg [8:0] scroll_y_s;
+    reg [7:0] key_s;
+
+    always_ff @ (posedge vga_clk) begin
+        vga_end_d <= vga_end;
+        if (frame_start) begin
+            en_s <= ctrl_reg[CTRL_EN];
+            above_s <= ctrl_reg[CTRL_ABOVE];
+            scroll_x_s <= scroll_reg[8:0];
+            scroll_y_s <= scroll_reg[24:16];
+            key_s <= key_reg[7:0];
+        end
+    end
+
+    // 查地图和查瓦片集共两拍，比位图多一拍，所以地图提前一个像素读取
+    wire [WIDTH-1:0] next_h;
+    wire [WIDTH-1:0] next_v;
+    assign next_h = (hdata == HMAX - 1) ? 0 : hdata + 1;
+    assign next_v = (hdata != HMAX - 1) ? vdata :
+                    (vdata == VMAX - 1) ? 0 : vdata + 1;
+
+    // 瓦片地图上的坐标
+    wire [8:0] map_x;
+    wire [8:0] map_y;
+    assign map_x = 9'(next_h[9:0] >> vga_scale) + scroll_x_s;
+    assign map_y = 9'(next_v[9:0] >> vga_scale) + scroll_y_s;
+
+    // 第一拍：读地图
+    logic [31:0] map_data;
+    logic [1:0] map_lane;
+    logic [2:0] fine_x;
+    logic [2:0] fine_y;
+
+    always_ff @ (posedge vga_clk) begin
+        map_data <= map_ram[{map_y[8:3], map_x[8:5]}];
+        map_lane <= map_x[4:3];
+        fine_x <= map_x[2:0];
+        fine_y <= map_y[2:0];
+    end
+
+    // 第二拍：读瓦片集
+    wire [7:0] tile_index;
+    wire [13:0] tile_offset;
+    assign tile_index = map_data[{map_lane, 3'b000} +: 8];
+    assign tile_offset = {tile_index, fine_y, fine_x};
+
+    logic [31:0] set_data;
+    logic [1:0] set_lane;
+
+    always_ff @ (posedge vga_clk) begin
+        set_data <= set_ram[tile_offset[13:2]];
+        set_lane <= tile_offset[1:0];
+    end
+
+    wire [7:0] tile_pixel;
+    assign tile_pixel = set_data[{set_lane, 3'b000} +: 8];
+
+    // 与位图层合成
+    always_comb begin
+        if (!en_s) begin
+            layer_pixel = bitmap_pixel;
+        end else if (above_s) begin
+            layer_pixel = (tile_pixel == key_s) ? bitmap_pixel : tile_pixel;
+        end else begin
+            layer_pixel = (bitmap_pixel == key_s) ? tile_pixel : bitmap_pixel;
+        end
+    end
+
+endmodule
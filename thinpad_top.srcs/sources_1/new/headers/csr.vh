@@ -21,6 +21,12 @@
 `define CSR_MEDELEG_ADDR  12'h302
 `define CSR_MIDELEG_ADDR  12'h303
 `define CSR_MTVAL_ADDR    12'h343
+`define CSR_MENVCFG_ADDR  12'h30a
+`define CSR_MENVCFGH_ADDR 12'h31a
+`define CSR_MCOUNTEREN_ADDR    12'h306
+`define CSR_MCOUNTINHIBIT_ADDR 12'h320
+// Custom M-mode read/write CSR: worst observed interrupt latency in cycles
+`define CSR_MIRQLAT_ADDR  12'h7c0
 
 `define CSR_SSTATUS_ADDR  12'h100
 `define CSR_SEPC_ADDR     12'h141
@@ -31,10 +37,21 @@
 `define CSR_SIE_ADDR      12'h104
 `define CSR_SIP_ADDR      12'h144
 `define CSR_SATP_ADDR     12'h180
+`define CSR_STIMECMP_ADDR  12'h14d
+`define CSR_STIMECMPH_ADDR 12'h15d
+`define CSR_SCOUNTEREN_ADDR 12'h106
 
 `define CSR_TIME_ADDR     12'hc01
 `define CSR_TIMEH_ADDR    12'hc81
 
+// Counter ranges, [4:0] is the counter index and [7] selects the high half:
+// 0xb00 ~ 0xb1f, 0xb80 ~ 0xb9f  mcycle, -, minstret, mhpmcounter3 ~ 31
+// 0xc00 ~ 0xc1f, 0xc80 ~ 0xc9f  cycle, time, instret, hpmcounter3 ~ 31
+// 0x323 ~ 0x33f                 mhpmevent3 ~ 31
+`define CSR_MCOUNTER_PAGE 4'hb
+`define CSR_COUNTER_PAGE  4'hc
+`define CSR_MHPMEVENT_PAGE 7'b0011_001
+
 // These are MMIO registers
 `define CSR_MTIME_MEM_ADDR    32'h200bff8
 `define CSR_MTIMECMP_MEM_ADDR 32'h2004000
@@ -125,6 +142,12 @@ typedef logic [31:0] csr_medeleg_t;
 
 typedef logic [31:0] csr_mtval_t;
 
+// Only STCE (bit 63) is implemented, the other fields are read-only zero
+typedef struct packed {
+  logic        stce;
+  logic [62:0] _p_0;
+} csr_menvcfg_t;
+
 //////// S-mode registers
 
 typedef struct packed {
@@ -192,6 +215,33 @@ typedef struct packed {
 } csr_satp_t;
 
 typedef logic [63:0] csr_time_t;
+
+// Sstc: S-mode timer compare against time
+typedef logic [63:0] csr_stimecmp_t;
 // ===== End CSR definitions =====
 
+// ==== Begin hardware performance monitor ====
+// mhpmcounter3 ~ mhpmcounter10 are implemented, the rest read as zero
+`define HPM_COUNTER_FIRST 3
+`define HPM_COUNTER_LAST  10
+// Counters implemented in mcounteren/scounteren/mcountinhibit
+`define HPM_COUNTER_MASK  32'h0000_07ff
+
+// Event numbers for mhpmevent, each event is one bit of the event vector
+`define HPM_EVENT_WIDTH        32
+`define HPM_EVENT_NONE         0
+`define HPM_EVENT_IF_BUSY      1   // cycles IF waits for a fetch
+`define HPM_EVENT_MEM_BUSY     2   // cycles MEM waits for a load/store
+`define HPM_EVENT_BRANCH_FLUSH 3   // taken branches and jumps
+`define HPM_EVENT_LOAD_USE     4   // instructions using a load result right behind it
+`define HPM_EVENT_TLB_HIT      5   // translated accesses found in the TLB
+`define HPM_EVENT_TLB_MISS     6   // translated accesses not found in the TLB
+`define HPM_EVENT_PTE_LOAD     7   // page table entries read by the page walker
+`define HPM_EVENT_EXCEPTION    8   // synchronous traps taken
+`define HPM_EVENT_INTERRUPT    9   // interrupts taken
+`define HPM_EVENT_XRET         10  // mret/sret committed
+`define HPM_EVENT_WFI          11  // cycles wfi waits in EXE
+`define HPM_EVENT_REDIRECT_HIT 12  // traps/xRETs that reused the early fetch
+// ===== End hardware performance monitor =====
+
 `endif
\ No newline at end of file
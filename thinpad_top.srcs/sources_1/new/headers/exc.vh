@@ -18,6 +18,7 @@ typedef enum logic [`SYS_INSTR_T_WIDTH-1:0] {
   SYS_INSTR_SRET,
   SYS_INSTR_URET,
   SYS_INSTR_SFENCE_VMA,
+  SYS_INSTR_WFI,
   SYS_INSTR_NOP
 } sys_instr_t;
 
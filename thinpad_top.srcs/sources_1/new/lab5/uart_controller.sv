@@ -3,7 +3,8 @@ module uart_controller #(
     parameter DATA_WIDTH = 32,
 
     parameter CLK_FREQ = 50_000_000,
-    parameter BAUD = 115200
+    parameter BAUD = 115200,         // baud rate after reset, software may change it
+    parameter FIFO_DEPTH_LOG2 = 4    // 16-byte FIFOs as on a 16550
 ) (
     // clk and reset
     input wire clk_i,
@@ -21,46 +22,330 @@ module uart_controller #(
 
     // uart interface
     output reg uart_txd_o,
-    input  wire uart_rxd_i
+    input  wire uart_rxd_i,
+
+    // level interrupt to the core
+    output wire irq_o
 );
 
-  localparam REG_DATA = 8'h00;
-  localparam REG_STATUS = 8'h05;
-
-  // uart transmitter
-  logic txd_start;
-  logic txd_busy;
-  logic [7:0] txd_data;
-
-  async_transmitter #(
-      .ClkFrequency(CLK_FREQ),
-      .Baud        (BAUD)
-  ) u_async_transmitter (
-      .clk      (clk_i),
-      .TxD_start(txd_start),
-      .TxD_data (txd_data),
-      .TxD      (uart_txd_o),
-      .TxD_busy (txd_busy)
+  // 16550-compatible register map, one byte per address.
+  // Frames are fixed to 8N1; LCR is stored for software but only DLAB is used.
+  localparam REG_DATA = 8'h00;    // RBR (read) / THR (write), DLL when DLAB = 1
+  localparam REG_IER = 8'h01;     // DLM when DLAB = 1
+  localparam REG_IIR = 8'h02;     // IIR (read) / FCR (write), DLD when DLAB = 1
+  localparam REG_LCR = 8'h03;
+  localparam REG_MCR = 8'h04;
+  localparam REG_STATUS = 8'h05;  // LSR
+  localparam REG_MSR = 8'h06;
+  localparam REG_SCR = 8'h07;
+
+  // The bit clock is oversampled 8 times, so that 921600 baud still gets
+  // more than two system clocks per sample at 20 MHz. The sample period is
+  // {DLM, DLL} + DLD / 16 clocks, DLD being a 4-bit fractional divisor.
+  localparam OVERSAMPLE = 8;
+  localparam DIV_X16 = CLK_FREQ * 16 / (BAUD * OVERSAMPLE);
+  localparam [15:0] RESET_DIV = 16'(DIV_X16 / 16);
+  localparam [3:0] RESET_DLD = 4'(DIV_X16 % 16);
+
+  // RX timeout after four idle character times, as on a 16550
+  localparam TIMEOUT_TICKS = 4 * 10 * OVERSAMPLE;
+
+  /*-- internal registers --*/
+  reg [7:0] dll;
+  reg [7:0] dlm;
+  reg [3:0] dld;
+  reg [3:0] ier;
+  reg [1:0] rx_trigger;
+  reg [7:0] lcr;
+  reg [7:0] mcr;
+  reg [7:0] scr;
+
+  wire dlab = lcr[7];
+
+  // byte stores arrive in the low bits whatever the lane, so sel is not checked
+  wire req = wb_cyc_i && wb_stb_i && !wb_ack_o;
+  wire wr_req = req && wb_we_i;
+  wire rd_req = req && !wb_we_i;
+
+  /*-- sample tick generator --*/
+  wire [15:0] divisor = {dlm, dll};
+  reg [15:0] tick_cnt;
+  reg [3:0] tick_frac;
+  wire tick = tick_cnt == 0;
+  wire [4:0] tick_frac_next = 5'(tick_frac) + 5'(dld);
+
+  always_ff @(posedge clk_i) begin
+    if (rst_i) begin
+      tick_cnt <= 0;
+      tick_frac <= 0;
+    end else if (tick) begin
+      // one extra clock whenever the fractional part carries
+      tick_cnt <= (divisor == 0 ? 16'd0 : divisor - 16'd1) + 16'(tick_frac_next[4]);
+      tick_frac <= tick_frac_next[3:0];
+    end else begin
+      tick_cnt <= tick_cnt - 1;
+    end
+  end
+
+  /*-- FIFOs --*/
+  logic fcr_write;
+  logic [7:0] fcr_data;
+  wire rx_clr = fcr_write && fcr_data[1];
+  wire tx_clr = fcr_write && fcr_data[2];
+
+  logic tx_push;
+  logic tx_pop;
+  logic [7:0] tx_head;
+  logic tx_full;
+  logic tx_empty;
+
+  sync_fifo #(
+      .DATA_WIDTH(8),
+      .DEPTH_LOG2(FIFO_DEPTH_LOG2)
+  ) u_tx_fifo (
+      .clk_i    (clk_i),
+      .rst_i    (rst_i),
+      .clr_i    (tx_clr),
+      .wr_en_i  (tx_push),
+      .wr_data_i(wb_dat_i[7:0]),
+      .rd_en_i  (tx_pop),
+      .rd_data_o(tx_head),
+      .full_o   (tx_full),
+      .empty_o  (tx_empty),
+      .count_o  ()
   );
 
-  // uart receiver
-  logic rxd_data_ready;
-  logic [7:0] rxd_data;
-  logic rxd_clear;
-
-  async_receiver #(
-      .ClkFrequency(CLK_FREQ),
-      .Baud        (BAUD)
-  ) u_async_receiver (
-      .clk           (clk_i),
-      .RxD           (uart_rxd_i),
-      .RxD_data_ready(rxd_data_ready),
-      .RxD_clear     (rxd_clear),
-      .RxD_data      (rxd_data)
+  logic rx_push;
+  logic rx_pop;
+  logic [7:0] rx_byte;
+  logic [7:0] rx_head;
+  logic rx_full;
+  logic rx_empty;
+  logic [FIFO_DEPTH_LOG2:0] rx_count;
+
+  sync_fifo #(
+      .DATA_WIDTH(8),
+      .DEPTH_LOG2(FIFO_DEPTH_LOG2)
+  ) u_rx_fifo (
+      .clk_i    (clk_i),
+      .rst_i    (rst_i),
+      .clr_i    (rx_clr),
+      .wr_en_i  (rx_push),
+      .wr_data_i(rx_byte),
+      .rd_en_i  (rx_pop),
+      .rd_data_o(rx_head),
+      .full_o   (rx_full),
+      .empty_o  (rx_empty),
+      .count_o  (rx_count)
   );
 
-  /*-- internal registers --*/
-  wire [7:0] reg_status = {2'b0, ~txd_busy, 4'b0, rxd_data_ready};
+  assign tx_push = wr_req && !dlab && wb_adr_i[7:0] == REG_DATA;
+  assign rx_pop = rd_req && !dlab && wb_adr_i[7:0] == REG_DATA;
+  assign fcr_write = wr_req && !dlab && wb_adr_i[7:0] == REG_IIR;
+  assign fcr_data = wb_dat_i[7:0];
+
+`ifdef UART_BYPASS
+  // Simulation only: bytes go to and come from the host through DPI
+  // (sim_1/new/uart_bypass.cpp) as soon as they reach the FIFOs. There is
+  // no bit timing, the divisor only paces the RX timeout and the pins idle.
+  import "DPI-C" function void uart_bypass_putc(input int c);
+  import "DPI-C" function int uart_bypass_getc();
+
+  /*-- transmitter --*/
+  // a byte is handed to the host in the cycle it is popped, so the shift
+  // register is never busy and TEMT follows THRE
+  wire tx_busy = 1'b0;
+
+  assign tx_pop = !tx_empty;
+
+  always_ff @(posedge clk_i) begin
+    if (rst_i) begin
+      uart_txd_o <= 1;
+    end else if (tx_pop) begin
+      uart_bypass_putc({24'b0, tx_head});
+    end
+  end
+
+  /*-- receiver --*/
+  logic rx_frame_err;
+  int rx_char;
+
+  always_ff @(posedge clk_i) begin
+    if (rst_i) begin
+      rx_push <= 0;
+      rx_frame_err <= 0;
+    end else begin
+      rx_push <= 0;
+      // every other cycle at most, so that rx_full is up to date
+      if (!rx_full && !rx_push) begin
+        rx_char = uart_bypass_getc();
+        if (rx_char >= 0) begin
+          rx_byte <= rx_char[7:0];
+          rx_push <= 1;
+        end
+      end
+    end
+  end
+`else
+  /*-- transmitter --*/
+  reg tx_busy;
+  reg [8:0] tx_shift;  // {stop, data}, start bit is sent first
+  reg [3:0] tx_bits;
+  reg [2:0] tx_phase;
+
+  assign tx_pop = !tx_busy && !tx_empty;
+
+  always_ff @(posedge clk_i) begin
+    if (rst_i) begin
+      uart_txd_o <= 1;
+      tx_busy <= 0;
+      tx_shift <= 0;
+      tx_bits <= 0;
+      tx_phase <= 0;
+    end else if (tx_pop) begin
+      tx_busy <= 1;
+      tx_shift <= {1'b1, tx_head};
+      tx_bits <= 0;
+      tx_phase <= 0;
+      uart_txd_o <= 0;
+    end else if (tx_busy && tick) begin
+      tx_phase <= tx_phase + 1;
+      if (tx_phase == 3'(OVERSAMPLE - 1)) begin
+        if (tx_bits == 9) begin
+          // stop bit done
+          tx_busy <= 0;
+        end else begin
+          uart_txd_o <= tx_shift[0];
+          tx_shift <= {1'b1, tx_shift[8:1]};
+          tx_bits <= tx_bits + 1;
+        end
+      end
+    end
+  end
+
+  /*-- receiver --*/
+  reg [2:0] rxd_sync;
+  wire rxd = rxd_sync[2];
+
+  reg rx_busy;
+  reg [3:0] rx_bits;
+  reg [2:0] rx_phase;
+  reg [7:0] rx_shift;
+  logic rx_frame_err;
+
+  always_ff @(posedge clk_i) begin
+    if (rst_i) begin
+      rxd_sync <= 3'b111;
+      rx_busy <= 0;
+      rx_bits <= 0;
+      rx_phase <= 0;
+      rx_shift <= 0;
+      rx_push <= 0;
+      rx_frame_err <= 0;
+    end else begin
+      rxd_sync <= {rxd_sync[1:0], uart_rxd_i};
+      rx_push <= 0;
+      rx_frame_err <= 0;
+
+      if (tick) begin
+        if (!rx_busy) begin
+          if (!rxd) begin
+            rx_busy <= 1;
+            rx_bits <= 0;
+            rx_phase <= 1;
+          end
+        end else begin
+          rx_phase <= rx_phase + 1;
+          // sample in the middle of each bit
+          if (rx_phase == 3'(OVERSAMPLE / 2 - 1)) begin
+            if (rx_bits == 0) begin
+              // glitch on the start bit, back to idle
+              if (rxd) rx_busy <= 0;
+            end else if (rx_bits == 9) begin
+              rx_busy <= 0;
+              if (rxd) begin
+                rx_byte <= rx_shift;
+                rx_push <= 1;
+              end else begin
+                rx_frame_err <= 1;
+              end
+            end else begin
+              rx_shift <= {rxd, rx_shift[7:1]};
+            end
+            rx_bits <= rx_bits + 1;
+          end
+        end
+      end
+    end
+  end
+
+`endif
+
+  /*-- interrupt sources --*/
+  reg overrun;
+  reg frame_err;
+  reg thre_pending;
+  reg [8:0] timeout_cnt;
+
+  wire line_status_irq = ier[2] && (overrun || frame_err);
+  wire rx_data_irq = ier[0] && rx_count >= (
+      rx_trigger == 2'd0 ? 1 :
+      rx_trigger == 2'd1 ? 4 :
+      rx_trigger == 2'd2 ? 8 : 14);
+  wire timeout_irq = ier[0] && !rx_empty && timeout_cnt == TIMEOUT_TICKS;
+  wire thre_irq = ier[1] && thre_pending;
+
+  // highest priority first
+  logic [3:0] iir_id;
+  always_comb begin
+    if (line_status_irq) iir_id = 4'h6;
+    else if (rx_data_irq) iir_id = 4'h4;
+    else if (timeout_irq) iir_id = 4'hC;
+    else if (thre_irq) iir_id = 4'h2;
+    else iir_id = 4'h1;
+  end
+
+  assign irq_o = !iir_id[0];
+
+  wire lsr_read = rd_req && wb_adr_i[7:0] == REG_STATUS;
+  wire iir_read = rd_req && !dlab && wb_adr_i[7:0] == REG_IIR;
+  wire ier_write = wr_req && !dlab && wb_adr_i[7:0] == REG_IER;
+
+  // tx_empty is delayed one clock to find the moment the FIFO drains
+  reg tx_empty_d;
+
+  always_ff @(posedge clk_i) begin
+    if (rst_i) begin
+      overrun <= 0;
+      frame_err <= 0;
+      thre_pending <= 0;
+      tx_empty_d <= 1;
+      timeout_cnt <= 0;
+    end else begin
+      tx_empty_d <= tx_empty;
+
+      if (lsr_read) begin
+        overrun <= 0;
+        frame_err <= 0;
+      end else begin
+        if (rx_push && rx_full) overrun <= 1;
+        if (rx_frame_err) frame_err <= 1;
+      end
+
+      if (tx_push || (iir_read && iir_id == 4'h2)) begin
+        thre_pending <= 0;
+      end else if ((tx_empty && !tx_empty_d) || (ier_write && wb_dat_i[1] && !ier[1] && tx_empty)) begin
+        thre_pending <= 1;
+      end
+
+      // any FIFO activity restarts the timeout
+      if (rx_push || rx_pop || rx_empty) begin
+        timeout_cnt <= 0;
+      end else if (tick && timeout_cnt != TIMEOUT_TICKS) begin
+        timeout_cnt <= timeout_cnt + 1;
+      end
+    end
+  end
 
   /*-- wishbone fsm --*/
   always_ff @(posedge clk_i) begin
@@ -78,49 +363,65 @@ module uart_controller #(
   // write logic
   always_ff @(posedge clk_i) begin
     if (rst_i) begin
-      txd_start <= 0;
-    end else if(wb_stb_i && wb_we_i) begin
+      dll <= RESET_DIV[7:0];
+      dlm <= RESET_DIV[15:8];
+      dld <= RESET_DLD;
+      ier <= 0;
+      rx_trigger <= 0;
+      lcr <= 8'h03;  // 8N1
+      mcr <= 0;
+      scr <= 0;
+    end else if (wr_req) begin
       case (wb_adr_i[7:0])
-        REG_DATA: begin
-          if(wb_sel_i[0]) begin
-            txd_data  <= wb_dat_i[7:0];
-            txd_start <= 1;
-          end
+        REG_DATA: if (dlab) dll <= wb_dat_i[7:0];
+        REG_IER: begin
+          if (dlab) dlm <= wb_dat_i[7:0];
+          else ier <= wb_dat_i[3:0];
         end
-
+        REG_IIR: begin
+          if (dlab) dld <= wb_dat_i[3:0];
+          else rx_trigger <= wb_dat_i[7:6];
+        end
+        REG_LCR: lcr <= wb_dat_i[7:0];
+        REG_MCR: mcr <= wb_dat_i[7:0];
+        REG_SCR: scr <= wb_dat_i[7:0];
         default: ;  // do nothing
       endcase
-    end else begin
-      txd_start <= 0;
     end
   end
 
   // read logic
-  always_ff @(posedge clk_i) begin
-    if(rst_i) begin
-      rxd_clear <= 1;  // clear rxd to initialize dataready
-    end else if(wb_stb_i && !wb_we_i) begin
-      case (wb_adr_i[7:0])
-        REG_DATA: begin
-          if (wb_sel_i[0]) wb_dat_o[7:0] <= rxd_data;
-          if (wb_sel_i[1]) wb_dat_o[15:8] <= rxd_data;
-          if (wb_sel_i[2]) wb_dat_o[23:16] <= rxd_data;
-          if (wb_sel_i[3]) wb_dat_o[31:24] <= rxd_data;
+  logic [7:0] reg_status;
+  assign reg_status = {
+    1'b0,
+    tx_empty && !tx_busy,  // TEMT
+    tx_empty,  // THRE
+    1'b0,
+    frame_err,
+    1'b0,
+    overrun,
+    !rx_empty  // DR
+  };
 
-          rxd_clear <= 1;
-        end
-
-        REG_STATUS: begin
-          if (wb_sel_i[0]) wb_dat_o[7:0] <= reg_status;
-          if (wb_sel_i[1]) wb_dat_o[15:8] <= reg_status;
-          if (wb_sel_i[2]) wb_dat_o[23:16] <= reg_status;
-          if (wb_sel_i[3]) wb_dat_o[31:24] <= reg_status;
-        end
+  logic [7:0] rd_byte;
+  always_comb begin
+    case (wb_adr_i[7:0])
+      REG_DATA: rd_byte = dlab ? dll : rx_head;
+      REG_IER: rd_byte = dlab ? dlm : {4'b0, ier};
+      // FIFOs are always enabled, so IIR[7:6] always reads 11
+      REG_IIR: rd_byte = dlab ? {4'b0, dld} : {4'b1100, iir_id};
+      REG_LCR: rd_byte = lcr;
+      REG_MCR: rd_byte = mcr;
+      REG_STATUS: rd_byte = reg_status;
+      REG_MSR: rd_byte = 8'h00;
+      REG_SCR: rd_byte = scr;
+      default: rd_byte = 8'h00;
+    endcase
+  end
 
-        default: ;  // do nothing
-      endcase
-    end else begin
-      rxd_clear <= 0;
+  always_ff @(posedge clk_i) begin
+    if (rd_req) begin
+      wb_dat_o <= {4{rd_byte}};
     end
   end
 
@@ -1,5 +1,7 @@
  `default_nettype none
 
+`include "headers/csr.vh"
+
 module thinpad_top (
     input wire clk_50M,     // 50MHz 时钟输入
     input wire clk_11M0592, // 11.0592MHz 时钟输入（备用，可不用）
@@ -275,6 +277,26 @@ module thinpad_top (
   logic [ 3:0] wbm_sel_o;
   logic        wbm_we_o;
 
+  // MMU => Wishbone arbiter
+  logic        cpu_wbm_cyc_o;
+  logic        cpu_wbm_stb_o;
+  logic        cpu_wbm_ack_i;
+  logic [31:0] cpu_wbm_adr_o;
+  logic [31:0] cpu_wbm_dat_o;
+  logic [31:0] cpu_wbm_dat_i;
+  logic [ 3:0] cpu_wbm_sel_o;
+  logic        cpu_wbm_we_o;
+
+  // Blitter => Wishbone arbiter
+  logic        blit_wbm_cyc_o;
+  logic        blit_wbm_stb_o;
+  logic        blit_wbm_ack_i;
+  logic [31:0] blit_wbm_adr_o;
+  logic [31:0] blit_wbm_dat_o;
+  logic [31:0] blit_wbm_dat_i;
+  logic [ 3:0] blit_wbm_sel_o;
+  logic        blit_wbm_we_o;
+
   logic [31:0] mmu_satp;
   logic [31:0] mmu_v_addr;
   logic [31:0] mmu_wdata;
@@ -289,6 +311,7 @@ module thinpad_top (
   logic        mmu_store_pf;
   logic        mmu_fetch_pf;
   logic        mmu_invalid_addr;
+  logic [`HPM_EVENT_WIDTH-1:0] mmu_hpm_event;
 
   logic [31:0] mmu0_v_addr;
   logic [31:0] mmu0_wdata;
@@ -327,6 +350,21 @@ module thinpad_top (
   logic        rf_wen;
 
   logic        exc_interrupt;
+  logic        exc_wfi_wake;
+  logic [31:0] exc_irq_pc;
+  logic        exc_irq_fast;
+  logic [31:0] exc_ret_pc;
+  logic        exc_ret_fast;
+  logic        exc_same_regime;
+  // 中断和 xRET 的提前取指（README“低延迟陷入”）。redirect_tb 还没有在仿真器中跑通，
+  // 暂时关闭：为 0 时不把 exc_unit 的提示送给流水线，陷入和 xRET 照常在 MEM 提交后转向
+  localparam EARLY_REDIRECT = 0;
+  logic        pipeline_retire;
+  logic [31:0] pipeline_retire_pc;
+  logic [31:0] pipeline_retire_instr;
+  logic [ 4:0] pipeline_retire_rd_addr;
+  logic [31:0] pipeline_retire_rd_wdata;
+  logic [`HPM_EVENT_WIDTH-1:0] pipeline_hpm_event;
   logic [31:0] exc_csr_rdata;
   logic        exc_csr_invalid_r;
   logic        exc_csr_invalid_w;
@@ -345,6 +383,18 @@ module thinpad_top (
   logic [ 1:0] exc_nxt_privilege;
   logic mti_occur;
   logic mti_occur_n;
+  logic [63:0] mtime;
+
+  // 外部中断
+  logic vga_irq;
+  logic uart_irq;
+  logic gpio_irq;
+  logic blit_done;
+  logic busmon_irq;
+  logic prof_irq;
+  logic trace_irq;
+  logic ext_irq;
+  logic ext_irq_s;
 
   mmu u_mmu(
     .clk_i(sys_clk),
@@ -375,14 +425,16 @@ module thinpad_top (
     .invalid_addr_o(mmu_invalid_addr),
 
     // Wishbone master
-    .wb_cyc_o(wbm_cyc_o),
-    .wb_stb_o(wbm_stb_o),
-    .wb_ack_i(wbm_ack_i),
-    .wb_adr_o(wbm_adr_o),
-    .wb_dat_o(wbm_dat_o),
-    .wb_dat_i(wbm_dat_i),
-    .wb_sel_o(wbm_sel_o),
-    .wb_we_o(wbm_we_o)
+    .wb_cyc_o(cpu_wbm_cyc_o),
+    .wb_stb_o(cpu_wbm_stb_o),
+    .wb_ack_i(cpu_wbm_ack_i),
+    .wb_adr_o(cpu_wbm_adr_o),
+    .wb_dat_o(cpu_wbm_dat_o),
+    .wb_dat_i(cpu_wbm_dat_i),
+    .wb_sel_o(cpu_wbm_sel_o),
+    .wb_we_o(cpu_wbm_we_o),
+
+    .hpm_event_o(mmu_hpm_event)
   );
 
   mmu_arbiter_2 u_mmu_arbiter_2(
@@ -475,7 +527,10 @@ module thinpad_top (
     .wen_i(rf_wen)
   );
 
-  pipeline u_pipeline(
+  // 复位后从 boot ROM 开始执行
+  pipeline #(
+    .RESET_VECTOR(32'h8200_0000)
+  ) u_pipeline(
     .clk_i(sys_clk),
     .rst_i(sys_rst),
 
@@ -528,6 +583,12 @@ module thinpad_top (
 
     /* ========== exception unit signals ========== */
     .exc_interrupt_i(exc_interrupt),
+    .exc_wfi_wake_i(exc_wfi_wake),
+    .exc_irq_pc_i(exc_irq_pc),
+    .exc_irq_fast_i(EARLY_REDIRECT ? exc_irq_fast : 1'b0),
+    .exc_ret_pc_i(exc_ret_pc),
+    .exc_ret_fast_i(EARLY_REDIRECT ? exc_ret_fast : 1'b0),
+    .exc_same_regime_i(exc_same_regime),
     .exc_csr_rdata_i(exc_csr_rdata),
     .exc_csr_invalid_r_i(exc_csr_invalid_r),
     .exc_csr_invalid_w_i(exc_csr_invalid_w),
@@ -543,7 +604,15 @@ module thinpad_top (
     .exc_privilege_o(exc_privilege),
 
     .exc_next_pc_i(exc_next_pc),
-    .exc_nxt_privilege_i(exc_nxt_privilege)
+    .exc_nxt_privilege_i(exc_nxt_privilege),
+
+    /* ========== performance counter and commit trace signals ========== */
+    .retire_o(pipeline_retire),
+    .retire_pc_o(pipeline_retire_pc),
+    .retire_instr_o(pipeline_retire_instr),
+    .retire_rd_addr_o(pipeline_retire_rd_addr),
+    .retire_rd_wdata_o(pipeline_retire_rd_wdata),
+    .hpm_event_o(pipeline_hpm_event)
   );
 
   exc_unit u_exc_unit(
@@ -553,6 +622,15 @@ module thinpad_top (
     .exc_en_i(exc_exc_en),
     .exc_ret_i(exc_exc_ret),
     .interrupt_occur_o(exc_interrupt),
+    .wfi_wake_o(exc_wfi_wake),
+    .irq_pc_o(exc_irq_pc),
+    .irq_fast_o(exc_irq_fast),
+    .ret_pc_o(exc_ret_pc),
+    .ret_fast_o(exc_ret_fast),
+    .same_regime_o(exc_same_regime),
+
+    .retire_i(pipeline_retire),
+    .hpm_event_i(pipeline_hpm_event | mmu_hpm_event),
  
     .cur_pc_i(exc_cur_pc),
     .sync_exc_code_i(exc_sync_exc_code),
@@ -565,6 +643,8 @@ module thinpad_top (
     .satp_o(mmu_satp),
     .mtip_set_en_i(mti_occur),
     .mtip_clear_en_i(mti_occur_n),
+    .meip_i(ext_irq),
+    .seip_i(ext_irq_s),
  
     .csr_raddr_i(exc_csr_raddr),
     .csr_rdata_o(exc_csr_rdata),
@@ -575,8 +655,198 @@ module thinpad_top (
     .invalid_w_o(exc_csr_invalid_w)
   );
 
+  // PLIC，中断源 1: UART，2: VGA 场消隐，3: GPIO 事件，4: blitter 完成，5: 总线监视器计数溢出，
+  // 6: PC 采样缓冲区半满，7: 提交轨迹缓冲区半满
+  plic #(
+    .NUM_SOURCES(7),
+    .EDGE_TRIGGERED(7'b0001000)
+  ) u_plic(
+    .clk_i(sys_clk),
+    .rst_i(sys_rst),
+
+    .wb_cyc_i(wbs13_cyc_o),
+    .wb_stb_i(wbs13_stb_o),
+    .wb_ack_o(wbs13_ack_i),
+    .wb_adr_i(wbs13_adr_o),
+    .wb_dat_i(wbs13_dat_o),
+    .wb_dat_o(wbs13_dat_i),
+    .wb_sel_i(wbs13_sel_o),
+    .wb_we_i(wbs13_we_o),
+
+    .irq_i({trace_irq, prof_irq, busmon_irq, blit_done, gpio_irq, vga_irq, uart_irq}),
+    .meip_o(ext_irq),
+    .seip_o(ext_irq_s)
+  );
+
+  // 总线监视器，统计 Wishbone MUX 每个从设备的流量；不需要时可以把 BUS_MONITOR 改为 0 节省资源
+  localparam BUS_MONITOR = 1;
+  if (BUS_MONITOR) begin : g_bus_monitor
+    bus_monitor #(
+      .NUM_SLAVES(17)
+    ) u_bus_monitor(
+      .clk_i(sys_clk),
+      .rst_i(sys_rst),
+
+      .wb_cyc_i(wbs14_cyc_o),
+      .wb_stb_i(wbs14_stb_o),
+      .wb_ack_o(wbs14_ack_i),
+      .wb_adr_i(wbs14_adr_o),
+      .wb_dat_i(wbs14_dat_o),
+      .wb_dat_o(wbs14_dat_i),
+      .wb_sel_i(wbs14_sel_o),
+      .wb_we_i(wbs14_we_o),
+
+      .mon_cyc_i({wbs16_cyc_o,
+                  wbs15_cyc_o, wbs14_cyc_o, wbs13_cyc_o, wbs12_cyc_o,
+                  wbs11_cyc_o, wbs10_cyc_o, wbs9_cyc_o, wbs8_cyc_o,
+                  wbs7_cyc_o, wbs6_cyc_o, wbs5_cyc_o, wbs4_cyc_o,
+                  wbs3_cyc_o, wbs2_cyc_o, wbs1_cyc_o, wbs0_cyc_o}),
+      .mon_stb_i({wbs16_stb_o,
+                  wbs15_stb_o, wbs14_stb_o, wbs13_stb_o, wbs12_stb_o,
+                  wbs11_stb_o, wbs10_stb_o, wbs9_stb_o, wbs8_stb_o,
+                  wbs7_stb_o, wbs6_stb_o, wbs5_stb_o, wbs4_stb_o,
+                  wbs3_stb_o, wbs2_stb_o, wbs1_stb_o, wbs0_stb_o}),
+      .mon_ack_i({wbs16_ack_i,
+                  wbs15_ack_i, wbs14_ack_i, wbs13_ack_i, wbs12_ack_i,
+                  wbs11_ack_i, wbs10_ack_i, wbs9_ack_i, wbs8_ack_i,
+                  wbs7_ack_i, wbs6_ack_i, wbs5_ack_i, wbs4_ack_i,
+                  wbs3_ack_i, wbs2_ack_i, wbs1_ack_i, wbs0_ack_i}),
+      .mon_we_i({wbs16_we_o,
+                 wbs15_we_o, wbs14_we_o, wbs13_we_o, wbs12_we_o,
+                 wbs11_we_o, wbs10_we_o, wbs9_we_o, wbs8_we_o,
+                 wbs7_we_o, wbs6_we_o, wbs5_we_o, wbs4_we_o,
+                 wbs3_we_o, wbs2_we_o, wbs1_we_o, wbs0_we_o}),
+      .mon_sel_i({wbs16_sel_o,
+                  wbs15_sel_o, wbs14_sel_o, wbs13_sel_o, wbs12_sel_o,
+                  wbs11_sel_o, wbs10_sel_o, wbs9_sel_o, wbs8_sel_o,
+                  wbs7_sel_o, wbs6_sel_o, wbs5_sel_o, wbs4_sel_o,
+                  wbs3_sel_o, wbs2_sel_o, wbs1_sel_o, wbs0_sel_o}),
+
+      // CPU 和 blitter 同时请求总线时，其中一个在等待
+      .contention_i(cpu_wbm_cyc_o & blit_wbm_cyc_o),
+
+      .irq_o(busmon_irq)
+    );
+  end else begin : g_no_bus_monitor
+    // 仍然应答总线请求，读出 0
+    always_ff @(posedge sys_clk) begin
+      if (sys_rst)
+        wbs14_ack_i <= 1'b0;
+      else
+        wbs14_ack_i <= wbs14_cyc_o & wbs14_stb_o & ~wbs14_ack_i;
+    end
+    assign wbs14_dat_i = 32'h0;
+    assign busmon_irq = 1'b0;
+  end
+
+  // PC 采样分析器，定期记录 WB 阶段最近提交的指令地址
+  pc_profiler u_pc_profiler(
+    .clk_i(sys_clk),
+    .rst_i(sys_rst),
+
+    .wb_cyc_i(wbs15_cyc_o),
+    .wb_stb_i(wbs15_stb_o),
+    .wb_ack_o(wbs15_ack_i),
+    .wb_adr_i(wbs15_adr_o),
+    .wb_dat_i(wbs15_dat_o),
+    .wb_dat_o(wbs15_dat_i),
+    .wb_sel_i(wbs15_sel_o),
+    .wb_we_i(wbs15_we_o),
+
+    .retire_i(pipeline_retire),
+    .retire_pc_i(pipeline_retire_pc),
+    .privilege_i(exc_privilege),
+    .hpm_event_i(pipeline_hpm_event),
+
+    .irq_o(prof_irq)
+  );
+
+  // 提交轨迹编码器，压缩记录 WB 阶段提交的指令流；不需要时可以把 TRACE_ENCODER 改为 0 节省资源
+  localparam TRACE_ENCODER = 1;
+  if (TRACE_ENCODER) begin : g_trace_encoder
+    trace_encoder u_trace_encoder(
+      .clk_i(sys_clk),
+      .rst_i(sys_rst),
+
+      .wb_cyc_i(wbs16_cyc_o),
+      .wb_stb_i(wbs16_stb_o),
+      .wb_ack_o(wbs16_ack_i),
+      .wb_adr_i(wbs16_adr_o),
+      .wb_dat_i(wbs16_dat_o),
+      .wb_dat_o(wbs16_dat_i),
+      .wb_sel_i(wbs16_sel_o),
+      .wb_we_i(wbs16_we_o),
+
+      .retire_i(pipeline_retire),
+      .retire_pc_i(pipeline_retire_pc),
+      .retire_instr_i(pipeline_retire_instr),
+      .privilege_i(exc_privilege),
+      .xret_i(exc_exc_ret),
+      .xret_pc_i(exc_cur_pc),
+
+      .irq_o(trace_irq)
+    );
+  end else begin : g_no_trace_encoder
+    // 仍然应答总线请求，读出 0
+    always_ff @(posedge sys_clk) begin
+      if (sys_rst)
+        wbs16_ack_i <= 1'b0;
+      else
+        wbs16_ack_i <= wbs16_cyc_o & wbs16_stb_o & ~wbs16_ack_i;
+    end
+    assign wbs16_dat_i = 32'h0;
+    assign trace_irq = 1'b0;
+  end
+
   /* =========== Lab Controller end =========== */
 
+  /* =========== Wishbone Arbiter begin =========== */
+  // CPU 和 blitter 两个主设备轮流占用总线
+  wb_arbiter_2 #(
+      .ARB_TYPE_ROUND_ROBIN(1)
+  ) u_wb_arbiter (
+      .clk(sys_clk),
+      .rst(sys_rst),
+
+      // Master interface 0 (MMU)
+      .wbm0_adr_i(cpu_wbm_adr_o),
+      .wbm0_dat_i(cpu_wbm_dat_o),
+      .wbm0_dat_o(cpu_wbm_dat_i),
+      .wbm0_we_i (cpu_wbm_we_o),
+      .wbm0_sel_i(cpu_wbm_sel_o),
+      .wbm0_stb_i(cpu_wbm_stb_o),
+      .wbm0_ack_o(cpu_wbm_ack_i),
+      .wbm0_err_o(),
+      .wbm0_rty_o(),
+      .wbm0_cyc_i(cpu_wbm_cyc_o),
+
+      // Master interface 1 (blitter)
+      .wbm1_adr_i(blit_wbm_adr_o),
+      .wbm1_dat_i(blit_wbm_dat_o),
+      .wbm1_dat_o(blit_wbm_dat_i),
+      .wbm1_we_i (blit_wbm_we_o),
+      .wbm1_sel_i(blit_wbm_sel_o),
+      .wbm1_stb_i(blit_wbm_stb_o),
+      .wbm1_ack_o(blit_wbm_ack_i),
+      .wbm1_err_o(),
+      .wbm1_rty_o(),
+      .wbm1_cyc_i(blit_wbm_cyc_o),
+
+      // Slave interface (to Wishbone MUX)
+      .wbs_adr_o(wbm_adr_o),
+      .wbs_dat_i(wbm_dat_i),
+      .wbs_dat_o(wbm_dat_o),
+      .wbs_we_o (wbm_we_o),
+      .wbs_sel_o(wbm_sel_o),
+      .wbs_stb_o(wbm_stb_o),
+      .wbs_ack_i(wbm_ack_i),
+      .wbs_err_i('0),
+      .wbs_rty_i('0),
+      .wbs_cyc_o(wbm_cyc_o)
+  );
+
+  /* =========== Wishbone Arbiter end =========== */
+
   /* =========== Wishbone MUX begin =========== */
   // Wishbone MUX (Masters) => bus slaves
 
@@ -670,7 +940,87 @@ module thinpad_top (
   logic [3:0] wbs8_sel_o;
   logic wbs8_we_o;
 
-  wb_mux_9 wb_mux (
+  // for blitter
+  logic wbs9_cyc_o;
+  logic wbs9_stb_o;
+  logic wbs9_ack_i;
+  logic [31:0] wbs9_adr_o;
+  logic [31:0] wbs9_dat_o;
+  logic [31:0] wbs9_dat_i;
+  logic [3:0] wbs9_sel_o;
+  logic wbs9_we_o;
+
+  // for sprite planes
+  logic wbs10_cyc_o;
+  logic wbs10_stb_o;
+  logic wbs10_ack_i;
+  logic [31:0] wbs10_adr_o;
+  logic [31:0] wbs10_dat_o;
+  logic [31:0] wbs10_dat_i;
+  logic [3:0] wbs10_sel_o;
+  logic wbs10_we_o;
+
+  // for tile engine
+  logic wbs11_cyc_o;
+  logic wbs11_stb_o;
+  logic wbs11_ack_i;
+  logic [31:0] wbs11_adr_o;
+  logic [31:0] wbs11_dat_o;
+  logic [31:0] wbs11_dat_i;
+  logic [3:0] wbs11_sel_o;
+  logic wbs11_we_o;
+
+  // for boot ROM
+  logic wbs12_cyc_o;
+  logic wbs12_stb_o;
+  logic wbs12_ack_i;
+  logic [31:0] wbs12_adr_o;
+  logic [31:0] wbs12_dat_o;
+  logic [31:0] wbs12_dat_i;
+  logic [3:0] wbs12_sel_o;
+  logic wbs12_we_o;
+
+  // for PLIC
+  logic wbs13_cyc_o;
+  logic wbs13_stb_o;
+  logic wbs13_ack_i;
+  logic [31:0] wbs13_adr_o;
+  logic [31:0] wbs13_dat_o;
+  logic [31:0] wbs13_dat_i;
+  logic [3:0] wbs13_sel_o;
+  logic wbs13_we_o;
+
+  // for bus monitor
+  logic wbs14_cyc_o;
+  logic wbs14_stb_o;
+  logic wbs14_ack_i;
+  logic [31:0] wbs14_adr_o;
+  logic [31:0] wbs14_dat_o;
+  logic [31:0] wbs14_dat_i;
+  logic [3:0] wbs14_sel_o;
+  logic wbs14_we_o;
+
+  // for pc profiler
+  logic wbs15_cyc_o;
+  logic wbs15_stb_o;
+  logic wbs15_ack_i;
+  logic [31:0] wbs15_adr_o;
+  logic [31:0] wbs15_dat_o;
+  logic [31:0] wbs15_dat_i;
+  logic [3:0] wbs15_sel_o;
+  logic wbs15_we_o;
+
+  // for trace encoder
+  logic wbs16_cyc_o;
+  logic wbs16_stb_o;
+  logic wbs16_ack_i;
+  logic [31:0] wbs16_adr_o;
+  logic [31:0] wbs16_dat_o;
+  logic [31:0] wbs16_dat_i;
+  logic [3:0] wbs16_sel_o;
+  logic wbs16_we_o;
+
+  wb_mux_17 wb_mux (
       .clk(sys_clk),
       .rst(sys_rst),
 
@@ -827,7 +1177,135 @@ module thinpad_top (
       .wbs8_ack_i(wbs8_ack_i),
       .wbs8_err_i('0),
       .wbs8_rty_i('0),
-      .wbs8_cyc_o(wbs8_cyc_o)
+      .wbs8_cyc_o(wbs8_cyc_o),
+
+      // Slave interface 9 (to blitter register)
+      // Address range: 0x8700_0000 ~ 0x87FF_FFFF
+      .wbs9_addr    (32'h8700_0000),
+      .wbs9_addr_msk(32'hFF00_0000),
+
+      .wbs9_adr_o(wbs9_adr_o),
+      .wbs9_dat_i(wbs9_dat_i),
+      .wbs9_dat_o(wbs9_dat_o),
+      .wbs9_we_o (wbs9_we_o),
+      .wbs9_sel_o(wbs9_sel_o),
+      .wbs9_stb_o(wbs9_stb_o),
+      .wbs9_ack_i(wbs9_ack_i),
+      .wbs9_err_i('0),
+      .wbs9_rty_i('0),
+      .wbs9_cyc_o(wbs9_cyc_o),
+
+      // Slave interface 10 (to sprite planes)
+      // Address range: 0x8800_0000 ~ 0x88FF_FFFF
+      .wbs10_addr    (32'h8800_0000),
+      .wbs10_addr_msk(32'hFF00_0000),
+
+      .wbs10_adr_o(wbs10_adr_o),
+      .wbs10_dat_i(wbs10_dat_i),
+      .wbs10_dat_o(wbs10_dat_o),
+      .wbs10_we_o (wbs10_we_o),
+      .wbs10_sel_o(wbs10_sel_o),
+      .wbs10_stb_o(wbs10_stb_o),
+      .wbs10_ack_i(wbs10_ack_i),
+      .wbs10_err_i('0),
+      .wbs10_rty_i('0),
+      .wbs10_cyc_o(wbs10_cyc_o),
+
+      // Slave interface 11 (to tile engine)
+      // Address range: 0x8900_0000 ~ 0x89FF_FFFF
+      .wbs11_addr    (32'h8900_0000),
+      .wbs11_addr_msk(32'hFF00_0000),
+
+      .wbs11_adr_o(wbs11_adr_o),
+      .wbs11_dat_i(wbs11_dat_i),
+      .wbs11_dat_o(wbs11_dat_o),
+      .wbs11_we_o (wbs11_we_o),
+      .wbs11_sel_o(wbs11_sel_o),
+      .wbs11_stb_o(wbs11_stb_o),
+      .wbs11_ack_i(wbs11_ack_i),
+      .wbs11_err_i('0),
+      .wbs11_rty_i('0),
+      .wbs11_cyc_o(wbs11_cyc_o),
+
+      // Slave interface 12 (to boot ROM)
+      // Address range: 0x8200_0000 ~ 0x82FF_FFFF
+      .wbs12_addr    (32'h8200_0000),
+      .wbs12_addr_msk(32'hFF00_0000),
+
+      .wbs12_adr_o(wbs12_adr_o),
+      .wbs12_dat_i(wbs12_dat_i),
+      .wbs12_dat_o(wbs12_dat_o),
+      .wbs12_we_o (wbs12_we_o),
+      .wbs12_sel_o(wbs12_sel_o),
+      .wbs12_stb_o(wbs12_stb_o),
+      .wbs12_ack_i(wbs12_ack_i),
+      .wbs12_err_i('0),
+      .wbs12_rty_i('0),
+      .wbs12_cyc_o(wbs12_cyc_o),
+
+      // Slave interface 13 (to PLIC)
+      // Address range: 0x0C00_0000 ~ 0x0FFF_FFFF
+      .wbs13_addr    (32'h0C00_0000),
+      .wbs13_addr_msk(32'hFC00_0000),
+
+      .wbs13_adr_o(wbs13_adr_o),
+      .wbs13_dat_i(wbs13_dat_i),
+      .wbs13_dat_o(wbs13_dat_o),
+      .wbs13_we_o (wbs13_we_o),
+      .wbs13_sel_o(wbs13_sel_o),
+      .wbs13_stb_o(wbs13_stb_o),
+      .wbs13_ack_i(wbs13_ack_i),
+      .wbs13_err_i('0),
+      .wbs13_rty_i('0),
+      .wbs13_cyc_o(wbs13_cyc_o),
+
+      // Slave interface 14 (to bus monitor)
+      // Address range: 0x8A00_0000 ~ 0x8AFF_FFFF
+      .wbs14_addr    (32'h8A00_0000),
+      .wbs14_addr_msk(32'hFF00_0000),
+
+      .wbs14_adr_o(wbs14_adr_o),
+      .wbs14_dat_i(wbs14_dat_i),
+      .wbs14_dat_o(wbs14_dat_o),
+      .wbs14_we_o (wbs14_we_o),
+      .wbs14_sel_o(wbs14_sel_o),
+      .wbs14_stb_o(wbs14_stb_o),
+      .wbs14_ack_i(wbs14_ack_i),
+      .wbs14_err_i('0),
+      .wbs14_rty_i('0),
+      .wbs14_cyc_o(wbs14_cyc_o),
+
+      // Slave interface 15 (to pc profiler)
+      // Address range: 0x8B00_0000 ~ 0x8BFF_FFFF
+      .wbs15_addr    (32'h8B00_0000),
+      .wbs15_addr_msk(32'hFF00_0000),
+
+      .wbs15_adr_o(wbs15_adr_o),
+      .wbs15_dat_i(wbs15_dat_i),
+      .wbs15_dat_o(wbs15_dat_o),
+      .wbs15_we_o (wbs15_we_o),
+      .wbs15_sel_o(wbs15_sel_o),
+      .wbs15_stb_o(wbs15_stb_o),
+      .wbs15_ack_i(wbs15_ack_i),
+      .wbs15_err_i('0),
+      .wbs15_rty_i('0),
+      .wbs15_cyc_o(wbs15_cyc_o),
+
+      // Slave interface 16 (to trace encoder)
+      // Address range: 0x8C00_0000 ~ 0x8CFF_FFFF
+      .wbs16_addr    (32'h8C00_0000),
+      .wbs16_addr_msk(32'hFF00_0000),
+
+      .wbs16_adr_o(wbs16_adr_o),
+      .wbs16_dat_i(wbs16_dat_i),
+      .wbs16_dat_o(wbs16_dat_o),
+      .wbs16_we_o (wbs16_we_o),
+      .wbs16_sel_o(wbs16_sel_o),
+      .wbs16_stb_o(wbs16_stb_o),
+      .wbs16_ack_i(wbs16_ack_i),
+      .wbs16_err_i('0),
+      .wbs16_rty_i('0),
+      .wbs16_cyc_o(wbs16_cyc_o)
   );
 
   /* =========== Wishbone MUX end =========== */
@@ -850,6 +1328,13 @@ module thinpad_top (
       .wb_sel_i(wbs0_sel_o),
       .wb_we_i (wbs0_we_o),
 
+      // BaseRAM 不做帧缓冲，突发口不使用
+      .burst_req_i (1'b0),
+      .burst_addr_i(20'b0),
+      .burst_valid_o(),
+      .burst_data_o(),
+      .burst_done_o(),
+
       // To SRAM chip
       .sram_addr(base_ram_addr),
       .sram_data(base_ram_data),
@@ -859,9 +1344,17 @@ module thinpad_top (
       .sram_be_n(base_ram_be_n)
   );
 
+  // ExtRAM 帧缓冲突发读口
+  logic fb_burst_req;
+  logic [19:0] fb_burst_addr;
+  logic fb_burst_valid;
+  logic [31:0] fb_burst_data;
+  logic fb_burst_done;
+
   sram_controller #(
       .SRAM_ADDR_WIDTH(20),
-      .SRAM_DATA_WIDTH(32)
+      .SRAM_DATA_WIDTH(32),
+      .BURST_LEN(16)
   ) sram_controller_ext (
       .clk_i(sys_clk),
       .rst_i(sys_rst),
@@ -876,6 +1369,13 @@ module thinpad_top (
       .wb_sel_i(wbs1_sel_o),
       .wb_we_i (wbs1_we_o),
 
+      // Line prefetch (to vga_scanout)
+      .burst_req_i  (fb_burst_req),
+      .burst_addr_i (fb_burst_addr),
+      .burst_valid_o(fb_burst_valid),
+      .burst_data_o (fb_burst_data),
+      .burst_done_o (fb_burst_done),
+
       // To SRAM chip
       .sram_addr(ext_ram_addr),
       .sram_data(ext_ram_data),
@@ -905,7 +1405,9 @@ module thinpad_top (
 
       // to UART pins
       .uart_txd_o(txd),
-      .uart_rxd_i(rxd)
+      .uart_rxd_i(rxd),
+
+      .irq_o(uart_irq)
   );
 
   // Memory-mapped CSRs
@@ -924,23 +1426,24 @@ module thinpad_top (
 
     // machine timer interrupt signals to the CPU
     .mti_occur_o(mti_occur),
-    .mti_occur_n_o(mti_occur_n)
+    .mti_occur_n_o(mti_occur_n),
+
+    // mtime for GPIO event timestamps
+    .mtime_o(mtime)
   );
 
   // blockram_0 控制信号
-  logic [7:0] bram_0_rdata;
-  logic [7:0] bram_0_wdata;
-  logic [16:0] bram_0_raddr;
-  logic [16:0] bram_0_waddr;
-  logic bram_0_wea;
+  logic [31:0] bram_0_wdata;
+  logic [14:0] bram_0_raddr;
+  logic [14:0] bram_0_waddr;
+  logic [3:0] bram_0_wea;
   logic bram_0_ena;
 
   // blockram_1 控制信号
-  logic [7:0] bram_1_rdata;
-  logic [7:0] bram_1_wdata;
-  logic [16:0] bram_1_raddr;
-  logic [16:0] bram_1_waddr;
-  logic bram_1_wea;
+  logic [31:0] bram_1_wdata;
+  logic [14:0] bram_1_raddr;
+  logic [14:0] bram_1_waddr;
+  logic [3:0] bram_1_wea;
   logic bram_1_ena;
 
 
@@ -949,8 +1452,8 @@ module thinpad_top (
       .WISHBONE_DATA_WIDTH(32),
       .WISHBONE_ADDR_WIDTH(32),
 
-      .BRAM_DATA_WIDTH(8),
-      .BRAM_ADDR_WIDTH(17)
+      .BRAM_DATA_WIDTH(32),
+      .BRAM_ADDR_WIDTH(15)
   ) bram_controller_0 (
       .clk_i(sys_clk),
       .rst_i(sys_rst),
@@ -966,7 +1469,6 @@ module thinpad_top (
       .wb_we_i (wbs3_we_o),
 
       // To BRAM chip
-      .bram_data_i(bram_0_rdata),
       .bram_data_o(bram_0_wdata),
       .bram_addr_a_o(bram_0_waddr),
       .bram_addr_b_o(bram_0_raddr),
@@ -978,8 +1480,8 @@ module thinpad_top (
       .WISHBONE_DATA_WIDTH(32),
       .WISHBONE_ADDR_WIDTH(32),
 
-      .BRAM_DATA_WIDTH(8),
-      .BRAM_ADDR_WIDTH(17)
+      .BRAM_DATA_WIDTH(32),
+      .BRAM_ADDR_WIDTH(15)
   ) bram_controller_1 (
       .clk_i(sys_clk),
       .rst_i(sys_rst),
@@ -995,7 +1497,6 @@ module thinpad_top (
       .wb_we_i (wbs5_we_o),
 
       // To BRAM chip
-      .bram_data_i(bram_1_rdata),
       .bram_data_o(bram_1_wdata),
       .bram_addr_a_o(bram_1_waddr),
       .bram_addr_b_o(bram_1_raddr),
@@ -1005,15 +1506,26 @@ module thinpad_top (
   // flash 控制信号
   assign flash_vpen = 1'b1;
   assign flash_we_n = 1'b1;
-  assign flash_byte_n = 1'b0;
+  assign flash_byte_n = 1'b1;  // 16bit 模式
   
-  flash_controller #(
+  // flash 读 cache 与 flash_controller 之间的总线
+  logic flash_wb_cyc;
+  logic flash_wb_stb;
+  logic flash_wb_ack;
+  logic [31:0] flash_wb_adr;
+  logic [31:0] flash_wb_dat_o;
+  logic [31:0] flash_wb_dat_i;
+  logic [3:0] flash_wb_sel;
+  logic flash_wb_we;
+
+  flash_cache #(
       .WISHBONE_DATA_WIDTH(32),
       .WISHBONE_ADDR_WIDTH(32),
 
-      .FLASH_DATA_WIDTH(8),
-      .FLASH_ADDR_WIDTH(23)
-  ) flash_controller (
+      .FLASH_ADDR_WIDTH(23),
+      .LINE_WORDS_LOG2(2),
+      .SETS_LOG2(6)
+  ) flash_cache (
       .clk_i(sys_clk),
       .rst_i(sys_rst),
 
@@ -1027,6 +1539,39 @@ module thinpad_top (
       .wb_sel_i(wbs4_sel_o),
       .wb_we_i (wbs4_we_o),
 
+      // Wishbone master (to flash controller)
+      .wbm_cyc_o(flash_wb_cyc),
+      .wbm_stb_o(flash_wb_stb),
+      .wbm_ack_i(flash_wb_ack),
+      .wbm_adr_o(flash_wb_adr),
+      .wbm_dat_o(flash_wb_dat_o),
+      .wbm_dat_i(flash_wb_dat_i),
+      .wbm_sel_o(flash_wb_sel),
+      .wbm_we_o (flash_wb_we)
+  );
+
+  flash_controller #(
+      .WISHBONE_DATA_WIDTH(32),
+      .WISHBONE_ADDR_WIDTH(32),
+
+      .FLASH_DATA_WIDTH(16),
+      .FLASH_ADDR_WIDTH(23),
+
+      .CLK_FREQ(20_000_000)
+  ) flash_controller (
+      .clk_i(sys_clk),
+      .rst_i(sys_rst),
+
+      // Wishbone slave (to flash cache)
+      .wb_cyc_i(flash_wb_cyc),
+      .wb_stb_i(flash_wb_stb),
+      .wb_ack_o(flash_wb_ack),
+      .wb_adr_i(flash_wb_adr),
+      .wb_dat_i(flash_wb_dat_o),
+      .wb_dat_o(flash_wb_dat_i),
+      .wb_sel_i(flash_wb_sel),
+      .wb_we_i (flash_wb_we),
+
       // To flash chip
       .flash_a_o(flash_a),
       .flash_d(flash_d),
@@ -1035,6 +1580,28 @@ module thinpad_top (
       .flash_oe_o(flash_oe_n)
   );
 
+  // 复位向量处的 boot ROM
+  boot_rom #(
+      .WISHBONE_DATA_WIDTH(32),
+      .WISHBONE_ADDR_WIDTH(32),
+
+      .ROM_ADDR_WIDTH(8),
+      .INIT_FILE("bootrom.mem")
+  ) boot_rom (
+      .clk_i(sys_clk),
+      .rst_i(sys_rst),
+
+      // Wishbone slave (to MUX)
+      .wb_cyc_i(wbs12_cyc_o),
+      .wb_stb_i(wbs12_stb_o),
+      .wb_ack_o(wbs12_ack_i),
+      .wb_adr_i(wbs12_adr_o),
+      .wb_dat_i(wbs12_dat_o),
+      .wb_dat_o(wbs12_dat_i),
+      .wb_sel_i(wbs12_sel_o),
+      .wb_we_i (wbs12_we_o)
+  );
+
   // GPIO 控制信号
   gpio_controller #(
       .WISHBONE_DATA_WIDTH(32),
@@ -1056,10 +1623,48 @@ module thinpad_top (
       // To GPIO chip
       .dip_sw(dip_sw),
       .touch_btn(touch_btn),
-      .push_btn(push_btn)
+      .push_btn(push_btn),
+
+      .mtime_i(mtime[31:0]),
+      .irq_o(gpio_irq)
   );
 
 
+  // blitter 控制信号
+  logic blit_back_sele;
+
+  // blitter 模块，既是寄存器从设备，也是搬运像素的主设备
+  blitter #(
+      .WISHBONE_DATA_WIDTH(32),
+      .WISHBONE_ADDR_WIDTH(32)
+  ) u_blitter (
+      .clk_i(sys_clk),
+      .rst_i(sys_rst),
+
+      // Wishbone slave (to MUX)
+      .wb_cyc_i(wbs9_cyc_o),
+      .wb_stb_i(wbs9_stb_o),
+      .wb_ack_o(wbs9_ack_i),
+      .wb_adr_i(wbs9_adr_o),
+      .wb_dat_i(wbs9_dat_o),
+      .wb_dat_o(wbs9_dat_i),
+      .wb_sel_i(wbs9_sel_o),
+      .wb_we_i (wbs9_we_o),
+
+      // Wishbone master (to arbiter)
+      .wbm_cyc_o(blit_wbm_cyc_o),
+      .wbm_stb_o(blit_wbm_stb_o),
+      .wbm_ack_i(blit_wbm_ack_i),
+      .wbm_adr_o(blit_wbm_adr_o),
+      .wbm_dat_o(blit_wbm_dat_o),
+      .wbm_dat_i(blit_wbm_dat_i),
+      .wbm_sel_o(blit_wbm_sel_o),
+      .wbm_we_o (blit_wbm_we_o),
+
+      .back_sele(blit_back_sele),
+      .done_o(blit_done)
+  );
+
   /* =========== Wishbone Slaves end =========== */
 
   /* =========== VGA begin =========== */
@@ -1077,9 +1682,6 @@ module thinpad_top (
   // block ram 信号，目前的数据宽度�? 8bit，地�?宽度�? 19bit
   logic bram_ena_i = 1'b1;
   logic bram_enb_i  = 1'b1;
-  logic bram_wea_i = 4'b0000;
-  logic [16:0] bram_addra_i = 19'b0;
-  logic [7:0] bram_data_i = 32'b0;
   logic [16:0] bram_addrb_i;
 
   // 不同 block ram 的数据读取
@@ -1087,6 +1689,11 @@ module thinpad_top (
   logic [7:0] bram_1_data_o;
   logic [7:0] real_bram_data;
 
+  // ExtRAM 帧缓冲
+  logic [7:0] scan_pixel;
+  logic fb_enable;
+  logic [19:0] fb_base;
+
 
 
   assign video_red   = pixel[7:5];  // 红色
@@ -1125,13 +1732,120 @@ module thinpad_top (
       // vga interface
       .vga_scale(vga_scale),
       .vga_end(vga_end),
+      .irq_o(vga_irq),
 
       // bram read interface
       .bram_0_data(bram_0_data_o),
       .bram_1_data(bram_1_data_o),
-      .real_bram_data(real_bram_data)
+      .scan_pixel(scan_pixel),
+      .real_bram_data(real_bram_data),
+      .fb_enable(fb_enable),
+      .fb_base(fb_base),
+      .back_sele(blit_back_sele)
   );
 
+  // ExtRAM 帧缓冲扫描输出
+  vga_scanout #(
+      .WIDTH(12),
+      .HSIZE(800),
+      .VSIZE(600),
+      .VMAX(666),
+
+      .SRAM_ADDR_WIDTH(20),
+      .BURST_LEN(16)
+  ) vga_scanout (
+      .clk_i(sys_clk),
+      .rst_i(sys_rst),
+
+      .fb_enable(fb_enable),
+      .fb_base  (fb_base),
+
+      .burst_req_o  (fb_burst_req),
+      .burst_addr_o (fb_burst_addr),
+      .burst_valid_i(fb_burst_valid),
+      .burst_data_i (fb_burst_data),
+      .burst_done_i (fb_burst_done),
+
+      .vga_clk   (clk_50M),
+      .hdata     (hdata),
+      .vdata     (vdata),
+      .scan_pixel(scan_pixel)
+  );
+
+
+  // 硬件精灵平面
+  logic [7:0] sprite_pixel;
+  logic sprite_hit;
+
+  vga_sprite #(
+      .WISHBONE_DATA_WIDTH(32),
+      .WISHBONE_ADDR_WIDTH(32),
+
+      .WIDTH(12),
+      .HSIZE(800),
+      .VSIZE(600),
+
+      .SPRITE_NUM(4),
+      .SPRITE_RAM_ADDR_WIDTH(13)
+  ) vga_sprite (
+      .clk_i(sys_clk),
+      .rst_i(sys_rst),
+
+      // Wishbone slave (to MUX)
+      .wb_cyc_i(wbs10_cyc_o),
+      .wb_stb_i(wbs10_stb_o),
+      .wb_ack_o(wbs10_ack_i),
+      .wb_adr_i(wbs10_adr_o),
+      .wb_dat_i(wbs10_dat_o),
+      .wb_dat_o(wbs10_dat_i),
+      .wb_sel_i(wbs10_sel_o),
+      .wb_we_i (wbs10_we_o),
+
+      // vga interface
+      .vga_clk     (clk_50M),
+      .hdata       (hdata),
+      .vdata       (vdata),
+      .vga_scale   (vga_scale),
+      .vga_end     (vga_end),
+      .sprite_pixel(sprite_pixel),
+      .sprite_hit  (sprite_hit)
+  );
+
+  // 瓦片层，与位图层合成后送给 vga_pic
+  logic [7:0] layer_pixel;
+
+  vga_tile #(
+      .WISHBONE_DATA_WIDTH(32),
+      .WISHBONE_ADDR_WIDTH(32),
+
+      .WIDTH(12),
+      .HSIZE(800),
+      .VSIZE(600),
+      .HMAX(1040),
+      .VMAX(666)
+  ) vga_tile (
+      .clk_i(sys_clk),
+      .rst_i(sys_rst),
+
+      // Wishbone slave (to MUX)
+      .wb_cyc_i(wbs11_cyc_o),
+      .wb_stb_i(wbs11_stb_o),
+      .wb_ack_o(wbs11_ack_i),
+      .wb_adr_i(wbs11_adr_o),
+      .wb_dat_i(wbs11_dat_o),
+      .wb_dat_o(wbs11_dat_i),
+      .wb_sel_i(wbs11_sel_o),
+      .wb_we_i (wbs11_we_o),
+
+      // vga interface
+      .vga_clk     (clk_50M),
+      .hdata       (hdata),
+      .vdata       (vdata),
+      .vga_scale   (vga_scale),
+      .vga_end     (vga_end),
+      .bitmap_pixel(real_bram_data),
+      .layer_pixel (layer_pixel)
+  );
 
   vga_pic #(12, 800, 600, 1040, 666, 17) pic (
       .vga_clk    (clk_50M),
@@ -1141,8 +1855,10 @@ module thinpad_top (
       .pixel      (pixel),
       .r_addr_st  (bram_addr_st),
       .r_addr     (bram_addrb_i),
-      .r_data     (real_bram_data),
-      .vga_end    (vga_end)
+      .r_data     (layer_pixel),
+      .vga_end    (vga_end),
+      .sprite_pixel(sprite_pixel),
+      .sprite_hit (sprite_hit)
   );
 
   pic_bram pic_mem_0 (
@@ -32,8 +32,8 @@ module alu(
     and_result = a & b;
     or_result  = a | b;
     xor_result = a ^ b;
-    slt_result = $signed(a) < $signed(b);
-    sltu_result = a < b;
+    slt_result = {31'b0, $signed(a) < $signed(b)};
+    sltu_result = {31'b0, a < b};
     sbclr_result = a & ~({31'b0, 1'b1} << (b[4:0]));
     min_result = $signed(a) < $signed(b) ? a : b;
     pack_result = {b[15:0], a[15:0]};
@@ -45,10 +45,10 @@ module alu(
     idx[1] = b[15: 8];
     idx[2] = b[23:16];
     idx[3] = b[31:24];
-    xperm8_result[ 7: 0] = idx[0] <= 3 ? ele[idx[0]] : 8'b0;
-    xperm8_result[15: 8] = idx[1] <= 3 ? ele[idx[1]] : 8'b0;
-    xperm8_result[23:16] = idx[2] <= 3 ? ele[idx[2]] : 8'b0;
-    xperm8_result[31:24] = idx[3] <= 3 ? ele[idx[3]] : 8'b0;
+    xperm8_result[ 7: 0] = idx[0] <= 3 ? ele[idx[0][1:0]] : 8'b0;
+    xperm8_result[15: 8] = idx[1] <= 3 ? ele[idx[1][1:0]] : 8'b0;
+    xperm8_result[23:16] = idx[2] <= 3 ? ele[idx[2][1:0]] : 8'b0;
+    xperm8_result[31:24] = idx[3] <= 3 ? ele[idx[3][1:0]] : 8'b0;
   end
 
   assign result = op == ALU_ADD ? add_result
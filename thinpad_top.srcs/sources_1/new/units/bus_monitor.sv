@@ -0,0 +1,198 @@
+`default_nettype none
+`timescale 1ns / 1ps
+
+// Wishbone bus monitor. Snoops the slave side of the Wishbone MUX and keeps
+// per-slave traffic counters, so that software can tell which slave the
+// single shared bus is spending its cycles on.
+//
+// Register map (offsets from the base address):
+//   0x000  CTRL      bit0 enable counting (reset 1)
+//                    bit2 write 1: clear the counters
+//   0x004  STATUS    bit i: a counter of slave i wrapped, write 1 to clear
+//   0x008  IRQ_EN    bit0 raise irq_o while STATUS is non-zero
+//   0x00C  INFO      number of slaves
+//   0x010  CYCLES    cycles counted
+//   0x100 + 0x20*i   counters of slave i:
+//     +0x00  TXN        transactions (acks)
+//     +0x04  RD_BYTES   bytes read, from the byte selects
+//     +0x08  WR_BYTES   bytes written
+//     +0x0C  WAIT       cycles from request to ack, summed over transactions
+//     +0x10  WAIT_MAX   longest single request to ack
+//     +0x14  BACKPRESS  cycles another master waited while this slave was busy
+//
+// Counters wrap around; every wrap sets the STATUS bit of its slave.
+// Reads return the running counters. There is no snapshot copy, to keep
+// the flop count down: clear CTRL.bit0 first to read a consistent set.
+module bus_monitor #(
+  parameter NUM_SLAVES = 15
+) (
+  input wire clk_i,
+  input wire rst_i,
+
+  // Wishbone slave
+  input wire wb_cyc_i,
+  input wire wb_stb_i,
+  output reg wb_ack_o,
+  input wire [31:0] wb_adr_i,
+  input wire [31:0] wb_dat_i,
+  output reg [31:0] wb_dat_o,
+  input wire [ 3:0] wb_sel_i,
+  input wire wb_we_i,
+
+  // Snooped slave interfaces of the Wishbone MUX, bit i is slave i
+  input wire [NUM_SLAVES-1:0] mon_cyc_i,
+  input wire [NUM_SLAVES-1:0] mon_stb_i,
+  input wire [NUM_SLAVES-1:0] mon_ack_i,
+  input wire [NUM_SLAVES-1:0] mon_we_i,
+  input wire [NUM_SLAVES*4-1:0] mon_sel_i,
+
+  // More than one master is requesting the bus
+  input wire contention_i,
+
+  output wire irq_o
+);
+
+localparam NUM_COUNTERS = 6;
+localparam CNT_TXN = 0;
+localparam CNT_RD_BYTES = 1;
+localparam CNT_WR_BYTES = 2;
+localparam CNT_WAIT = 3;
+localparam CNT_WAIT_MAX = 4;
+localparam CNT_BACKPRESS = 5;
+
+// ==== Registers ====
+logic enable_reg;
+logic irq_en_reg;
+logic [NUM_SLAVES-1:0] status_reg;
+
+logic [31:0] cycles;
+logic [31:0] live [0:NUM_SLAVES-1][0:NUM_COUNTERS-1];
+
+// cycles the current request of each slave has waited so far
+logic [31:0] cur_wait [0:NUM_SLAVES-1];
+
+assign irq_o = irq_en_reg & (|status_reg);
+
+// ==== Address decoding ====
+wire [11:0] offset = wb_adr_i[11:0];
+
+wire is_slave = offset >= 12'h100;
+wire [11:0] slave_offset = offset - 12'h100;
+wire [4:0] slave_id = slave_offset[9:5];
+wire [2:0] counter_id = slave_offset[4:2];
+
+// ==== Begin read hardwire ====
+logic [31:0] rdata;
+always_comb begin
+  rdata = 32'b0;
+  if (is_slave) begin
+    if (slave_offset[11:10] == 2'b0 && slave_id < NUM_SLAVES && counter_id < NUM_COUNTERS)
+      rdata = live[slave_id][counter_id];
+  end else begin
+    case (offset[7:0])
+      8'h00: rdata = {31'b0, enable_reg};
+      8'h04: rdata = 32'(status_reg);
+      8'h08: rdata = {31'b0, irq_en_reg};
+      8'h0C: rdata = NUM_SLAVES;
+      8'h10: rdata = cycles;
+      default: rdata = 32'b0;
+    endcase
+  end
+end
+// ===== End read hardwire =====
+
+wire req = wb_cyc_i & wb_stb_i & ~wb_ack_o;
+wire ctrl_we = req & wb_we_i & !is_slave & offset[7:0] == 8'h00;
+wire do_clear = ctrl_we & wb_dat_i[2];
+
+// ==== Begin write/read logic ====
+always_ff @(posedge clk_i) begin
+  if (rst_i) begin
+    wb_ack_o <= 1'b0;
+    enable_reg <= 1'b1;
+    irq_en_reg <= 1'b0;
+  end else begin
+    // every request get ACK-ed in the next cycle
+    wb_ack_o <= req;
+    if (req) begin
+      if (!wb_we_i) begin
+        wb_dat_o <= rdata;
+      end else if (!is_slave) begin
+        case (offset[7:0])
+          8'h00: enable_reg <= wb_dat_i[0];
+          8'h08: irq_en_reg <= wb_dat_i[0];
+          default: ;
+        endcase
+      end
+    end
+  end
+end
+// ===== End write/read logic =====
+
+// ==== Counting ====
+function automatic [2:0] popcount4(input [3:0] sel);
+  popcount4 = 3'(sel[0]) + 3'(sel[1]) + 3'(sel[2]) + 3'(sel[3]);
+endfunction
+
+always_ff @(posedge clk_i) begin
+  if (rst_i) begin
+    cycles <= 0;
+    status_reg <= 0;
+    for (int i = 0; i < NUM_SLAVES; i++) begin
+      cur_wait[i] <= 0;
+      for (int c = 0; c < NUM_COUNTERS; c++)
+        live[i][c] <= 0;
+    end
+  end else begin
+    if (req & wb_we_i & !is_slave & offset[7:0] == 8'h04)
+      status_reg <= status_reg & ~wb_dat_i[NUM_SLAVES-1:0];
+
+    if (do_clear) begin
+      cycles <= 0;
+      for (int i = 0; i < NUM_SLAVES; i++)
+        for (int c = 0; c < NUM_COUNTERS; c++)
+          live[i][c] <= 0;
+    end else if (enable_reg) begin
+      cycles <= cycles + 1;
+      for (int i = 0; i < NUM_SLAVES; i++) begin
+        if (mon_cyc_i[i] && mon_stb_i[i]) begin
+          // the ack cycle is counted as part of the wait
+          live[i][CNT_WAIT] <= live[i][CNT_WAIT] + 1;
+          if (live[i][CNT_WAIT] == 32'hFFFF_FFFF) status_reg[i] <= 1'b1;
+
+          if (contention_i) begin
+            live[i][CNT_BACKPRESS] <= live[i][CNT_BACKPRESS] + 1;
+            if (live[i][CNT_BACKPRESS] == 32'hFFFF_FFFF) status_reg[i] <= 1'b1;
+          end
+
+          if (mon_ack_i[i]) begin
+            live[i][CNT_TXN] <= live[i][CNT_TXN] + 1;
+            if (live[i][CNT_TXN] == 32'hFFFF_FFFF) status_reg[i] <= 1'b1;
+
+            if (cur_wait[i] + 1 > live[i][CNT_WAIT_MAX])
+              live[i][CNT_WAIT_MAX] <= cur_wait[i] + 1;
+
+            if (mon_we_i[i]) begin
+              live[i][CNT_WR_BYTES] <= live[i][CNT_WR_BYTES] + 32'(popcount4(mon_sel_i[i*4 +: 4]));
+              if (live[i][CNT_WR_BYTES] > 32'hFFFF_FFFF - 32'(popcount4(mon_sel_i[i*4 +: 4])))
+                status_reg[i] <= 1'b1;
+            end else begin
+              live[i][CNT_RD_BYTES] <= live[i][CNT_RD_BYTES] + 32'(popcount4(mon_sel_i[i*4 +: 4]));
+              if (live[i][CNT_RD_BYTES] > 32'hFFFF_FFFF - 32'(popcount4(mon_sel_i[i*4 +: 4])))
+                status_reg[i] <= 1'b1;
+            end
+          end
+        end
+      end
+    end
+
+    for (int i = 0; i < NUM_SLAVES; i++) begin
+      if (!(mon_cyc_i[i] && mon_stb_i[i]) || mon_ack_i[i])
+        cur_wait[i] <= 0;
+      else
+        cur_wait[i] <= cur_wait[i] + 1;
+    end
+  end
+end
+
+endmodule
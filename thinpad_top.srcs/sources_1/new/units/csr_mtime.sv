@@ -19,7 +19,10 @@ module csr_mtime(
 
   // machine timer interrupt signals to the CPU
   output wire mti_occur_o,
-  output wire mti_occur_n_o
+  output wire mti_occur_n_o,
+
+  // current mtime, for peripherals that timestamp events
+  output wire [63:0] mtime_o
 );
 
 csr_mtime_t mtime_reg;
@@ -27,10 +30,11 @@ csr_mtimecmp_t mtimecmp_reg;
 
 assign mti_occur_o = (mtime_reg >= mtimecmp_reg);
 assign mti_occur_n_o = ~mti_occur_o;
+assign mtime_o = mtime_reg;
 
 // ==== Begin read hardwire ====
 always_comb begin
-  wb_dat_o = 64'b0;
+  wb_dat_o = 32'b0;
   case (wb_adr_i)
     `CSR_MTIME_MEM_ADDR: begin
       wb_dat_o = mtime_reg[31:0];
@@ -44,6 +48,7 @@ always_comb begin
     `CSR_MTIMECMP_MEM_ADDR+4: begin
       wb_dat_o = mtimecmp_reg[63:32];
     end
+    default: ;
   endcase
 end
 // ===== End read hardwire =====
@@ -102,6 +107,8 @@ always_ff @(posedge clk_i) begin
         state <= STATE_IDLE;
         mtime_reg <= mtime_reg + 64'b1;
       end
+
+      default: ;
     endcase
   end
 end
@@ -24,6 +24,20 @@ module exc_unit(
   output wire  [31:0] satp_o,
   input wire          mtip_set_en_i,
   input wire          mtip_clear_en_i,
+  input wire          meip_i,
+  input wire          seip_i,
+  output wire         wfi_wake_o,
+
+  // Early redirect hints for the pipeline controller
+  output logic [31:0] irq_pc_o,         // handler of the pending interrupt
+  output logic        irq_fast_o,       // handler can be fetched before the trap commits
+  output logic [31:0] ret_pc_o,         // target of an xRET at the current privilege
+  output logic        ret_fast_o,       // target can be fetched before the xRET commits
+  output logic        same_regime_o,    // committing trap/xRET keeps the fetch translation
+
+  // Performance counter events
+  input wire          retire_i,
+  input wire   [`HPM_EVENT_WIDTH-1:0] hpm_event_i,
  
   input wire   [11:0] csr_raddr_i,
   output reg   [31:0] csr_rdata_o,
@@ -47,6 +61,7 @@ csr_mcause_t   mcause_reg;
 csr_mhartid_t  mhartid_reg;
 csr_medeleg_t  medeleg_reg;
 csr_mideleg_t  mideleg_reg;
+csr_menvcfg_t  menvcfg_reg;
 
 // S-mode CSRs
 csr_sstatus_t  sstatus_reg;
@@ -58,9 +73,23 @@ csr_sscratch_t sscratch_reg;
 csr_sie_t      sie_reg;
 csr_sip_t      sip_reg;
 csr_satp_t     satp_reg;
+csr_stimecmp_t stimecmp_reg;
 
 csr_time_t     time_reg;
 
+// Counters
+logic [63:0]   mcycle_reg;
+logic [63:0]   minstret_reg;
+logic [63:0]   mhpmcounter_reg [`HPM_COUNTER_FIRST:`HPM_COUNTER_LAST];
+logic [ 4:0]   mhpmevent_reg [`HPM_COUNTER_FIRST:`HPM_COUNTER_LAST];
+logic [31:0]   mcountinhibit_reg;
+logic [31:0]   mcounteren_reg;
+logic [31:0]   scounteren_reg;
+
+// Custom CSRs
+logic [31:0]   irq_wait_cnt;
+logic [31:0]   irq_lat_max;    // mirqlat
+
 // The sstatus, sie and sip are considered hard-wired subset of
 // mstatus, mie and mip, respectively
 always_comb begin
@@ -105,16 +134,54 @@ assign r_privilege = csr_raddr_i[9:8];
 assign w_access = csr_waddr_i[11:10];
 assign w_privilege = csr_waddr_i[9:8];
 
+// stimecmp is only accessible below M-mode when menvcfg.STCE is set
+wire r_stimecmp, w_stimecmp;
+assign r_stimecmp = (csr_raddr_i == `CSR_STIMECMP_ADDR) | (csr_raddr_i == `CSR_STIMECMPH_ADDR);
+assign w_stimecmp = (csr_waddr_i == `CSR_STIMECMP_ADDR) | (csr_waddr_i == `CSR_STIMECMPH_ADDR);
+
+// Counters below M-mode are gated by mcounteren, and in U-mode also by scounteren
+wire r_counter, r_mcounter, w_mcounter;
+wire r_mhpmevent, w_mhpmevent;
+assign r_counter = csr_raddr_i[11:8] == `CSR_COUNTER_PAGE && csr_raddr_i[6:5] == 2'b00;
+assign r_mcounter = csr_raddr_i[11:8] == `CSR_MCOUNTER_PAGE && csr_raddr_i[6:5] == 2'b00;
+assign w_mcounter = csr_waddr_i[11:8] == `CSR_MCOUNTER_PAGE && csr_waddr_i[6:5] == 2'b00;
+assign r_mhpmevent = csr_raddr_i[11:5] == `CSR_MHPMEVENT_PAGE;
+assign w_mhpmevent = csr_waddr_i[11:5] == `CSR_MHPMEVENT_PAGE;
+
 // == Privilege and accessbility checking ==
 always_comb begin
-  invalid_r_o = (privilege_i < r_privilege);
-  invalid_w_o = (w_access == 2'b11) | (privilege_i < w_privilege);
+  invalid_r_o = (privilege_i < r_privilege) |
+                (r_stimecmp & privilege_i != `PRIVILEGE_M & ~menvcfg_reg.stce) |
+                (r_counter & privilege_i != `PRIVILEGE_M & ~mcounteren_reg[csr_raddr_i[4:0]]) |
+                (r_counter & privilege_i == `PRIVILEGE_U & ~scounteren_reg[csr_raddr_i[4:0]]);
+  invalid_w_o = (w_access == 2'b11) | (privilege_i < w_privilege) |
+                (w_stimecmp & privilege_i != `PRIVILEGE_M & ~menvcfg_reg.stce);
 end
 
 // ===== Hard-wired read registers =====
 // Expose satp for mem access
 assign satp_o = satp_reg;
 
+// Counter selected by csr_raddr_i[4:0], in either counter range
+logic [63:0] counter_rdata;
+logic [31:0] mhpmevent_rdata;
+always_comb begin
+  counter_rdata = 64'h0;
+  mhpmevent_rdata = 32'h0;
+  case (csr_raddr_i[4:0])
+    5'd0: counter_rdata = mcycle_reg;
+    5'd1: counter_rdata = r_counter ? time_reg : 64'h0;  // there is no mtime CSR
+    5'd2: counter_rdata = minstret_reg;
+    default: ;
+  endcase
+  for (int i = `HPM_COUNTER_FIRST; i <= `HPM_COUNTER_LAST; i++) begin
+    if (csr_raddr_i[4:0] == 5'(i)) begin
+      counter_rdata = mhpmcounter_reg[i];
+      mhpmevent_rdata = 32'(mhpmevent_reg[i]);
+    end
+  end
+end
+
 // ====== Read logic ======
 always_comb begin
   case (csr_raddr_i)
@@ -129,6 +196,12 @@ always_comb begin
     `CSR_MEDELEG_ADDR: csr_rdata_o = medeleg_reg;
     `CSR_MIDELEG_ADDR: csr_rdata_o = mideleg_reg;
     `CSR_MTVAL_ADDR: csr_rdata_o = mtval_reg;
+    `CSR_MIRQLAT_ADDR: csr_rdata_o = irq_lat_max;
+    `CSR_MENVCFG_ADDR: csr_rdata_o = menvcfg_reg[31:0];
+    `CSR_MENVCFGH_ADDR: csr_rdata_o = menvcfg_reg[63:32];
+    `CSR_MCOUNTEREN_ADDR: csr_rdata_o = mcounteren_reg;
+    `CSR_MCOUNTINHIBIT_ADDR: csr_rdata_o = mcountinhibit_reg;
+    `CSR_SCOUNTEREN_ADDR: csr_rdata_o = scounteren_reg;
     `CSR_SSTATUS_ADDR: csr_rdata_o = sstatus_reg;
     `CSR_SEPC_ADDR: csr_rdata_o = sepc_reg;
     `CSR_SCAUSE_ADDR: csr_rdata_o = scause_reg;
@@ -138,9 +211,19 @@ always_comb begin
     `CSR_SIE_ADDR: csr_rdata_o = sie_reg;
     `CSR_SIP_ADDR: csr_rdata_o = sip_reg;
     `CSR_SATP_ADDR: csr_rdata_o = satp_reg;
+    `CSR_STIMECMP_ADDR: csr_rdata_o = stimecmp_reg[31:0];
+    `CSR_STIMECMPH_ADDR: csr_rdata_o = stimecmp_reg[63:32];
     `CSR_TIME_ADDR: csr_rdata_o = time_reg[31:0];
     `CSR_TIMEH_ADDR: csr_rdata_o = time_reg[63:32];
-    default: csr_rdata_o = 32'h0; // FIXME: Do we need to do anything here?
+    default: begin
+      if (r_counter | r_mcounter) begin
+        csr_rdata_o = csr_raddr_i[7] ? counter_rdata[63:32] : counter_rdata[31:0];
+      end else if (r_mhpmevent) begin
+        csr_rdata_o = mhpmevent_rdata;
+      end else begin
+        csr_rdata_o = 32'h0; // FIXME: Do we need to do anything here?
+      end
+    end
   endcase
 end
 
@@ -157,6 +240,10 @@ assign uei_occur = mie_reg.ueie & mip_reg.ueip;
 assign uti_occur = mie_reg.utie & mip_reg.utip;
 assign usi_occur = mie_reg.usie & mip_reg.usip;
 
+// WFI resumes once any interrupt is pending and locally enabled, even if
+// it is globally disabled by mstatus or the current privilege level
+assign wfi_wake_o = |(mip_reg & mie_reg);
+
 wire m_has_interrupt, s_has_interrupt, u_has_interrupt;
 assign m_has_interrupt = mei_occur | mti_occur | msi_occur;
 assign s_has_interrupt = sei_occur | sti_occur | ssi_occur;
@@ -230,9 +317,60 @@ always_comb begin
     // less-privileged mode
     deleg_exc = 1'b0;
   end else if (interrupt_occur) begin
-    deleg_exc = mideleg_reg[exc_code];
+    deleg_exc = mideleg_reg[exc_code[4:0]];
+  end else begin
+    deleg_exc = medeleg_reg[exc_code[4:0]];
+  end
+end
+
+// ===== Early redirect hints =====
+// A target fetched before the trap or xRET commits uses the current
+// privilege for translation, which is only correct if the new privilege
+// translates the same way: paging off, or the privilege does not change.
+always_comb begin
+  if (!deleg_exc) begin
+    irq_pc_o = mtvec_reg.mode == 2'b00 ?
+               {mtvec_reg.base, 2'b00} :
+               {mtvec_reg.base, 2'b00} + {exc_code[29:0], 2'b00};
+    irq_fast_o = satp_reg.mode == 1'b0 || privilege_i == `PRIVILEGE_M;
+  end else begin
+    irq_pc_o = stvec_reg.mode == 2'b00 ?
+               {stvec_reg.base, 2'b00} :
+               {stvec_reg.base, 2'b00} + {exc_code[29:0], 2'b00};
+    irq_fast_o = satp_reg.mode == 1'b0 || privilege_i == `PRIVILEGE_S;
+  end
+
+  if (privilege_i == `PRIVILEGE_M) begin
+    ret_pc_o = mepc_reg;
+    ret_fast_o = satp_reg.mode == 1'b0 || mstatus_reg.mpp == `PRIVILEGE_M;
+  end else begin
+    ret_pc_o = sepc_reg;
+    ret_fast_o = satp_reg.mode == 1'b0 || {1'b0, mstatus_reg.spp} == privilege_i;
+  end
+
+  same_regime_o = satp_reg.mode == 1'b0 || nxt_privilege_o == privilege_i;
+end
+
+// ===== Interrupt latency =====
+// Cycles from an interrupt becoming deliverable to its trap entry; the
+// worst case seen is kept in mirqlat, software writes it to restart.
+always_ff @(posedge clk_i) begin
+  if (rst_i) begin
+    irq_wait_cnt <= 0;
+    irq_lat_max <= 0;
   end else begin
-    deleg_exc = medeleg_reg[exc_code];
+    if (exc_en_i && interrupt_occur) begin
+      irq_wait_cnt <= 0;
+      if (irq_wait_cnt >= irq_lat_max) begin
+        irq_lat_max <= irq_wait_cnt + 1;
+      end
+    end else if (csr_we_i && !invalid_w_o && csr_waddr_i == `CSR_MIRQLAT_ADDR) begin
+      irq_lat_max <= csr_wdata_i;
+    end else if (interrupt_occur) begin
+      irq_wait_cnt <= irq_wait_cnt + 1;
+    end else begin
+      irq_wait_cnt <= 0;
+    end
   end
 end
 
@@ -240,15 +378,17 @@ always_comb begin
   next_pc_o = 0;
   nxt_privilege_o = 0;
   if (exc_en_i) begin
+    // Vectored mode only applies to interrupts, synchronous exceptions
+    // always go to BASE
     if (!deleg_exc) begin
-      next_pc_o = mtvec_reg.mode == 2'b00 ?
+      next_pc_o = mtvec_reg.mode == 2'b00 || !interrupt_occur ?
                   {mtvec_reg.base, 2'b00} : /* direct */
-                  {mtvec_reg.base, 2'b00} + (exc_code << 2); /* vectored */
+                  {mtvec_reg.base, 2'b00} + {exc_code[29:0], 2'b00}; /* vectored */
       nxt_privilege_o = `PRIVILEGE_M;
     end else begin
-      next_pc_o = stvec_reg.mode == 2'b00 ?
+      next_pc_o = stvec_reg.mode == 2'b00 || !interrupt_occur ?
                   {stvec_reg.base, 2'b00} : /* direct */
-                  {stvec_reg.base, 2'b00} + (exc_code << 2); /* vectored */
+                  {stvec_reg.base, 2'b00} + {exc_code[29:0], 2'b00}; /* vectored */
       nxt_privilege_o = `PRIVILEGE_S;
     end
   end else if (exc_ret_i) begin
@@ -256,7 +396,7 @@ always_comb begin
       nxt_privilege_o = mstatus_reg.mpp;
       next_pc_o = mepc_reg;
     end else if (privilege_i == `PRIVILEGE_S) begin
-      nxt_privilege_o = mstatus_reg.spp;
+      nxt_privilege_o = {1'b0, mstatus_reg.spp};
       next_pc_o = sepc_reg;
     end
   end
@@ -270,6 +410,85 @@ always_ff @(posedge clk_i) begin
   end
 end
 
+// ===== Counters =====
+// Events from the pipeline and the MMU, plus the traps seen here
+logic [`HPM_EVENT_WIDTH-1:0] hpm_event;
+always_comb begin
+  hpm_event = hpm_event_i;
+  hpm_event[`HPM_EVENT_NONE] = 1'b0;
+  hpm_event[`HPM_EVENT_EXCEPTION] = exc_en_i & ~interrupt_occur;
+  hpm_event[`HPM_EVENT_INTERRUPT] = exc_en_i & interrupt_occur;
+  hpm_event[`HPM_EVENT_XRET] = exc_ret_i;
+end
+
+wire counter_we;
+assign counter_we = csr_we_i & ~invalid_w_o;
+
+always_ff @(posedge clk_i) begin
+  if (rst_i) begin
+    mcycle_reg <= 0;
+    minstret_reg <= 0;
+    for (int i = `HPM_COUNTER_FIRST; i <= `HPM_COUNTER_LAST; i++) begin
+      mhpmcounter_reg[i] <= 0;
+      mhpmevent_reg[i] <= `HPM_EVENT_NONE;
+    end
+    mcountinhibit_reg <= 0;
+    // S-mode and U-mode could always read time, keep it that way after reset
+    mcounteren_reg <= `HPM_COUNTER_MASK;
+    scounteren_reg <= `HPM_COUNTER_MASK;
+  end else begin
+    if (!mcountinhibit_reg[0]) begin
+      mcycle_reg <= mcycle_reg + 1;
+    end
+    // xRET is flushed from WB as it commits, so count it here
+    if (!mcountinhibit_reg[2] && (retire_i || exc_ret_i)) begin
+      minstret_reg <= minstret_reg + 1;
+    end
+    for (int i = `HPM_COUNTER_FIRST; i <= `HPM_COUNTER_LAST; i++) begin
+      if (!mcountinhibit_reg[i] && hpm_event[mhpmevent_reg[i]]) begin
+        mhpmcounter_reg[i] <= mhpmcounter_reg[i] + 1;
+      end
+    end
+
+    // A write takes priority over the increment in the same cycle
+    if (counter_we) begin
+      case (csr_waddr_i)
+        `CSR_MCOUNTEREN_ADDR: mcounteren_reg <= csr_wdata_i & `HPM_COUNTER_MASK;
+        `CSR_SCOUNTEREN_ADDR: scounteren_reg <= csr_wdata_i & `HPM_COUNTER_MASK;
+        // mcountinhibit bit 1 (time) is hardwired to 0
+        `CSR_MCOUNTINHIBIT_ADDR: mcountinhibit_reg <= csr_wdata_i & `HPM_COUNTER_MASK & ~32'h2;
+        default: begin
+          if (w_mcounter) begin
+            case (csr_waddr_i[4:0])
+              5'd0: begin
+                if (csr_waddr_i[7]) mcycle_reg[63:32] <= csr_wdata_i;
+                else mcycle_reg[31:0] <= csr_wdata_i;
+              end
+              5'd2: begin
+                if (csr_waddr_i[7]) minstret_reg[63:32] <= csr_wdata_i;
+                else minstret_reg[31:0] <= csr_wdata_i;
+              end
+              default: ;
+            endcase
+            for (int i = `HPM_COUNTER_FIRST; i <= `HPM_COUNTER_LAST; i++) begin
+              if (csr_waddr_i[4:0] == 5'(i)) begin
+                if (csr_waddr_i[7]) mhpmcounter_reg[i][63:32] <= csr_wdata_i;
+                else mhpmcounter_reg[i][31:0] <= csr_wdata_i;
+              end
+            end
+          end else if (w_mhpmevent) begin
+            for (int i = `HPM_COUNTER_FIRST; i <= `HPM_COUNTER_LAST; i++) begin
+              if (csr_waddr_i[4:0] == 5'(i)) begin
+                mhpmevent_reg[i] <= csr_wdata_i[4:0];
+              end
+            end
+          end
+        end
+      endcase
+    end
+  end
+end
+
 // ====== Write logic ======
 always_ff @(posedge clk_i) begin
   if (rst_i) begin
@@ -284,6 +503,7 @@ always_ff @(posedge clk_i) begin
     mhartid_reg <= 0;
     medeleg_reg <= 0;
     mideleg_reg <= 0;
+    menvcfg_reg <= 0;
 
     sepc_reg <= 0;
     stvec_reg <= 0;
@@ -292,6 +512,8 @@ always_ff @(posedge clk_i) begin
     stvec_reg <= 0;
     sscratch_reg <= 0;
     satp_reg <= 0;
+    // far in the future, so no S-mode timer interrupt before it is set
+    stimecmp_reg <= 64'hffff_ffff_ffff_ffff;
   end else if (exc_en_i) begin
     if (!deleg_exc) begin
       // Set cause
@@ -311,7 +533,7 @@ always_ff @(posedge clk_i) begin
       scause_reg <= {interrupt_occur, exc_code};
       stval_reg <= mtval_i;
 
-      mstatus_reg.spp <= privilege_i;
+      mstatus_reg.spp <= privilege_i[0];
       mstatus_reg.spie <= mstatus_reg.sie;
       sepc_reg <= {cur_pc_i[31:2], 2'b00};
 
@@ -329,7 +551,7 @@ always_ff @(posedge clk_i) begin
       // sret
       mstatus_reg.sie <= mstatus_reg.spie;
       mstatus_reg.spie <= 1'b1;
-      mstatus_reg.spp <= `PRIVILEGE_U;
+      mstatus_reg.spp <= 1'b0;  // U
     end else begin
       // We do not support uret...
     end
@@ -346,9 +568,10 @@ always_ff @(posedge clk_i) begin
         end
       end
       `CSR_MIP_ADDR: begin
-        // Only MTIP and STIP is implemented. MTIP is read-only to software,
-        // and only privilege level > S can write SxIP
-        if (privilege_i == `PRIVILEGE_M) begin
+        // Only MTIP, MEIP and STIP are implemented. MTIP and MEIP are
+        // read-only to software, and only privilege level > S can write SxIP.
+        // With menvcfg.STCE set, STIP follows stimecmp and is read-only.
+        if (privilege_i == `PRIVILEGE_M && !menvcfg_reg.stce) begin
           mip_reg.stip <= csr_wdata_i[5];
         end
       end
@@ -382,6 +605,12 @@ always_ff @(posedge clk_i) begin
       `CSR_MIDELEG_ADDR: begin
         mideleg_reg <= csr_wdata_i;
       end
+      `CSR_MENVCFG_ADDR: begin
+        // No field is implemented in the low half
+      end
+      `CSR_MENVCFGH_ADDR: begin
+        menvcfg_reg.stce <= csr_wdata_i[31];
+      end
       `CSR_SSTATUS_ADDR: begin
         mstatus_reg.spp <= csr_wdata_i[8];
         mstatus_reg.spie <= csr_wdata_i[5];
@@ -412,12 +641,12 @@ always_ff @(posedge clk_i) begin
       end
       `CSR_SIE_ADDR: begin
         // Map sie write to mie
-        mie_reg.seie = csr_wdata_i[9];
-        mie_reg.ueie = csr_wdata_i[8];
-        mie_reg.stie = csr_wdata_i[5];
-        mie_reg.utie = csr_wdata_i[4];
-        mie_reg.seie = csr_wdata_i[1];
-        mie_reg.ueie = csr_wdata_i[0];
+        mie_reg.seie <= csr_wdata_i[9];
+        mie_reg.ueie <= csr_wdata_i[8];
+        mie_reg.stie <= csr_wdata_i[5];
+        mie_reg.utie <= csr_wdata_i[4];
+        mie_reg.ssie <= csr_wdata_i[1];
+        mie_reg.usie <= csr_wdata_i[0];
       end
       `CSR_SIP_ADDR: begin
         // STIP is read-only through sip
@@ -426,6 +655,12 @@ always_ff @(posedge clk_i) begin
       `CSR_SATP_ADDR: begin
         satp_reg <= csr_wdata_i;
       end
+      `CSR_STIMECMP_ADDR: begin
+        stimecmp_reg[31:0] <= csr_wdata_i;
+      end
+      `CSR_STIMECMPH_ADDR: begin
+        stimecmp_reg[63:32] <= csr_wdata_i;
+      end
       default: ;
     endcase
   end
@@ -433,6 +668,16 @@ always_ff @(posedge clk_i) begin
   else if (mtip_set_en_i | mtip_clear_en_i) begin
     mip_reg.mtip <= mtip_set_en_i;
   end
+
+  // MEIP and SEIP follow the levels of the PLIC context outputs
+  if (!rst_i) begin
+    mip_reg.meip <= meip_i;
+    mip_reg.seip <= seip_i;
+    // Sstc: STIP is raised directly from stimecmp, no M-mode trap needed
+    if (menvcfg_reg.stce) begin
+      mip_reg.stip <= (time_reg >= stimecmp_reg);
+    end
+  end
 end
 
 endmodule
\ No newline at end of file
@@ -287,11 +287,8 @@ module instr_decoder(
                     sys_instr_o = SYS_INSTR_SRET;
                   end
                   5'b0_0101: begin  // wfi
-                    instr_legal_o = 1'b0;
-                    sys_instr_o = SYS_INSTR_NOP;
-                    // TODO: add support for wfi
-                    // instr_legal_o = (rs1 == 5'b0_0000 && rd == 5'b0_0000) ? 1'b1 : 1'b0;
-                    // sys_instr_o = SYS_INSTR_WFI;
+                    instr_legal_o = (rs1 == 5'b0_0000 && rd == 5'b0_0000) ? 1'b1 : 1'b0;
+                    sys_instr_o = SYS_INSTR_WFI;
                   end
                   default: begin
                     instr_legal_o = 1'b0;
@@ -368,16 +365,16 @@ module instr_decoder(
         imm_o = {instr_i[31:12], 12'b0};
       end
       7'b110_1111: begin  // J-type
-        imm_o = $signed({instr_i[31], instr_i[19:12], instr_i[20], instr_i[30:21], 1'b0});
+        imm_o = {{11{instr_i[31]}}, instr_i[31], instr_i[19:12], instr_i[20], instr_i[30:21], 1'b0};
       end
       7'b110_0111, 7'b000_0011, 7'b001_0011: begin  // I-type
-        imm_o = $signed({instr_i[31:20]});
+        imm_o = {{20{instr_i[31]}}, instr_i[31:20]};
       end
       7'b110_0011: begin  // B-type
-        imm_o = $signed({instr_i[31], instr_i[7], instr_i[30:25], instr_i[11:8], 1'b0});
+        imm_o = {{19{instr_i[31]}}, instr_i[31], instr_i[7], instr_i[30:25], instr_i[11:8], 1'b0};
       end
       7'b010_0011: begin  // S-type
-        imm_o = $signed({instr_i[31:25], instr_i[11:7]});
+        imm_o = {{20{instr_i[31]}}, instr_i[31:25], instr_i[11:7]};
       end
       default: begin
         imm_o = 32'b0;
@@ -49,21 +49,30 @@
 `define SEND_WB_REQ \
   wb_cyc_o <= 1'b1; \
   wb_stb_o <= 1'b1; \
-  wb_adr_o <= phy_addr; \
+  wb_adr_o <= phy_addr[31:0]; \
   wb_dat_o <= data_i; \
   wb_sel_o <= sel_i; \
   wb_we_o <= store_en_i;
 
 `define PHY_ADDR_VALID \
-  ((phy_addr >= 32'h1000_0000 && phy_addr <= 32'h1000_FFFF) || \
-  phy_addr == `CSR_MTIMECMP_MEM_ADDR || phy_addr == `CSR_MTIMECMP_MEM_ADDR+4 || \
-  phy_addr == `CSR_MTIME_MEM_ADDR || phy_addr == `CSR_MTIME_MEM_ADDR+4 || \
-  (32'h8000_0000 <= phy_addr && phy_addr <= 32'h807F_FFFF) || \
-  (32'h8100_0000 <= phy_addr && phy_addr <= 32'h81FF_FFFF) || \
-  (32'h8300_0000 <= phy_addr && phy_addr <= 32'h83FF_FFFF) || \
-  (32'h8400_0000 <= phy_addr && phy_addr <= 32'h84FF_FFFF) || \
-  (32'h8500_0000 <= phy_addr && phy_addr <= 32'h85FF_FFFF) || \
-  (32'h8600_0000 <= phy_addr && phy_addr <= 32'h86FF_FFFF))
+  (phy_addr[33:32] == 2'b00 && \
+  ((phy_addr[31:0] >= 32'h1000_0000 && phy_addr[31:0] <= 32'h1000_FFFF) || \
+  (32'h0C00_0000 <= phy_addr[31:0] && phy_addr[31:0] <= 32'h0FFF_FFFF) || \
+  phy_addr[31:0] == `CSR_MTIMECMP_MEM_ADDR || phy_addr[31:0] == `CSR_MTIMECMP_MEM_ADDR+4 || \
+  phy_addr[31:0] == `CSR_MTIME_MEM_ADDR || phy_addr[31:0] == `CSR_MTIME_MEM_ADDR+4 || \
+  (32'h8000_0000 <= phy_addr[31:0] && phy_addr[31:0] <= 32'h807F_FFFF) || \
+  (32'h8100_0000 <= phy_addr[31:0] && phy_addr[31:0] <= 32'h81FF_FFFF) || \
+  (32'h8200_0000 <= phy_addr[31:0] && phy_addr[31:0] <= 32'h82FF_FFFF) || \
+  (32'h8300_0000 <= phy_addr[31:0] && phy_addr[31:0] <= 32'h83FF_FFFF) || \
+  (32'h8400_0000 <= phy_addr[31:0] && phy_addr[31:0] <= 32'h84FF_FFFF) || \
+  (32'h8500_0000 <= phy_addr[31:0] && phy_addr[31:0] <= 32'h85FF_FFFF) || \
+  (32'h8600_0000 <= phy_addr[31:0] && phy_addr[31:0] <= 32'h86FF_FFFF) || \
+  (32'h8700_0000 <= phy_addr[31:0] && phy_addr[31:0] <= 32'h87FF_FFFF) || \
+  (32'h8800_0000 <= phy_addr[31:0] && phy_addr[31:0] <= 32'h88FF_FFFF) || \
+  (32'h8900_0000 <= phy_addr[31:0] && phy_addr[31:0] <= 32'h89FF_FFFF) || \
+  (32'h8A00_0000 <= phy_addr[31:0] && phy_addr[31:0] <= 32'h8AFF_FFFF) || \
+  (32'h8B00_0000 <= phy_addr[31:0] && phy_addr[31:0] <= 32'h8BFF_FFFF) || \
+  (32'h8C00_0000 <= phy_addr[31:0] && phy_addr[31:0] <= 32'h8CFF_FFFF)))
 
 module mmu (
   input wire clk_i,
@@ -102,7 +111,10 @@ module mmu (
   output reg  [31:0] wb_dat_o,
   input  wire [31:0] wb_dat_i,
   output reg  [ 3:0] wb_sel_o,
-  output reg         wb_we_o
+  output reg         wb_we_o,
+
+  // Performance counter events
+  output logic [`HPM_EVENT_WIDTH-1:0] hpm_event_o
 );
   // Virtual address
   typedef struct packed {
@@ -208,8 +220,8 @@ module mmu (
 
   assign a = cur_level == 1'b1 ? {12'b0, satp.ppn} << `PAGE_SIZE_SHIFT
                                : {12'b0, read_pte.ppn_1, read_pte.ppn_0} << `PAGE_SIZE_SHIFT;
-  assign pte_addr = cur_level == 1'b1 ? a + ({12'b0, v_addr.vpn_1} << `PTE_SIZE_SHIFT)
-                                      : a + ({12'b0, v_addr.vpn_0} << `PTE_SIZE_SHIFT);
+  assign pte_addr = cur_level == 1'b1 ? a[31:0] + ({22'b0, v_addr.vpn_1} << `PTE_SIZE_SHIFT)
+                                      : a[31:0] + ({22'b0, v_addr.vpn_0} << `PTE_SIZE_SHIFT);
 
   p_addr_t phy_addr;
 
@@ -217,7 +229,7 @@ module mmu (
     phy_addr = 34'b0;
     if (r_en | w_en) begin
       if (direct) begin
-        phy_addr = v_addr;
+        phy_addr = {2'b0, v_addr};
       end else if (tlb_hit) begin
         phy_addr = {tlb_entry.ppn, v_addr.offset};
       end else begin
@@ -372,9 +384,27 @@ module mmu (
 
           state <= STATE_FETCH_PTE;
         end
+
+        default: ;
       endcase
     end
   end
   // ==== End address translation ====
 
+  // ==== Begin performance events ====
+  // The TLB is filled but not yet used to skip the walk (see the TODO
+  // above), so hits and misses show how many walks it would save.
+  wire translate_start;
+  assign translate_start = state == STATE_FETCH_PTE && !flush_en_i && (r_en | w_en) &&
+                           !direct && cur_level == 1'b1 && !wb_cyc_o;
+
+  always_comb begin
+    hpm_event_o = '0;
+    hpm_event_o[`HPM_EVENT_TLB_HIT] = translate_start & tlb_hit;
+    hpm_event_o[`HPM_EVENT_TLB_MISS] = translate_start & ~tlb_hit;
+    hpm_event_o[`HPM_EVENT_PTE_LOAD] = state == STATE_FETCH_PTE && !flush_en_i && (r_en | w_en) &&
+                                       !direct && wb_ack_i;
+  end
+  // ===== End performance events =====
+
 endmodule
\ No newline at end of file
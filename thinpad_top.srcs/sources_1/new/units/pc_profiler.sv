@@ -0,0 +1,198 @@
+`default_nettype none
+`timescale 1ns / 1ps
+
+`include "../headers/csr.vh"
+
+// Statistical PC-sampling profiler. Every INTERVAL cycles the PC of the
+// last instruction retired from WB is recorded, together with the
+// privilege level and what the pipeline is waiting on at that moment, into
+// a sample buffer in block RAM. Software drains the buffer like a FIFO.
+//
+// Register map (offsets from the base address):
+//   0x00  CTRL      bit0 enable sampling, bit1 write 1: empty the buffer
+//   0x04  INTERVAL  cycles between two samples (at least 1)
+//   0x08  WR_PTR    index of the next sample to be written, read-only
+//   0x0C  RD_PTR    index of the oldest unread sample, software advances it
+//   0x10  STATUS    [15:0] samples in the buffer, bit16 half full
+//   0x14  IRQ_EN    bit0 raise irq_o while the buffer is at least half full
+//   0x18  DROPPED   samples dropped because the buffer was full, write clears
+//   0x1C  DEPTH     buffer size in samples
+//   0x10000 + 8*i   sample i (i = pointer mod DEPTH):
+//     +0 pc
+//     +4 [1:0] privilege, [10:8] stall cause
+//
+// Stall cause: 0 running, 1 waiting for a load/store, 2 waiting for a fetch,
+// 3 wfi, 4 branch flush.
+module pc_profiler #(
+  parameter DEPTH_LOG2 = 10,            // 1024 samples, 8KB
+  parameter DEFAULT_INTERVAL = 10_000
+) (
+  input wire clk_i,
+  input wire rst_i,
+
+  // Wishbone slave
+  input wire wb_cyc_i,
+  input wire wb_stb_i,
+  output reg wb_ack_o,
+  input wire [31:0] wb_adr_i,
+  input wire [31:0] wb_dat_i,
+  output reg [31:0] wb_dat_o,
+  input wire [ 3:0] wb_sel_i,
+  input wire wb_we_i,
+
+  // Pipeline
+  input wire        retire_i,
+  input wire [31:0] retire_pc_i,
+  input wire [ 1:0] privilege_i,
+  input wire [`HPM_EVENT_WIDTH-1:0] hpm_event_i,
+
+  output wire irq_o
+);
+
+localparam DEPTH = 2 ** DEPTH_LOG2;
+
+localparam CAUSE_RUN = 3'd0;
+localparam CAUSE_MEM = 3'd1;
+localparam CAUSE_FETCH = 3'd2;
+localparam CAUSE_WFI = 3'd3;
+localparam CAUSE_FLUSH = 3'd4;
+
+// ==== Registers ====
+logic        enable_reg;
+logic [31:0] interval_reg;
+logic [DEPTH_LOG2:0] wr_ptr;
+logic [DEPTH_LOG2:0] rd_ptr;
+logic        irq_en_reg;
+logic [31:0] dropped_reg;
+
+wire [DEPTH_LOG2:0] count = wr_ptr - rd_ptr;
+wire half_full = count >= DEPTH / 2;
+wire full = count == DEPTH;
+
+assign irq_o = irq_en_reg & half_full;
+
+// ==== Sample buffer ====
+(* ram_style = "block" *)
+logic [31:0] pc_mem [0:DEPTH-1];
+(* ram_style = "block" *)
+logic [31:0] info_mem [0:DEPTH-1];
+
+logic [31:0] last_pc;
+logic [31:0] countdown;
+logic [ 2:0] cause;
+
+always_comb begin
+  if (hpm_event_i[`HPM_EVENT_MEM_BUSY])
+    cause = CAUSE_MEM;
+  else if (hpm_event_i[`HPM_EVENT_IF_BUSY])
+    cause = CAUSE_FETCH;
+  else if (hpm_event_i[`HPM_EVENT_WFI])
+    cause = CAUSE_WFI;
+  else if (hpm_event_i[`HPM_EVENT_BRANCH_FLUSH])
+    cause = CAUSE_FLUSH;
+  else
+    cause = CAUSE_RUN;
+end
+
+wire sample = enable_reg && countdown == 0;
+
+always_ff @(posedge clk_i) begin
+  if (sample && !full) begin
+    pc_mem[wr_ptr[DEPTH_LOG2-1:0]] <= last_pc;
+    info_mem[wr_ptr[DEPTH_LOG2-1:0]] <= {21'b0, cause, 6'b0, privilege_i};
+  end
+end
+
+// ==== Address decoding ====
+wire is_buffer = wb_adr_i[16];
+wire [DEPTH_LOG2-1:0] entry = wb_adr_i[3 +: DEPTH_LOG2];
+
+// ==== Begin read hardwire ====
+logic [31:0] rdata;
+always_comb begin
+  case (wb_adr_i[7:0])
+    8'h00: rdata = {31'b0, enable_reg};
+    8'h04: rdata = interval_reg;
+    8'h08: rdata = 32'(wr_ptr);
+    8'h0C: rdata = 32'(rd_ptr);
+    8'h10: rdata = {15'b0, half_full, 16'(count)};
+    8'h14: rdata = {31'b0, irq_en_reg};
+    8'h18: rdata = dropped_reg;
+    8'h1C: rdata = DEPTH;
+    default: rdata = 32'b0;
+  endcase
+end
+// ===== End read hardwire =====
+
+wire req = wb_cyc_i & wb_stb_i & ~wb_ack_o;
+
+// ==== Begin write/read logic ====
+always_ff @(posedge clk_i) begin
+  if (rst_i) begin
+    wb_ack_o <= 1'b0;
+  end else begin
+    // every request get ACK-ed in the next cycle
+    wb_ack_o <= req;
+  end
+
+  // the buffer is read synchronously so that it maps to block RAM
+  if (req && !wb_we_i) begin
+    if (is_buffer)
+      wb_dat_o <= wb_adr_i[2] ? info_mem[entry] : pc_mem[entry];
+    else
+      wb_dat_o <= rdata;
+  end
+end
+
+always_ff @(posedge clk_i) begin
+  if (rst_i) begin
+    enable_reg <= 1'b0;
+    interval_reg <= DEFAULT_INTERVAL;
+    wr_ptr <= 0;
+    rd_ptr <= 0;
+    irq_en_reg <= 1'b0;
+    dropped_reg <= 0;
+    last_pc <= 0;
+    countdown <= DEFAULT_INTERVAL - 1;
+  end else begin
+    if (retire_i)
+      last_pc <= retire_pc_i;
+
+    if (sample) begin
+      countdown <= interval_reg - 1;
+      if (full)
+        dropped_reg <= dropped_reg + 1;
+      else
+        wr_ptr <= wr_ptr + 1;
+    end else if (enable_reg) begin
+      countdown <= countdown - 1;
+    end
+
+    if (req && wb_we_i && !is_buffer) begin
+      case (wb_adr_i[7:0])
+        8'h00: begin
+          enable_reg <= wb_dat_i[0];
+          if (wb_dat_i[1]) begin
+            wr_ptr <= 0;
+            rd_ptr <= 0;
+          end
+        end
+        8'h04: begin
+          interval_reg <= wb_dat_i == 0 ? 32'd1 : wb_dat_i;
+          countdown <= wb_dat_i == 0 ? 32'd0 : wb_dat_i - 1;
+        end
+        8'h0C: begin
+          // only pointers between the oldest sample and wr_ptr are kept
+          if (wb_dat_i[DEPTH_LOG2:0] - rd_ptr <= count)
+            rd_ptr <= wb_dat_i[DEPTH_LOG2:0];
+        end
+        8'h14: irq_en_reg <= wb_dat_i[0];
+        8'h18: dropped_reg <= 0;
+        default: ;
+      endcase
+    end
+  end
+end
+// ===== End write/read logic =====
+
+endmodule
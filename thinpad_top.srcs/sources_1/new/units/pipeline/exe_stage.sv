@@ -34,6 +34,7 @@ module exe_stage(
   output reg [31:0] exe_pc_o,
 
   // signals to MEM stage
+  output reg        mem_flushed_o,
   output reg [31:0] mem_pc_o,
   output reg [31:0] mem_instr_o,
   output reg [31:0] mem_mem_wdata_o,
@@ -61,7 +62,12 @@ module exe_stage(
   output reg [ 4:0] exe_rf_waddr_o,
 
   // signals from exception unit
-  input wire        interrupt_i
+  input wire        interrupt_i,
+  input wire        wfi_wake_i,
+
+  // signals to pipeline controller (wfi stall, interrupt injection)
+  output reg        wfi_stall_o,
+  output reg        irq_inject_o
 );
 
   // pipeline registers
@@ -230,8 +236,13 @@ module exe_stage(
     // tbl flush
     exe_pc_o = pc;
 
+    // wfi waits in EXE until an interrupt is pending; the interrupt is then
+    // taken by the next instruction, so that xepc points after the wfi
+    wfi_stall_o = (sys_instr == SYS_INSTR_WFI) && !wfi_wake_i;
+
     // exception signals generation
-    if (interrupt_i && !flushed) begin
+    irq_inject_o = interrupt_i && !flushed && sys_instr != SYS_INSTR_WFI;
+    if (irq_inject_o) begin
       exc_sig_gen.exc_occur = 1'b1;
       exc_sig_gen.exc_ret = 1'b0;
       exc_sig_gen.cur_pc = pc;
@@ -243,6 +254,7 @@ module exe_stage(
     mem_exc_sig_o = exc_sig_gen;
 
     // signals to MEM stage
+    mem_flushed_o = flushed;
     mem_pc_o = pc;
     mem_instr_o = instr;
     mem_mem_wdata_o = rf_rdata_b_exact;
@@ -44,7 +44,10 @@ module id_stage(
 
   // signals to forward unit
   output reg [ 4:0] id_rf_raddr_a_o,
-  output reg [ 4:0] id_rf_raddr_b_o
+  output reg [ 4:0] id_rf_raddr_b_o,
+
+  // signals to pipeline controller (xret speculation)
+  output reg        xret_o
 );
 
   // pipeline registers
@@ -144,5 +147,9 @@ module id_stage(
       exc_sig_gen = exc_sig;
     end
     exe_exc_sig_o = exc_sig_gen;
+
+    // a legal mret/sret that will reach MEM as an exception return
+    xret_o = !flushed && !exc_sig_gen.exc_occur &&
+             (sys_instr == SYS_INSTR_MRET || sys_instr == SYS_INSTR_SRET);
   end
 endmodule
\ No newline at end of file
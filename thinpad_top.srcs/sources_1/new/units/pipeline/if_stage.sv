@@ -1,5 +1,7 @@
 `include "../../headers/exc.vh"
-module if_stage(
+module if_stage #(
+  parameter RESET_VECTOR = 32'h8000_0000  // first instruction fetched after reset
+) (
   input wire clk_i,
   input wire rst_i,
 
@@ -104,7 +106,7 @@ module if_stage(
 
   always_ff @(posedge clk_i) begin
     if (rst_i) begin
-      pc <= 32'h8000_0000;
+      pc <= RESET_VECTOR;
     end else if (stall_i) begin
       // do nothing
     end else begin
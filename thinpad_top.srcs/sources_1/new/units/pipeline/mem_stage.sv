@@ -19,6 +19,7 @@ module mem_stage(
   input  wire        mmu_invalid_addr_i,
 
   // signals from EXE stage
+  input wire        mem_flushed_i,
   input wire [31:0] mem_pc_i,
   input wire [31:0] mem_instr_i,
   input wire [31:0] mem_mem_wdata_i,
@@ -40,6 +41,7 @@ module mem_stage(
   input wire [ 1:0]  privilege_i,
 
   // signals to WB(write back) stage
+  output reg        wb_flushed_o,
   output reg [31:0] wb_pc_o,
   output reg [31:0] wb_instr_o,
   output reg [31:0] wb_rf_wdata_o,
@@ -79,6 +81,7 @@ module mem_stage(
   mem_state_t mem_state, mem_next_state;
 
   // pipeline registers
+  logic        flushed;
   logic [31:0] pc;
   logic [31:0] instr;
   logic [31:0] mem_wdata;
@@ -163,16 +166,16 @@ module mem_stage(
           case (funct3)
             3'b000: begin  //lb
               case (mmu_v_addr_o[1:0])
-                2'b00: mem_rdata <= $signed(mmu_data_i[ 7: 0]);
-                2'b01: mem_rdata <= $signed(mmu_data_i[15: 8]);
-                2'b10: mem_rdata <= $signed(mmu_data_i[23:16]);
-                2'b11: mem_rdata <= $signed(mmu_data_i[31:24]);
+                2'b00: mem_rdata <= {{24{mmu_data_i[7]}}, mmu_data_i[ 7: 0]};
+                2'b01: mem_rdata <= {{24{mmu_data_i[15]}}, mmu_data_i[15: 8]};
+                2'b10: mem_rdata <= {{24{mmu_data_i[23]}}, mmu_data_i[23:16]};
+                2'b11: mem_rdata <= {{24{mmu_data_i[31]}}, mmu_data_i[31:24]};
               endcase
             end
             3'b001: begin  //lh
               case (mmu_v_addr_o[1])
-                1'b0: mem_rdata <= $signed(mmu_data_i[15: 0]);
-                1'b1: mem_rdata <= $signed(mmu_data_i[31:16]);
+                1'b0: mem_rdata <= {{16{mmu_data_i[15]}}, mmu_data_i[15: 0]};
+                1'b1: mem_rdata <= {{16{mmu_data_i[31]}}, mmu_data_i[31:16]};
               endcase
             end
             3'b010: begin  //lw
@@ -180,18 +183,19 @@ module mem_stage(
             end
             3'b100: begin  //lbu
               case (mmu_v_addr_o[1:0])
-                2'b00: mem_rdata <= mmu_data_i[ 7: 0];
-                2'b01: mem_rdata <= mmu_data_i[15: 8];
-                2'b10: mem_rdata <= mmu_data_i[23:16];
-                2'b11: mem_rdata <= mmu_data_i[31:24];
+                2'b00: mem_rdata <= {24'b0, mmu_data_i[ 7: 0]};
+                2'b01: mem_rdata <= {24'b0, mmu_data_i[15: 8]};
+                2'b10: mem_rdata <= {24'b0, mmu_data_i[23:16]};
+                2'b11: mem_rdata <= {24'b0, mmu_data_i[31:24]};
               endcase
             end
             3'b101: begin  //lhu
               case (mmu_v_addr_o[1])
-                1'b0: mem_rdata <= mmu_data_i[15: 0];
-                1'b1: mem_rdata <= mmu_data_i[31:16];
+                1'b0: mem_rdata <= {16'b0, mmu_data_i[15: 0]};
+                1'b1: mem_rdata <= {16'b0, mmu_data_i[31:16]};
               endcase
             end
+            default: ;
           endcase
         end
       end
@@ -220,6 +224,7 @@ module mem_stage(
 
   always_ff @(posedge clk_i) begin
     if (rst_i) begin
+      flushed <= 1'b1;
       pc <= 32'h0;
       instr <= 32'h0000_0013;  // nop
       alu_result <= 32'h0;
@@ -235,6 +240,7 @@ module mem_stage(
     end else if (stall_i) begin
       // do nothing
     end else if (flush_i) begin
+      flushed <= 1'b1;
       pc <= 32'h0;
       instr <= 32'h0000_0013;  // nop
       alu_result <= 32'h0;
@@ -248,6 +254,7 @@ module mem_stage(
       sys_instr <= SYS_INSTR_NOP;
       exc_sig <= `EXC_SIG_NULL;
     end else begin
+      flushed <= mem_flushed_i;
       pc <= mem_pc_i;
       instr <= mem_instr_i;
       alu_result <= mem_alu_result_i;
@@ -343,7 +350,7 @@ module mem_stage(
         satp_update_en = csr_wen && (csr_addr == `CSR_SATP_ADDR);
         csr_rf_wdata_sel = 1'b1;
         csr_wen_o = csr_wen;
-        csr_wdata_o = $unsigned(csr_rs1_addr);
+        csr_wdata_o = {27'b0, csr_rs1_addr};
       end
       SYS_INSTR_CSRRSI: begin
         csr_wen = (!exc_sig.exc_occur) && (csr_rs1_addr != 5'b0_0000) && (!stall_i);
@@ -405,6 +412,7 @@ module mem_stage(
     mem_busy = mem_enable_exact & ~mem_state;
 
     // signals to WB stage
+    wb_flushed_o = flushed;
     wb_pc_o = pc;
     wb_instr_o = instr;
     wb_rf_wdata_o = rf_wdata;
@@ -1,6 +1,9 @@
 `include "../../headers/alu.vh"
 `include "../../headers/exc.vh"
-module pipeline(
+`include "../../headers/csr.vh"
+module pipeline #(
+  parameter RESET_VECTOR = 32'h8000_0000
+) (
   input wire clk_i,
   input wire rst_i,
 
@@ -53,6 +56,12 @@ module pipeline(
 
   /* ========== exception unit signals ========== */
   input  wire        exc_interrupt_i,
+  input  wire        exc_wfi_wake_i,
+  input  wire [31:0] exc_irq_pc_i,
+  input  wire        exc_irq_fast_i,
+  input  wire [31:0] exc_ret_pc_i,
+  input  wire        exc_ret_fast_i,
+  input  wire        exc_same_regime_i,
   input  wire [31:0] exc_csr_rdata_i,
   input  wire        exc_csr_invalid_r_i,
   input  wire        exc_csr_invalid_w_i,
@@ -68,7 +77,15 @@ module pipeline(
   output wire [ 1:0] exc_privilege_o,
 
   input  wire [31:0] exc_next_pc_i,
-  input  wire [ 1:0] exc_nxt_privilege_i
+  input  wire [ 1:0] exc_nxt_privilege_i,
+
+  /* ========== performance counter and commit trace signals ========== */
+  output wire        retire_o,
+  output wire [31:0] retire_pc_o,
+  output wire [31:0] retire_instr_o,
+  output wire [ 4:0] retire_rd_addr_o,
+  output wire [31:0] retire_rd_wdata_o,
+  output wire [`HPM_EVENT_WIDTH-1:0] hpm_event_o
 );
 
   // basic mmu version
@@ -98,6 +115,7 @@ module pipeline(
   logic        id_exe_rf_wen;
   logic [`SYS_INSTR_T_WIDTH-1:0] id_exe_sys_instr;
   logic [  `EXC_SIG_T_WIDTH-1:0] id_exe_exc_sig;
+  logic        id_xret;
 
   // EXE signals
   logic [31:0] exe_mem_pc;
@@ -110,6 +128,8 @@ module pipeline(
   logic        exe_mem_rf_wen;
   logic [31:0] exe_if_pc;
   logic        exe_if_pc_sel;
+  logic        exe_wfi_stall;
+  logic        exe_irq_inject;
   logic [31:0] exe_exe_pc;
   logic [31:0] exe_forward_alu_a;
   logic [31:0] exe_forward_alu_b;
@@ -119,8 +139,10 @@ module pipeline(
   logic [ 4:0] exe_mem_csr_rs1_addr;
   logic [`SYS_INSTR_T_WIDTH-1:0] exe_mem_sys_instr;
   logic [  `EXC_SIG_T_WIDTH-1:0] exe_mem_exc_sig;
+  logic        exe_mem_flushed;
 
   // MEM signals
+  logic        mem_wb_flushed;
   logic [31:0] mem_wb_pc;
   logic [31:0] mem_wb_instr;
   logic [31:0] mem_wb_rf_wdata;
@@ -171,7 +193,9 @@ module pipeline(
 
 
   /* ========== IF stage ========== */
-  if_stage u_if_stage(
+  if_stage #(
+    .RESET_VECTOR(RESET_VECTOR)
+  ) u_if_stage(
     .clk_i(clk_i),
     .rst_i(rst_i),
 
@@ -254,7 +278,10 @@ module pipeline(
 
     // signals to harzard handler
     .id_rf_raddr_a_o(id_rf_raddr_a),
-    .id_rf_raddr_b_o(id_rf_raddr_b)
+    .id_rf_raddr_b_o(id_rf_raddr_b),
+
+    // signals to pipeline controller
+    .xret_o(id_xret)
   );
 
   /* ========== EXE stage ========== */
@@ -290,6 +317,7 @@ module pipeline(
     .exe_pc_o(exe_exe_pc),
 
     // signals to MEM stage
+    .mem_flushed_o(exe_mem_flushed),
     .mem_pc_o(exe_mem_pc),
     .mem_instr_o(exe_mem_instr),
     .mem_mem_wdata_o(exe_mem_mem_data),
@@ -317,7 +345,10 @@ module pipeline(
     .exe_rf_waddr_o(exe_rf_waddr),
 
     // interrupt signals
-    .interrupt_i(exc_interrupt_i)
+    .interrupt_i(exc_interrupt_i),
+    .wfi_wake_i(exc_wfi_wake_i),
+    .wfi_stall_o(exe_wfi_stall),
+    .irq_inject_o(exe_irq_inject)
     );
 
   /* ========== MEM stage ========== */
@@ -341,6 +372,7 @@ module pipeline(
     .mmu_invalid_addr_i(mmu0_invalid_addr_i),
 
     // signals from EXE stage
+    .mem_flushed_i(exe_mem_flushed),
     .mem_pc_i(exe_mem_pc),
     .mem_instr_i(exe_mem_instr),
     .mem_mem_wdata_i(exe_mem_mem_data),
@@ -362,6 +394,7 @@ module pipeline(
     .privilege_i(privilege),
 
     // signals to WB(write back) stage
+    .wb_flushed_o(mem_wb_flushed),
     .wb_pc_o(mem_wb_pc),
     .wb_instr_o(mem_wb_instr),
     .wb_rf_wdata_o(mem_wb_rf_wdata),
@@ -398,6 +431,7 @@ module pipeline(
     .rst_i(rst_i),
 
     // signals from MEM stage
+    .wb_flushed_i(mem_wb_flushed),
     .wb_pc_i(mem_wb_pc),
     .wb_instr_i(mem_wb_instr),
     .wb_rf_wdata_i(mem_wb_rf_wdata),
@@ -416,7 +450,14 @@ module pipeline(
     // signals to forward unit
     .wb_rf_wdata_o(wb_rf_wdata),
     .wb_rf_waddr_o(wb_rf_waddr),
-    .wb_rf_wen_o(wb_rf_wen)
+    .wb_rf_wen_o(wb_rf_wen),
+
+    // signals to performance counters and the commit trace
+    .retire_o(retire_o),
+    .retire_pc_o(retire_pc_o),
+    .retire_instr_o(retire_instr_o),
+    .retire_rd_addr_o(retire_rd_addr_o),
+    .retire_rd_wdata_o(retire_rd_wdata_o)
   );
 
   /* ========== Pipeline Controller ========== */
@@ -433,10 +474,13 @@ module pipeline(
     .exe_if_pc_i(exe_if_pc),
     .exe_if_pc_sel_i(exe_if_pc_sel),  // 0: pc+4, 1: exe_pc
     .exe_exe_pc_i(exe_exe_pc),
+    .exe_wfi_stall_i(exe_wfi_stall),
+    .exe_irq_inject_i(exe_irq_inject),
 
     // signals from ID stage
     .id_rf_raddr_a_i(id_rf_raddr_a),
     .id_rf_raddr_b_i(id_rf_raddr_b),
+    .id_xret_i(id_xret),
 
     // signals from ID/EXE pipeline registers
     .exe_rf_raddr_a_i(exe_rf_raddr_a),
@@ -490,7 +534,17 @@ module pipeline(
 
     // pc signals from exception unit
     .exc_pc_i(exc_next_pc_i),
-    .exc_nxt_privilege_i(exc_nxt_privilege_i)
+    .exc_nxt_privilege_i(exc_nxt_privilege_i),
+
+    // early redirect hints from exception unit
+    .exc_irq_pc_i(exc_irq_pc_i),
+    .exc_irq_fast_i(exc_irq_fast_i),
+    .exc_ret_pc_i(exc_ret_pc_i),
+    .exc_ret_fast_i(exc_ret_fast_i),
+    .exc_same_regime_i(exc_same_regime_i),
+
+    // events to performance counters
+    .hpm_event_o(hpm_event_o)
   );
   assign exc_privilege_o = privilege;
 endmodule
\ No newline at end of file
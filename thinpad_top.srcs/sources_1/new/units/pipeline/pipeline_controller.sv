@@ -1,5 +1,6 @@
 `include "../../headers/exc.vh"
 `include "../../headers/privilege.vh"
+`include "../../headers/csr.vh"
 module pipeline_controller(
   input wire clk_i,
   input wire rst_i,
@@ -14,10 +15,13 @@ module pipeline_controller(
   input wire [31:0] exe_if_pc_i,
   input wire        exe_if_pc_sel_i,  // 0: pc+4, 1: exe_pc
   input wire [31:0] exe_exe_pc_i,
+  input wire        exe_wfi_stall_i,
+  input wire        exe_irq_inject_i,
 
   // signals from ID stage
   input wire [ 4:0] id_rf_raddr_a_i,
   input wire [ 4:0] id_rf_raddr_b_i,
+  input wire        id_xret_i,
 
   // signals from ID/EXE pipeline registers
   input wire [ 4:0] exe_rf_raddr_a_i,
@@ -73,7 +77,17 @@ module pipeline_controller(
 
   // pc signals from exception unit
   input wire [31:0] exc_pc_i,
-  input wire [ 1:0] exc_nxt_privilege_i
+  input wire [ 1:0] exc_nxt_privilege_i,
+
+  // early redirect hints from exception unit
+  input wire [31:0] exc_irq_pc_i,
+  input wire        exc_irq_fast_i,
+  input wire [31:0] exc_ret_pc_i,
+  input wire        exc_ret_fast_i,
+  input wire        exc_same_regime_i,
+
+  // events to performance counters
+  output reg [`HPM_EVENT_WIDTH-1:0] hpm_event_o
 );
 
   logic       mem_busy;      // memory busy status
@@ -106,6 +120,39 @@ module pipeline_controller(
     privilege_o = cpu_priv_lvl;
   end
 
+  /* ========== early redirect ========== */
+  // When an interrupt is injected in EXE, or a mret/sret is decoded in ID,
+  // IF is sent to the expected handler/return target right away instead of
+  // waiting for the trap to commit in MEM. The guess is kept in spec_pc and
+  // IF then holds the fetched instruction until the commit. If the commit
+  // goes to spec_pc under the same translation, the fetched instruction is
+  // kept and the redirect costs no extra fetch; otherwise the normal flush
+  // and refetch is done.
+  logic        spec_valid;
+  logic [31:0] spec_pc;
+  logic        spec_hit;
+  logic        irq_redirect;
+  logic        ret_redirect;
+
+  assign spec_hit = spec_valid & (exc_pc_i == spec_pc) & exc_same_regime_i;
+
+  always_ff @(posedge clk_i) begin
+    if (rst_i) begin
+      spec_valid <= 1'b0;
+      spec_pc <= 32'h0000_0000;
+    end else if (!mem_busy) begin
+      if (exc_handling | mem_tlb_flush_or_satp_update_i) begin
+        spec_valid <= 1'b0;
+      end else if (irq_redirect) begin
+        spec_valid <= 1'b1;
+        spec_pc <= exc_irq_pc_i;
+      end else if (ret_redirect) begin
+        spec_valid <= 1'b1;
+        spec_pc <= exc_ret_pc_i;
+      end
+    end
+  end
+
   /* ========== forward unit ========== */
   logic mem_forward_enable;
   logic wb_forward_enable;
@@ -144,6 +191,15 @@ module pipeline_controller(
   logic load_use_hazard;
 
   always_comb begin
+    irq_redirect = 1'b0;
+    ret_redirect = 1'b0;
+
+    hpm_event_o = '0;
+    hpm_event_o[`HPM_EVENT_IF_BUSY] = if_if_busy_i;
+    hpm_event_o[`HPM_EVENT_MEM_BUSY] = mem_mem_busy_i;
+    hpm_event_o[`HPM_EVENT_WFI] = exe_wfi_stall_i;
+    hpm_event_o[`HPM_EVENT_REDIRECT_HIT] = exc_handling & spec_hit;
+
     // load use hazard
     if (exe_mem_en_i && !exe_mem_wen_i && 
     (exe_rf_waddr_i == id_rf_raddr_a_i || exe_rf_waddr_i == id_rf_raddr_b_i)) begin
@@ -151,6 +207,9 @@ module pipeline_controller(
     end else begin
       load_use_hazard = 1'b0;
     end
+    // there is no load-use bubble: the load stalls the pipeline in MEM and
+    // its data is then forwarded, so count each pair once as it moves on
+    hpm_event_o[`HPM_EVENT_LOAD_USE] = load_use_hazard & ~mem_busy;
 
     if_stall_o = 1'b0;
     id_stall_o = 1'b0;
@@ -170,7 +229,7 @@ module pipeline_controller(
       mem_stall_o = 1'b1;
       wb_stall_o = 1'b1;
     end else if (exc_handling) begin  // flush if exception occurs
-      id_flush_o = 1'b1;
+      id_flush_o = ~spec_hit;  // keep the prefetched target
       exe_flush_o = 1'b1;
       mem_flush_o = 1'b1;
       wb_flush_o = 1'b1;
@@ -178,9 +237,27 @@ module pipeline_controller(
       id_flush_o = 1'b1;
       exe_flush_o = 1'b1;
       mem_flush_o = 1'b1;
+    end else if (exe_wfi_stall_i) begin  // hold wfi in EXE, let MEM and WB drain
+      // The stall signals are the clock enables of the IF/ID/EXE registers,
+      // and IF stops issuing fetches once its current access completes
+      if_stall_o = 1'b1;
+      id_stall_o = 1'b1;
+      exe_stall_o = 1'b1;
+      mem_flush_o = 1'b1;
+    end else if (spec_valid) begin  // hold the prefetched target until commit
+      if_stall_o = 1'b1;
+      id_flush_o = 1'b1;
+    end else if (exe_irq_inject_i & exc_irq_fast_i) begin  // prefetch the handler
+      irq_redirect = 1'b1;
+      id_flush_o = 1'b1;
+      exe_flush_o = 1'b1;
     end else if (exe_if_pc_sel_i == 1'b1) begin  // branch and jump
       id_flush_o = 1'b1;
       exe_flush_o = 1'b1;
+      hpm_event_o[`HPM_EVENT_BRANCH_FLUSH] = 1'b1;
+    end else if (id_xret_i & exc_ret_fast_i) begin  // fetch the xret target
+      ret_redirect = 1'b1;
+      id_flush_o = 1'b1;
     end
   end
   
@@ -188,9 +265,12 @@ module pipeline_controller(
   always_comb begin
     if_pc_o = exc_handling ? exc_pc_i :
               mem_tlb_flush_or_satp_update_i ? exe_exe_pc_i:
+              irq_redirect ? exc_irq_pc_i :
               exe_if_pc_sel_i ? exe_if_pc_i :
+              ret_redirect ? exc_ret_pc_i :
               32'h0000_0000;
-    if_pc_sel_o = exc_handling | mem_tlb_flush_or_satp_update_i | exe_if_pc_sel_i;
+    if_pc_sel_o = (exc_handling & ~spec_hit) | mem_tlb_flush_or_satp_update_i |
+                  irq_redirect | exe_if_pc_sel_i | ret_redirect;
   end
 
 endmodule
\ No newline at end of file
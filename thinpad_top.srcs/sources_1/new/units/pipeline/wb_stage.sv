@@ -3,6 +3,7 @@ module wb_stage(
   input wire rst_i,
 
   // signals from MEM stage
+  input wire        wb_flushed_i,
   input wire [31:0] wb_pc_i,
   input wire [31:0] wb_instr_i,
   input wire [31:0] wb_rf_wdata_i,
@@ -21,9 +22,17 @@ module wb_stage(
   // signals to forward unit
   output reg [31:0] wb_rf_wdata_o,
   output reg [ 4:0] wb_rf_waddr_o,
-  output reg        wb_rf_wen_o
+  output reg        wb_rf_wen_o,
+
+  // signals to performance counters and the commit trace
+  output reg        retire_o,
+  output reg [31:0] retire_pc_o,
+  output reg [31:0] retire_instr_o,
+  output reg [ 4:0] retire_rd_addr_o,   // 0 if no register is written
+  output reg [31:0] retire_rd_wdata_o
 );
   // pipeline registers
+  logic        flushed;
   logic [31:0] pc;
   logic [31:0] instr;
   logic [31:0] rf_wdata;
@@ -32,6 +41,7 @@ module wb_stage(
 
   always_ff @(posedge clk_i) begin
     if (rst_i) begin
+      flushed <= 1'b1;
       pc <= 32'h0;
       instr <= 32'h0000_0013;  // nop
       rf_wdata <= 32'h0;
@@ -40,12 +50,14 @@ module wb_stage(
     end else if (stall_i) begin
       // do nothing
     end else if (flush_i) begin
+      flushed <= 1'b1;
       pc <= 32'h0;
       instr <= 32'h0000_0013;  // nop
       rf_wdata <= 32'h0;
       rf_waddr <= 5'h0;
       rf_wen <= 1'b0;
     end else begin
+      flushed <= wb_flushed_i;
       pc <= wb_pc_i;
       instr <= wb_instr_i;
       rf_wdata <= wb_rf_wdata_i;
@@ -64,5 +76,12 @@ module wb_stage(
     wb_rf_wdata_o = rf_wdata;
     wb_rf_waddr_o = rf_waddr;
     wb_rf_wen_o = rf_wen;
+
+    // an instruction retires in the cycle it leaves WB
+    retire_o = ~flushed & ~stall_i;
+    retire_pc_o = pc;
+    retire_instr_o = instr;
+    retire_rd_addr_o = rf_wen ? rf_waddr : 5'h0;
+    retire_rd_wdata_o = rf_wen && rf_waddr != 5'h0 ? rf_wdata : 32'h0;
   end
 endmodule
\ No newline at end of file
@@ -0,0 +1,193 @@
+`default_nettype none
+`timescale 1ns / 1ps
+
+// Platform-level interrupt controller, following the register layout of
+// the RISC-V PLIC spec (and the SiFive/QEMU virt PLIC at 0x0C00_0000).
+// Context 0 drives M-mode external interrupts (mip.meip) and context 1
+// drives S-mode external interrupts (mip.seip).
+//
+// Register map (offsets from the base address):
+//   0x00_0000 + 4*id     source priority, 0 (never) to 7
+//   0x00_1000            pending bits, read-only
+//   0x00_2000            enable bits of context 0
+//   0x00_2080            enable bits of context 1
+//   0x20_0000            priority threshold of context 0
+//   0x20_0004            claim/complete of context 0
+//   0x20_1000            priority threshold of context 1
+//   0x20_1004            claim/complete of context 1
+//
+// Reading claim returns the highest priority pending source enabled in the
+// context whose priority exceeds the threshold (lowest id on ties) and
+// clears its pending bit. The source is not forwarded again until its id is
+// written back to complete.
+module plic #(
+  parameter NUM_SOURCES = 4,          // source ids 1 ~ NUM_SOURCES
+  // bit i - 1 set: source i is edge-triggered, otherwise level-triggered
+  parameter [NUM_SOURCES-1:0] EDGE_TRIGGERED = '0
+) (
+  input wire clk_i,
+  input wire rst_i,
+
+  // Wishbone slave
+  input wire wb_cyc_i,
+  input wire wb_stb_i,
+  output reg wb_ack_o,
+  input wire [31:0] wb_adr_i,
+  input wire [31:0] wb_dat_i,
+  output reg [31:0] wb_dat_o,
+  input wire [ 3:0] wb_sel_i,
+  input wire wb_we_i,
+
+  // Interrupt sources, bit i - 1 is source i
+  input wire [NUM_SOURCES-1:0] irq_i,
+
+  // External interrupt lines to the CPU
+  output wire meip_o,
+  output wire seip_o
+);
+
+localparam NUM_CONTEXTS = 2;
+localparam ID_WIDTH = $clog2(NUM_SOURCES + 1);
+
+// ==== Gateways ====
+// Level sources are sampled while not in flight; edge sources latch the
+// rising edge even while in flight so that none is lost.
+logic [NUM_SOURCES-1:0] irq_d;
+logic [NUM_SOURCES-1:0] pending;
+logic [NUM_SOURCES-1:0] in_flight;
+logic [NUM_SOURCES-1:0] edge_seen;
+
+// ==== Registers ====
+logic [2:0] priority_reg [1:NUM_SOURCES];
+logic [NUM_SOURCES:1] enable_reg [0:NUM_CONTEXTS-1];
+logic [2:0] threshold_reg [0:NUM_CONTEXTS-1];
+
+// ==== Arbitration ====
+logic [ID_WIDTH-1:0] best_id [0:NUM_CONTEXTS-1];
+logic [2:0] best_prio [0:NUM_CONTEXTS-1];
+
+always_comb begin
+  for (int c = 0; c < NUM_CONTEXTS; c++) begin
+    best_id[c] = 0;
+    best_prio[c] = 0;
+    for (int i = 1; i <= NUM_SOURCES; i++) begin
+      if (pending[i-1] && enable_reg[c][i] && priority_reg[i] > best_prio[c]) begin
+        best_id[c] = ID_WIDTH'(i);
+        best_prio[c] = priority_reg[i];
+      end
+    end
+    if (best_prio[c] <= threshold_reg[c]) begin
+      best_id[c] = 0;
+    end
+  end
+end
+
+assign meip_o = best_id[0] != 0;
+assign seip_o = best_id[1] != 0;
+
+// ==== Address decoding ====
+wire [23:0] offset = wb_adr_i[23:0];
+
+wire is_priority = offset[23:12] == 12'h000;
+wire is_pending = offset[23:12] == 12'h001;
+wire is_enable = offset[23:12] == 12'h002 && offset[11:8] == 4'h0;
+// only contexts 0 and 1 exist; 0x20_2000 and up read as 0 and ignore writes
+wire is_context = offset[23:16] == 8'h20 && offset[15:13] == 3'h0 && offset[11:3] == 9'h0;
+
+// context number for the enable and threshold/claim registers
+wire enable_ctx = offset[7];
+wire context_ctx = offset[12];
+
+wire [9:0] prio_id = offset[11:2];
+
+// ==== Begin read hardwire ====
+logic [31:0] rdata;
+always_comb begin
+  rdata = 32'b0;
+  if (is_priority) begin
+    if (prio_id >= 1 && prio_id <= NUM_SOURCES)
+      rdata = 32'(priority_reg[prio_id[ID_WIDTH-1:0]]);
+  end else if (is_pending) begin
+    if (offset[11:2] == 0)
+      rdata = 32'({pending, 1'b0});
+  end else if (is_enable) begin
+    if (offset[6:2] == 0)
+      rdata = 32'({enable_reg[enable_ctx], 1'b0});
+  end else if (is_context) begin
+    if (offset[2])
+      rdata = 32'(best_id[context_ctx]);
+    else
+      rdata = 32'(threshold_reg[context_ctx]);
+  end
+end
+// ===== End read hardwire =====
+
+wire req = wb_cyc_i & wb_stb_i & ~wb_ack_o;
+wire claim = req & ~wb_we_i & is_context & offset[2];
+wire complete = req & wb_we_i & is_context & offset[2];
+wire [ID_WIDTH-1:0] claim_id = best_id[context_ctx];
+
+// ==== Begin write/read logic ====
+always_ff @(posedge clk_i) begin
+  if (rst_i) begin
+    wb_ack_o <= 1'b0;
+    for (int i = 1; i <= NUM_SOURCES; i++)
+      priority_reg[i] <= 0;
+    for (int c = 0; c < NUM_CONTEXTS; c++) begin
+      enable_reg[c] <= 0;
+      threshold_reg[c] <= 0;
+    end
+  end else begin
+    // every request get ACK-ed in the next cycle
+    wb_ack_o <= req;
+    if (req) begin
+      if (!wb_we_i) begin
+        wb_dat_o <= rdata;
+      end else if (is_priority) begin
+        if (prio_id >= 1 && prio_id <= NUM_SOURCES)
+          priority_reg[prio_id[ID_WIDTH-1:0]] <= wb_dat_i[2:0];
+      end else if (is_enable) begin
+        if (offset[6:2] == 0)
+          enable_reg[enable_ctx] <= wb_dat_i[NUM_SOURCES:1];
+      end else if (is_context && !offset[2]) begin
+        threshold_reg[context_ctx] <= wb_dat_i[2:0];
+      end
+    end
+  end
+end
+// ===== End write/read logic =====
+
+always_ff @(posedge clk_i) begin
+  if (rst_i) begin
+    irq_d <= 0;
+    pending <= 0;
+    in_flight <= 0;
+    edge_seen <= 0;
+  end else begin
+    irq_d <= irq_i;
+    for (int i = 1; i <= NUM_SOURCES; i++) begin
+      if (EDGE_TRIGGERED[i-1]) begin
+        if (irq_i[i-1] && !irq_d[i-1])
+          edge_seen[i-1] <= 1'b1;
+        else if (edge_seen[i-1] && !pending[i-1] && !in_flight[i-1])
+          edge_seen[i-1] <= 1'b0;
+        if (edge_seen[i-1] && !in_flight[i-1])
+          pending[i-1] <= 1'b1;
+      end else if (irq_i[i-1] && !in_flight[i-1]) begin
+        pending[i-1] <= 1'b1;
+      end else if (!irq_i[i-1]) begin
+        // a level source that drops before being claimed is withdrawn
+        pending[i-1] <= 1'b0;
+      end
+
+      if (claim && claim_id == ID_WIDTH'(i)) begin
+        pending[i-1] <= 1'b0;
+        in_flight[i-1] <= 1'b1;
+      end else if (complete && wb_dat_i[ID_WIDTH-1:0] == ID_WIDTH'(i)) begin
+        in_flight[i-1] <= 1'b0;
+      end
+    end
+  end
+end
+
+endmodule
@@ -5,6 +5,8 @@ module sram_controller #(
     parameter SRAM_ADDR_WIDTH = 20,
     parameter SRAM_DATA_WIDTH = 32,
 
+    parameter BURST_LEN = 16,  // words per burst on the burst read port, power of 2
+
     localparam SRAM_BYTES = SRAM_DATA_WIDTH / 8,
     localparam SRAM_BYTE_WIDTH = $clog2(SRAM_BYTES)
 ) (
@@ -22,6 +24,15 @@ module sram_controller #(
     input wire [DATA_WIDTH/8-1:0] wb_sel_i,
     input wire wb_we_i,
 
+    // burst read port, one word per cycle (tie burst_req_i to 0 if unused).
+    // Hold burst_req_i and burst_addr_i until burst_done_o, and drop the
+    // request in that cycle unless another burst is wanted.
+    input wire burst_req_i,
+    input wire [SRAM_ADDR_WIDTH-1:0] burst_addr_i,  // word address
+    output reg burst_valid_o,
+    output reg [SRAM_DATA_WIDTH-1:0] burst_data_o,
+    output reg burst_done_o,
+
     // sram interface
     output reg [SRAM_ADDR_WIDTH-1:0] sram_addr,
     inout wire [SRAM_DATA_WIDTH-1:0] sram_data,
@@ -32,7 +43,7 @@ module sram_controller #(
 );
 
     // FSM state definition
-    typedef enum logic [1:0] {STATE_IDLE, STATE_READ, STATE_WRITE, STATE_WRITE_2} state_t;
+    typedef enum logic [2:0] {STATE_IDLE, STATE_READ, STATE_WRITE, STATE_WRITE_2, STATE_BURST} state_t;
     state_t current_state, next_state;
     
     // FSM state transition
@@ -44,12 +55,27 @@ module sram_controller #(
         end
     end
 
+    // Bursts and Wishbone accesses alternate when both are pending, so the
+    // burst port gets BURST_LEN words every BURST_LEN + 4 cycles at worst
+    // and the bus never waits for more than one burst.
+    reg burst_last;
+    reg [$clog2(BURST_LEN)-1:0] burst_cnt;
+
+    wire wb_req;
+    wire burst_go;
+    wire wb_go;
+    assign wb_req = wb_cyc_i && wb_stb_i;
+    assign burst_go = burst_req_i && !(wb_req && burst_last);
+    assign wb_go = wb_req && !burst_go;
+
     // FSM state output
     always_comb begin
         next_state = STATE_IDLE;  // default next state
         case (current_state)
             STATE_IDLE: begin
-                if (wb_cyc_i && wb_stb_i) begin
+                if (burst_go) begin
+                    next_state = STATE_BURST;
+                end else if (wb_go) begin
                     if (wb_we_i) begin  // write
                         next_state = STATE_WRITE;
                     end else begin  // read
@@ -60,12 +86,20 @@ module sram_controller #(
             STATE_READ: begin
                 next_state = STATE_IDLE;
             end
+            STATE_BURST: begin
+                if (&burst_cnt) begin
+                    next_state = STATE_IDLE;
+                end else begin
+                    next_state = STATE_BURST;
+                end
+            end
             STATE_WRITE: begin
                 next_state = STATE_WRITE_2;
             end
             STATE_WRITE_2: begin
                 next_state = STATE_IDLE;
             end
+            default: ;
         endcase
     end
 
@@ -76,6 +110,29 @@ module sram_controller #(
     assign sram_data = sram_data_t_comb ? 32'bz : sram_data_o_comb;
     assign sram_data_i_comb = sram_data;
 
+    always @(posedge clk_i) begin
+        if (rst_i) begin
+            burst_last <= 1'b0;
+            burst_cnt <= 0;
+            burst_valid_o <= 1'b0;
+            burst_done_o <= 1'b0;
+        end else begin
+            burst_valid_o <= 1'b0;
+            burst_done_o <= 1'b0;
+            if (current_state == STATE_BURST) begin
+                burst_valid_o <= 1'b1;
+                burst_data_o <= sram_data_i_comb;
+                burst_cnt <= burst_cnt + 1;
+                if (&burst_cnt) begin
+                    burst_done_o <= 1'b1;
+                    burst_last <= 1'b1;
+                end
+            end else if (current_state == STATE_IDLE && wb_go) begin
+                burst_last <= 1'b0;
+            end
+        end
+    end
+
     // FSM output
     always_comb begin
         sram_ce_n = 1'b1;
@@ -86,7 +143,7 @@ module sram_controller #(
         sram_data_t_comb = 1'b0;
         case (current_state)
             STATE_IDLE: begin
-                if (wb_cyc_i && wb_stb_i) begin
+                if (wb_go) begin
                     if (wb_we_i) begin  // write
                         sram_ce_n = 1'b0;
                         sram_oe_n = 1'b1;
@@ -118,6 +175,16 @@ module sram_controller #(
                 sram_we_n = 1'b1;
                 sram_data_t_comb = 1'b0;
             end
+            STATE_BURST: begin
+                // a new address every cycle, data is sampled at the next edge
+                sram_ce_n = 1'b0;
+                sram_oe_n = 1'b0;
+                sram_we_n = 1'b1;
+                sram_be_n = {SRAM_BYTES{1'b0}};
+                sram_addr = burst_addr_i + SRAM_ADDR_WIDTH'(burst_cnt);
+                sram_data_t_comb = 1'b1;
+            end
+            default: ;
         endcase
 
         case (wb_sel_i)
@@ -154,7 +221,7 @@ module sram_controller #(
         end
         case (current_state)
             STATE_IDLE: begin
-                if (wb_cyc_i && wb_stb_i) begin
+                if (wb_go) begin
                     if (!wb_we_i) begin  // read
                         wb_ack_o <= 1'b1;  // set ack
                         wb_dat_o <= sram_data_i_comb;
@@ -170,6 +237,7 @@ module sram_controller #(
             STATE_WRITE_2: begin
                 wb_ack_o <= 1'b0;  // clear ack
             end
+            default: ;
         endcase
     end
 endmodule
@@ -0,0 +1,319 @@
+`default_nettype none
+`timescale 1ns / 1ps
+
+// Compressed commit trace. Follows the instructions retired from WB, and the
+// mret/sret committed in MEM, and only records what cannot be inferred from
+// the program binary: one bit per
+// conditional branch (taken or not), the target of every jalr/xRET, and the
+// PC after any other discontinuity (traps). A full sync PC is inserted
+// every SYNC_INTERVAL retired instructions so that a decoder can start
+// anywhere in the buffer. Entries go into a ring buffer in block RAM.
+//
+// Register map (offsets from the base address):
+//   0x00  CTRL           bit0 enable tracing, bit1 write 1: empty the buffer,
+//                        bit2 wrap: overwrite the oldest entries when full
+//                        instead of dropping new ones
+//   0x04  SYNC_INTERVAL  retired instructions between sync entries, 0: never
+//   0x08  WR_PTR         index of the next entry to be written, read-only
+//   0x0C  RD_PTR         index of the oldest unread entry, software advances it
+//   0x10  STATUS         [15:0] entries in the buffer, bit16 half full, bit17 full
+//   0x14  IRQ_EN         bit0 raise irq_o while the buffer is at least half full
+//   0x18  DROPPED        entries dropped because the buffer was full, write clears
+//   0x1C  DEPTH          buffer size in entries
+//   0x20  RETIRED        instructions retired while tracing, xRETs included
+//   0x10000 + 16*i       entry i (i = pointer mod DEPTH):
+//     +0 [31:30] type, [29:25] number of branch bits, [24:0] branch bits,
+//        bit0 is the oldest branch, 1 is taken
+//     +4 target: [31:2] PC of the instruction retired after the event,
+//        [1:0] privilege it retired in
+//     +8 source: PC of the instruction retired before the event
+//
+// Entry types:
+//   0 BRANCH    branch bits only, the 25 bits were used up
+//   1 INDIRECT  a jalr, mret or sret at source jumped to target
+//   2 TRAP      an exception or interrupt was taken after source
+//   3 SYNC      periodic sync, also the first entry after enabling, clearing
+//               or dropping entries (source is 0 in that case)
+// The branch bits of an INDIRECT, TRAP or SYNC entry were recorded before
+// the event. Disabling tracing writes out the pending branch bits.
+module trace_encoder #(
+  parameter DEPTH_LOG2 = 10,            // 1024 entries, 12KB
+  parameter DEFAULT_SYNC_INTERVAL = 4096
+) (
+  input wire clk_i,
+  input wire rst_i,
+
+  // Wishbone slave
+  input wire wb_cyc_i,
+  input wire wb_stb_i,
+  output reg wb_ack_o,
+  input wire [31:0] wb_adr_i,
+  input wire [31:0] wb_dat_i,
+  output reg [31:0] wb_dat_o,
+  input wire [ 3:0] wb_sel_i,
+  input wire wb_we_i,
+
+  // Pipeline
+  input wire        retire_i,
+  input wire [31:0] retire_pc_i,
+  input wire [31:0] retire_instr_i,
+  input wire [ 1:0] privilege_i,
+  input wire        xret_i,         // a mret/sret commits in MEM
+  input wire [31:0] xret_pc_i,
+
+  output wire irq_o
+);
+
+localparam DEPTH = 2 ** DEPTH_LOG2;
+localparam MAX_BITS = 25;
+
+localparam TYPE_BRANCH = 2'd0;
+localparam TYPE_INDIRECT = 2'd1;
+localparam TYPE_TRAP = 2'd2;
+localparam TYPE_SYNC = 2'd3;
+
+// ==== Registers ====
+logic        enable_reg;
+logic        wrap_reg;
+logic [31:0] sync_interval_reg;
+logic [DEPTH_LOG2:0] wr_ptr;
+logic [DEPTH_LOG2:0] rd_ptr;
+logic        irq_en_reg;
+logic [31:0] dropped_reg;
+logic [31:0] retired_reg;
+
+wire [DEPTH_LOG2:0] count = wr_ptr - rd_ptr;
+wire half_full = count >= DEPTH / 2;
+wire full = count == DEPTH;
+
+assign irq_o = irq_en_reg & half_full;
+
+// ==== Retirement ====
+// An xRET commits in MEM and is flushed there, so it never retires from WB.
+// WB holds the bubble left by that flush in the next cycle, so the xRET is
+// traced then, after the older instruction that may retire along with it.
+logic        xret_q;
+logic [31:0] xret_pc_q;
+
+wire        retire = retire_i | xret_q;
+wire [31:0] retire_pc = xret_q ? xret_pc_q : retire_pc_i;
+
+// ==== Encoder state ====
+logic        have_prev;       // cleared to start with a sync entry
+logic [31:0] prev_pc;
+logic [31:0] prev_instr;
+logic        prev_xret;
+logic [MAX_BITS-1:0] bits;
+logic [ 4:0] nbits;
+logic [31:0] since_sync;
+
+// the instruction retired before the current one
+wire [6:0] prev_opcode = prev_instr[6:0];
+wire prev_branch = prev_opcode == 7'b1100011;
+wire prev_jal = prev_opcode == 7'b1101111;
+wire prev_indirect = prev_opcode == 7'b1100111 || prev_xret;
+
+wire [31:0] prev_seq = prev_pc + 4;
+wire [31:0] prev_imm_b = {{20{prev_instr[31]}}, prev_instr[7], prev_instr[30:25], prev_instr[11:8], 1'b0};
+wire [31:0] prev_imm_j = {{12{prev_instr[31]}}, prev_instr[19:12], prev_instr[20], prev_instr[30:21], 1'b0};
+wire [31:0] prev_direct = prev_pc + (prev_jal ? prev_imm_j : prev_imm_b);
+
+// ==== Bus decoding ====
+wire req = wb_cyc_i & wb_stb_i & ~wb_ack_o;
+wire is_buffer = wb_adr_i[16];
+wire [DEPTH_LOG2-1:0] entry = wb_adr_i[4 +: DEPTH_LOG2];
+
+wire ctrl_we = req & wb_we_i & !is_buffer & wb_adr_i[7:0] == 8'h00;
+wire do_clear = ctrl_we & wb_dat_i[1];
+wire do_stop = ctrl_we & !wb_dat_i[0] & enable_reg;
+
+// ==== Encoding ====
+logic       emit;
+logic [1:0] emit_type;
+logic       add_bit;
+logic       taken;
+
+always_comb begin
+  emit = 1'b0;
+  emit_type = TYPE_BRANCH;
+  add_bit = 1'b0;
+  taken = retire_pc != prev_seq;
+
+  if (do_stop) begin
+    // flush the pending branch bits, the current instruction is not traced
+    emit = nbits != 0;
+  end else if (enable_reg && retire) begin
+    if (!have_prev || (sync_interval_reg != 0 && since_sync >= sync_interval_reg)) begin
+      emit = 1'b1;
+      emit_type = TYPE_SYNC;
+    end else if (prev_indirect) begin
+      emit = 1'b1;
+      emit_type = TYPE_INDIRECT;
+    end else if (prev_branch && (retire_pc == prev_seq || retire_pc == prev_direct)) begin
+      add_bit = 1'b1;
+      emit = nbits == MAX_BITS - 1;
+    end else if (retire_pc != (prev_jal ? prev_direct : prev_seq)) begin
+      emit = 1'b1;
+      emit_type = TYPE_TRAP;
+    end
+  end
+end
+
+wire [MAX_BITS-1:0] emit_bits = add_bit ? bits | (MAX_BITS'(taken) << nbits) : bits;
+wire [4:0] emit_nbits = add_bit ? nbits + 1 : nbits;
+wire emit_branch_only = do_stop || add_bit;
+
+wire [31:0] entry_hdr = {emit_type, emit_nbits, emit_bits};
+wire [31:0] entry_target = emit_branch_only ? 32'h0 : {retire_pc[31:2], privilege_i};
+wire [31:0] entry_source = emit_branch_only || !have_prev ? 32'h0 : prev_pc;
+
+wire write = emit && (!full || wrap_reg);
+wire drop = emit && full && !wrap_reg;
+
+// ==== Trace buffer ====
+(* ram_style = "block" *)
+logic [31:0] hdr_mem [0:DEPTH-1];
+(* ram_style = "block" *)
+logic [31:0] target_mem [0:DEPTH-1];
+(* ram_style = "block" *)
+logic [31:0] source_mem [0:DEPTH-1];
+
+always_ff @(posedge clk_i) begin
+  if (write) begin
+    hdr_mem[wr_ptr[DEPTH_LOG2-1:0]] <= entry_hdr;
+    target_mem[wr_ptr[DEPTH_LOG2-1:0]] <= entry_target;
+    source_mem[wr_ptr[DEPTH_LOG2-1:0]] <= entry_source;
+  end
+end
+
+// ==== Begin read hardwire ====
+logic [31:0] rdata;
+always_comb begin
+  case (wb_adr_i[7:0])
+    8'h00: rdata = {29'b0, wrap_reg, 1'b0, enable_reg};
+    8'h04: rdata = sync_interval_reg;
+    8'h08: rdata = 32'(wr_ptr);
+    8'h0C: rdata = 32'(rd_ptr);
+    8'h10: rdata = {14'b0, full, half_full, 16'(count)};
+    8'h14: rdata = {31'b0, irq_en_reg};
+    8'h18: rdata = dropped_reg;
+    8'h1C: rdata = DEPTH;
+    8'h20: rdata = retired_reg;
+    default: rdata = 32'b0;
+  endcase
+end
+// ===== End read hardwire =====
+
+// ==== Begin write/read logic ====
+always_ff @(posedge clk_i) begin
+  if (rst_i) begin
+    wb_ack_o <= 1'b0;
+  end else begin
+    // every request get ACK-ed in the next cycle
+    wb_ack_o <= req;
+  end
+
+  // the buffer is read synchronously so that it maps to block RAM
+  if (req && !wb_we_i) begin
+    if (is_buffer) begin
+      case (wb_adr_i[3:2])
+        2'd0: wb_dat_o <= hdr_mem[entry];
+        2'd1: wb_dat_o <= target_mem[entry];
+        2'd2: wb_dat_o <= source_mem[entry];
+        default: wb_dat_o <= 32'b0;
+      endcase
+    end else begin
+      wb_dat_o <= rdata;
+    end
+  end
+end
+
+always_ff @(posedge clk_i) begin
+  if (rst_i) begin
+    xret_q <= 1'b0;
+    xret_pc_q <= 0;
+  end else begin
+    xret_q <= xret_i;
+    xret_pc_q <= xret_pc_i;
+  end
+end
+
+always_ff @(posedge clk_i) begin
+  if (rst_i) begin
+    enable_reg <= 1'b0;
+    wrap_reg <= 1'b0;
+    sync_interval_reg <= DEFAULT_SYNC_INTERVAL;
+    wr_ptr <= 0;
+    rd_ptr <= 0;
+    irq_en_reg <= 1'b0;
+    dropped_reg <= 0;
+    retired_reg <= 0;
+    have_prev <= 1'b0;
+    prev_pc <= 0;
+    prev_instr <= 32'h0000_0013;  // nop
+    prev_xret <= 1'b0;
+    bits <= 0;
+    nbits <= 0;
+    since_sync <= 0;
+  end else begin
+    // ==== Encoder ====
+    if (enable_reg && retire && !do_stop) begin
+      have_prev <= 1'b1;
+      prev_pc <= retire_pc;
+      prev_instr <= xret_q ? 32'h0000_0013 : retire_instr_i;
+      prev_xret <= xret_q;
+      retired_reg <= retired_reg + 1;
+      since_sync <= emit && emit_type == TYPE_SYNC ? 32'd1 : since_sync + 1;
+    end
+
+    if (emit) begin
+      bits <= 0;
+      nbits <= 0;
+    end else if (add_bit) begin
+      bits <= emit_bits;
+      nbits <= emit_nbits;
+    end
+
+    if (write) begin
+      wr_ptr <= wr_ptr + 1;
+      // the oldest entry is overwritten
+      if (full)
+        rd_ptr <= rd_ptr + 1;
+    end else if (drop) begin
+      dropped_reg <= dropped_reg + 1;
+      // the decoder lost track, start over with a sync entry
+      have_prev <= 1'b0;
+    end
+
+    // ==== Registers ====
+    if (req && wb_we_i && !is_buffer) begin
+      case (wb_adr_i[7:0])
+        8'h00: begin
+          enable_reg <= wb_dat_i[0];
+          wrap_reg <= wb_dat_i[2];
+          if (!wb_dat_i[0] || wb_dat_i[1])
+            have_prev <= 1'b0;
+          if (wb_dat_i[1]) begin
+            wr_ptr <= 0;
+            rd_ptr <= 0;
+            bits <= 0;
+            nbits <= 0;
+          end
+        end
+        8'h04: sync_interval_reg <= wb_dat_i;
+        8'h0C: begin
+          // only pointers between the oldest entry and wr_ptr are kept
+          if (wb_dat_i[DEPTH_LOG2:0] - rd_ptr <= count)
+            rd_ptr <= wb_dat_i[DEPTH_LOG2:0];
+        end
+        8'h14: irq_en_reg <= wb_dat_i[0];
+        8'h18: dropped_reg <= 0;
+        8'h20: retired_reg <= wb_dat_i;
+        default: ;
+      endcase
+    end
+  end
+end
+// ===== End write/read logic =====
+
+endmodule
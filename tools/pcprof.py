@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+"""Turn a dump of the PC profiler (0x8B00_0000) into a flat profile.
+
+The dump holds one sample per line as two hex words, "pc info", the way a
+monitor loop prints the buffer at 0x8B01_0000; blank lines and lines
+starting with '#' are skipped. With --binary the dump is the raw buffer,
+8 bytes per sample, little endian.
+
+Samples are attributed to the function symbols of the ELF given with -e;
+without it only addresses are reported.
+
+    python3 tools/pcprof.py -e kernel.elf dump.txt
+"""
+import argparse
+import bisect
+import struct
+import sys
+from collections import Counter
+
+PRIV_NAMES = {0: 'U', 1: 'S', 3: 'M'}
+CAUSE_NAMES = ['run', 'mem', 'fetch', 'wfi', 'flush']
+
+
+def read_symbols(path):
+    """Return (addresses, names) of the FUNC symbols of a 32-bit ELF, sorted."""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:4] != b'\x7fELF' or data[4] != 1:
+        sys.exit(f'{path}: not a 32-bit ELF file')
+    endian = '<' if data[5] == 1 else '>'
+
+    e_shoff, = struct.unpack_from(endian + 'I', data, 0x20)
+    e_shentsize, e_shnum = struct.unpack_from(endian + 'HH', data, 0x2E)
+
+    sections = []
+    for i in range(e_shnum):
+        sections.append(struct.unpack_from(endian + 'IIIIIIIIII', data, e_shoff + i * e_shentsize))
+
+    syms = {}
+    for sh in sections:
+        sh_type, sh_offset, sh_size, sh_link, sh_entsize = sh[1], sh[4], sh[5], sh[6], sh[9]
+        if sh_type != 2:  # SHT_SYMTAB
+            continue
+        strtab_offset = sections[sh_link][4]
+        for off in range(sh_offset, sh_offset + sh_size, sh_entsize or 16):
+            st_name, st_value, st_size, st_info = struct.unpack_from(endian + 'IIIB', data, off)
+            if st_info & 0xF != 2:  # STT_FUNC
+                continue
+            end = data.index(b'\0', strtab_offset + st_name)
+            name = data[strtab_offset + st_name:end].decode(errors='replace')
+            syms.setdefault(st_value, (name, st_size))
+
+    addrs = sorted(syms)
+    return addrs, [syms[a] for a in addrs]
+
+
+def read_samples(path, binary):
+    samples = []
+    if binary:
+        with open(path, 'rb') as f:
+            data = f.read()
+        for off in range(0, len(data) - 7, 8):
+            samples.append(struct.unpack_from('<II', data, off))
+        return samples
+
+    with open(path) as f:
+        for lineno, line in enumerate(f, 1):
+            line = line.strip()
+            if not line or line.startswith('#'):
+                continue
+            words = line.split()
+            try:
+                pc = int(words[0], 16)
+                info = int(words[1], 16) if len(words) > 1 else 0
+            except ValueError:
+                sys.exit(f'{path}:{lineno}: expected "pc info" in hex')
+            samples.append((pc, info))
+    return samples
+
+
+def symbolize(pc, addrs, names):
+    i = bisect.bisect_right(addrs, pc) - 1
+    if i < 0:
+        return None
+    name, size = names[i]
+    # symbols without a size extend to the next symbol
+    if size and pc >= addrs[i] + size:
+        return None
+    return name
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Flat profile from a PC profiler dump')
+    parser.add_argument('dump', help='sample dump')
+    parser.add_argument('-e', '--elf', help='ELF with the symbol table of the profiled program')
+    parser.add_argument('--binary', action='store_true', help='the dump is the raw sample buffer')
+    parser.add_argument('-n', '--top', type=int, default=30, help='number of functions shown')
+    args = parser.parse_args()
+
+    samples = read_samples(args.dump, args.binary)
+    if not samples:
+        sys.exit('no samples')
+    total = len(samples)
+
+    addrs, names = read_symbols(args.elf) if args.elf else ([], [])
+
+    funcs = Counter()
+    func_causes = {}
+    privs = Counter()
+    causes = Counter()
+    for pc, info in samples:
+        priv = info & 0x3
+        cause = (info >> 8) & 0x7
+        name = symbolize(pc, addrs, names) or f'0x{pc:08x}'
+        funcs[name] += 1
+        func_causes.setdefault(name, Counter())[cause] += 1
+        privs[priv] += 1
+        causes[cause] += 1
+
+    print(f'{total} samples\n')
+    print(f'{"%":>7} {"samples":>8}  {"stalled":>7}  function')
+    for name, n in funcs.most_common(args.top):
+        stalled = n - func_causes[name][0]
+        print(f'{100.0 * n / total:6.2f}% {n:8}  {100.0 * stalled / n:6.1f}%  {name}')
+
+    print('\nby privilege:')
+    for priv, n in sorted(privs.items()):
+        print(f'  {PRIV_NAMES.get(priv, str(priv)):6} {100.0 * n / total:6.2f}%')
+
+    print('\nby stall cause:')
+    for cause, n in sorted(causes.items()):
+        label = CAUSE_NAMES[cause] if cause < len(CAUSE_NAMES) else str(cause)
+        print(f'  {label:6} {100.0 * n / total:6.2f}%')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,305 @@
+#!/usr/bin/env python3
+"""Rebuild the retired instruction stream from a commit trace and report
+hot functions, basic-block counts and branch behavior.
+
+Two kinds of trace are accepted:
+
+  * the compressed trace of the trace encoder (0x8C00_0000), one entry per
+    line as three hex words "hdr target source", the way a monitor loop
+    prints the buffer at 0x8C01_0000; with --binary the raw buffer, 16 bytes
+    per entry, little endian. The instructions in between the entries are
+    read from the ELF files given with -e, so every piece of code that ran
+    must be covered by one of them; where it is not, decoding resumes at the
+    next entry that carries a PC.
+  * with --sim, the file written by commit_tracer in simulation, 16 bytes
+    per retired instruction: pc, instruction, rd data, rd/privilege.
+
+    python3 tools/tracedec.py -e kernel.elf dump.txt
+    python3 tools/tracedec.py --sim -e kernel.elf /tmp/trace.bin
+"""
+import argparse
+import bisect
+import struct
+import sys
+from collections import Counter
+
+from pcprof import read_symbols, symbolize
+
+TYPE_BRANCH, TYPE_INDIRECT, TYPE_TRAP, TYPE_SYNC = range(4)
+
+# give up walking between two entries after this many instructions
+MAX_WALK = 1 << 24
+
+
+def read_segments(path):
+    """Return [(vaddr, bytes)] of the PT_LOAD segments of a 32-bit ELF."""
+    with open(path, 'rb') as f:
+        data = f.read()
+    if data[:4] != b'\x7fELF' or data[4] != 1:
+        sys.exit(f'{path}: not a 32-bit ELF file')
+    e_phoff, = struct.unpack_from('<I', data, 0x1C)
+    e_phentsize, e_phnum = struct.unpack_from('<HH', data, 0x2A)
+    segments = []
+    for i in range(e_phnum):
+        p_type, p_offset, p_vaddr, _, p_filesz = struct.unpack_from('<IIIII', data, e_phoff + i * e_phentsize)
+        if p_type == 1 and p_filesz:  # PT_LOAD
+            segments.append((p_vaddr, data[p_offset:p_offset + p_filesz]))
+    return segments
+
+
+class Program:
+    def __init__(self, elfs):
+        self.segments = []
+        self.addrs, self.names = [], []
+        for path in elfs:
+            self.segments += read_segments(path)
+            addrs, names = read_symbols(path)
+            self.addrs += addrs
+            self.names += names
+        order = sorted(range(len(self.addrs)), key=lambda i: self.addrs[i])
+        self.addrs = [self.addrs[i] for i in order]
+        self.names = [self.names[i] for i in order]
+
+    def fetch(self, pc):
+        for vaddr, data in self.segments:
+            if vaddr <= pc and pc + 4 <= vaddr + len(data):
+                return struct.unpack_from('<I', data, pc - vaddr)[0]
+        return None
+
+    def name(self, pc):
+        return symbolize(pc, self.addrs, self.names)
+
+    def location(self, pc):
+        name = self.name(pc)
+        if name is None:
+            return f'0x{pc:08x}'
+        i = bisect.bisect_right(self.addrs, pc) - 1
+        return f'0x{pc:08x} <{name}+0x{pc - self.addrs[i]:x}>'
+
+
+def sext(value, bits):
+    return value - (1 << bits) if value & (1 << (bits - 1)) else value
+
+
+def imm_b(instr):
+    return sext(((instr >> 31) & 1) << 12 | ((instr >> 7) & 1) << 11
+                | ((instr >> 25) & 0x3F) << 5 | ((instr >> 8) & 0xF) << 1, 13)
+
+
+def imm_j(instr):
+    return sext(((instr >> 31) & 1) << 20 | ((instr >> 12) & 0xFF) << 12
+                | ((instr >> 20) & 1) << 11 | ((instr >> 21) & 0x3FF) << 1, 21)
+
+
+def is_branch(instr):
+    return instr & 0x7F == 0x63
+
+
+def is_jal(instr):
+    return instr & 0x7F == 0x6F
+
+
+def is_indirect(instr):
+    return instr & 0x7F == 0x67 or instr in (0x30200073, 0x10200073)
+
+
+def branch_target(pc, instr):
+    return (pc + imm_b(instr)) & 0xFFFFFFFF
+
+
+# ==== Compressed trace ====
+
+def read_entries(path, binary):
+    entries = []
+    if binary:
+        with open(path, 'rb') as f:
+            data = f.read()
+        for off in range(0, len(data) - 15, 16):
+            entries.append(struct.unpack_from('<III', data, off))
+        return entries
+
+    with open(path) as f:
+        for lineno, line in enumerate(f, 1):
+            line = line.strip()
+            if not line or line.startswith('#'):
+                continue
+            try:
+                words = [int(w, 16) for w in line.split()[:3]]
+            except ValueError:
+                words = []
+            if len(words) != 3:
+                sys.exit(f'{path}:{lineno}: expected "hdr target source" in hex')
+            entries.append(tuple(words))
+    return entries
+
+
+class Decoder:
+    """Walks the program along the recorded branch bits and events."""
+
+    def __init__(self, program):
+        self.program = program
+        self.pc = None          # next instruction to retire, None when lost
+        self.bits = []
+        self.resyncs = 0
+
+    def walk(self, source=None):
+        """Yield (pc, instr) until a branch bit or an event is needed. With
+        source, stop after retiring source once all bits are used up."""
+        # a loop without branches repeats until the next event, which tells
+        # where it was left but not how often it ran
+        seen = set()
+        for _ in range(MAX_WALK):
+            pc = self.pc
+            instr = self.program.fetch(pc)
+            if instr is None:
+                break
+            if source is not None and pc == source and not self.bits:
+                yield pc, instr
+                return
+            if source is None:
+                if pc in seen:
+                    return
+                seen.add(pc)
+            if is_branch(instr):
+                if not self.bits:
+                    return
+                yield pc, instr
+                self.pc = branch_target(pc, instr) if self.bits.pop(0) else pc + 4
+                seen.clear()
+            elif is_jal(instr):
+                yield pc, instr
+                self.pc = (pc + imm_j(instr)) & 0xFFFFFFFF
+            elif is_indirect(instr):
+                if source is None:
+                    return
+                break
+            else:
+                yield pc, instr
+                self.pc = pc + 4
+        # the code is not in the ELF files or does not match the trace
+        self.pc = None
+        self.resyncs += 1
+        yield None
+
+    def decode(self, entries):
+        for hdr, target, source in entries:
+            kind = hdr >> 30
+            n = (hdr >> 25) & 0x1F
+            self.bits += [(hdr >> i) & 1 for i in range(n)]
+
+            if kind == TYPE_BRANCH:
+                if self.pc is None:
+                    self.bits = []
+                else:
+                    yield from self.walk()
+                continue
+
+            if self.pc is not None and not (kind == TYPE_SYNC and source == 0):
+                yield from self.walk(source)
+            elif self.pc is not None:
+                # the encoder started over, what ran before is unknown
+                yield None
+            self.bits = []
+            self.pc = target & ~0x3
+
+        if self.pc is not None:
+            yield from self.walk()
+
+
+# ==== Simulation trace ====
+
+def read_sim(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    for off in range(0, len(data) - 15, 16):
+        pc, instr, _, _ = struct.unpack_from('<IIII', data, off)
+        yield pc, instr
+
+
+# ==== Analysis ====
+
+def analyze(stream, program, top):
+    total = 0
+    funcs = Counter()
+    blocks = Counter()
+    block_len = {}
+    branches = {}
+
+    prev = None
+    block = None
+    for item in stream:
+        if item is None:
+            prev = None
+            continue
+        pc, instr = item
+        total += 1
+        funcs[program.name(pc) or '?'] += 1
+
+        if prev is not None:
+            ppc, pinstr = prev
+            if is_branch(pinstr):
+                stat = branches.setdefault(ppc, [0, 0])
+                if pc == branch_target(ppc, pinstr):
+                    stat[0] += 1
+                elif pc == ppc + 4:
+                    stat[1] += 1
+
+        # a block ends at a control transfer or any discontinuity
+        if (prev is None or pc != prev[0] + 4 or is_branch(prev[1]) or is_jal(prev[1])
+                or is_indirect(prev[1])):
+            block = pc
+            blocks[block] += 1
+            block_len.setdefault(block, 0)
+        block_len[block] = max(block_len[block], (pc - block) // 4 + 1)
+        prev = (pc, instr)
+
+    if not total:
+        sys.exit('no instructions decoded')
+
+    print(f'{total} instructions\n')
+
+    print('hot functions:')
+    print(f'{"%":>7} {"instrs":>10}  function')
+    for name, n in funcs.most_common(top):
+        print(f'{100.0 * n / total:6.2f}% {n:10}  {name}')
+
+    print('\nhot basic blocks:')
+    print(f'{"%":>7} {"count":>10} {"len":>4}  start')
+    weight = Counter({b: n * block_len[b] for b, n in blocks.items()})
+    for b, w in weight.most_common(top):
+        print(f'{100.0 * w / total:6.2f}% {blocks[b]:10} {block_len[b]:4}  {program.location(b)}')
+
+    print('\nbranches:')
+    print(f'{"count":>10} {"taken":>7}  branch')
+    by_count = sorted(branches.items(), key=lambda kv: -(kv[1][0] + kv[1][1]))
+    for pc, (taken, not_taken) in by_count[:top]:
+        n = taken + not_taken
+        if n:
+            print(f'{n:10} {100.0 * taken / n:6.1f}%  {program.location(pc)}')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode and analyze a commit trace')
+    parser.add_argument('trace', help='trace dump or simulation trace file')
+    parser.add_argument('-e', '--elf', action='append', default=[],
+                        help='ELF file of the traced code, may be given more than once')
+    parser.add_argument('--binary', action='store_true', help='the dump is the raw trace buffer')
+    parser.add_argument('--sim', action='store_true', help='the trace was written by commit_tracer')
+    parser.add_argument('-n', '--top', type=int, default=20, help='number of lines per report')
+    args = parser.parse_args()
+
+    program = Program(args.elf)
+    if args.sim:
+        analyze(read_sim(args.trace), program, args.top)
+        return
+
+    if not args.elf:
+        sys.exit('decoding the compressed trace needs the ELF files (-e)')
+    decoder = Decoder(program)
+    analyze(decoder.decode(read_entries(args.trace, args.binary)), program, args.top)
+    if decoder.resyncs:
+        print(f'\nlost track of the program {decoder.resyncs} times')
+
+
+if __name__ == '__main__':
+    main()